@@ -0,0 +1,120 @@
+/*******************************************************************************************
+*
+*   rres example - rres access trace
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It records resources access order and reorders file resource chunks in first access order
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#include <string.h>                   // Required for: memcmp()
+
+#define CHUNK_COUNT     5             // Resource chunks to write
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    rresWriter *writer = rresOpenWriter("unordered.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[1] = { 16 };             // props[0]:size (bytes)
+    unsigned char data[CHUNK_COUNT][16] = { 0 };
+
+    chunkInfo.type[0] = 'R';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'A';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'W';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'D';         // Resource chunk type (FourCC)
+
+    chunkData.propCount = 1;
+    chunkData.props = props;
+
+    bool result = true;
+
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        memset(data[i], 'a' + i, 16);
+        chunkInfo.id = i + 1;
+        chunkData.raw = data[i];
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, 16);
+    }
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Record access trace: ids requested to loaders are recorded in first access order
+    //---------------------------------------------------------------------------------
+    rresAccessTrace *trace = rresLoadAccessTrace(NULL);
+    rresSetAccessTrace(trace);
+
+    unsigned int accessIds[3] = { 4, 2, 4 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("unordered.rres", accessIds[i]);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    rresSetAccessTrace(NULL);
+
+    // NOTE: Access trace can be saved to be used later by the packer
+    result = rresSaveAccessTrace(trace, "access_trace.txt");
+    rresUnloadAccessTrace(trace);
+    //---------------------------------------------------------------------------------
+
+    // Reorder file resource chunks: accessed chunks first, the others keep file order
+    //---------------------------------------------------------------------------------
+    trace = rresLoadAccessTrace("access_trace.txt");
+    if (result) result = (trace != NULL) && rresReorderFile("unordered.rres", "ordered.rres", &trace, 1);
+    rresUnloadAccessTrace(trace);
+    //---------------------------------------------------------------------------------
+
+    // Verify reordered file: chunks order and data
+    unsigned int expectedIds[CHUNK_COUNT] = { 4, 2, 1, 3, 5 };
+    unsigned int chunkCount = 0;
+    rresResourceChunkInfo *infos = result? rresLoadResourceChunkInfoAll("ordered.rres", &chunkCount) : NULL;
+
+    if ((infos == NULL) || (chunkCount < CHUNK_COUNT)) result = false;
+    for (int i = 0; result && (i < CHUNK_COUNT); i++) result = (infos[i].id == expectedIds[i]);
+
+    RRES_FREE(infos);
+
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("ordered.rres", i + 1);
+        result = (chunk.data.raw != NULL) && (memcmp(chunk.data.raw, data[i], 16) == 0);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return result? 0 : 1;
+}
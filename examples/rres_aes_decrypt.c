@@ -0,0 +1,105 @@
+/*******************************************************************************************
+*
+*   rres example - rres aes decrypt
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It unpacks a big AES-256-CTR encrypted resource chunk with multiple threads (AES-NI/ARMv8 accelerated if available)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#define RRES_SUPPORT_THREADS
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_ENCRYPTION_AES
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <stdlib.h>                   // Required for: malloc(), free()
+#include <string.h>                   // Required for: memcmp()
+
+#define DATA_SIZE   (4*1024*1024)     // Resource chunk raw data size (bytes)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    unsigned char *data = (unsigned char *)malloc(DATA_SIZE);
+    if (data == NULL) return 1;
+
+    for (int i = 0; i < DATA_SIZE; i++) data[i] = (unsigned char)(i*31 + (i >> 9));
+
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'R';
+    item.info.type[1] = 'A';
+    item.info.type[2] = 'W';
+    item.info.type[3] = 'D';
+    item.info.id = 1;
+    item.info.cipherType = RRES_CIPHER_AES;
+    item.data.propCount = 1;
+    item.data.props = props;
+    item.data.raw = data;
+    item.data.rawSize = DATA_SIZE;
+
+    rresPackContext packContext = { 0 };
+    packContext.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("aes.rres", RRES_FILE_VERSION);
+    bool result = (writer != NULL) && rresPackResourceChunks(writer, &item, 1, PackResourceChunk, &packContext, 1);
+    if ((writer != NULL) && !rresCloseWriter(writer)) result = false;
+
+    // Unpack resource chunk: single thread (context) and multiple threads (UnpackResourceChunk() state)
+    // NOTE: AES CTR blocks are independent, big chunks are decrypted in parallel parts
+    rresUnpackContext context = LoadUnpackContext("password12345");
+    context.threadCount = 1;
+
+    rresSetCipherPassword("password12345");
+    SetUnpackThreadCount(4);
+
+    for (int i = 0; result && (i < 2); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("aes.rres", 1);
+        int unpackResult = (i == 0)? UnpackResourceChunkEx(&chunk, &context) : UnpackResourceChunk(&chunk);
+
+        result = (unpackResult == 0) && (chunk.data.rawSize == DATA_SIZE) && (memcmp(chunk.data.raw, data, DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    UnloadUnpackContext(context);
+    FlushCipherKeys();
+    free(data);
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************************
+*
+*   rres example - rres aligned data
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It writes aligned resource chunks (raw data aligned in file and memory) and loads them back
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#include "../src/rres-raylib.h"       // Required to pack and map rres data chunks into raylib structs
+
+#include <stdint.h>                   // Required for: uintptr_t
+#include <string.h>                   // Required for: memcmp()
+
+#define IMAGE_SIZE      64            // Image width and height (pixels)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Generate image pixel data: RRES_PIXELFORMAT_UNCOMP_R8G8B8A8
+    static unsigned char pixels[IMAGE_SIZE*IMAGE_SIZE*4] = { 0 };
+    for (int i = 0; i < IMAGE_SIZE*IMAGE_SIZE*4; i++) pixels[i] = (unsigned char)((i%4 == 3)? 255 : (i*7)%251);
+
+    unsigned int props[4] = { IMAGE_SIZE, IMAGE_SIZE, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+    unsigned int alignments[2] = { 4096, 64 };
+
+    rresWriter *writer = rresOpenWriter("aligned.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    // Write aligned uncompressed image: IMGE resource chunk (id: 1)
+    // NOTE: Padding depends on file offset, raw data is aligned in file (it could be memory mapped)
+    //---------------------------------------------------------------------------------
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+
+    chunkInfo.type[0] = 'I';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'M';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'G';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'E';         // Resource chunk type (FourCC)
+    chunkInfo.id = 1;
+    chunkInfo.flags = rresSetDataAlignment(0, alignments[0]);
+
+    chunkData.propCount = 4;
+    chunkData.props = props;
+    chunkData.raw = pixels;
+
+    bool result = rresWriteResourceChunk(writer, chunkInfo, chunkData, sizeof(pixels));
+    //---------------------------------------------------------------------------------
+
+    // Pack aligned LZ4 compressed image: IMGE resource chunk (id: 2)
+    // NOTE: Padding aligns raw data to the start of unpacked data
+    //---------------------------------------------------------------------------------
+    rresPackItem item = { 0 };
+    item.info = chunkInfo;
+    item.info.id = 2;
+    item.info.compType = RRES_COMP_LZ4;
+    item.info.flags = rresSetDataAlignment(0, alignments[1]);
+    item.data = chunkData;
+    item.data.rawSize = sizeof(pixels);
+
+    if (result) result = rresPackResourceChunks(writer, &item, 1, PackResourceChunk, NULL, 1);
+    //---------------------------------------------------------------------------------
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Load images back: raw data size excludes header padding, raw data is aligned in memory
+    for (int i = 0; i < 2; i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("aligned.rres", i + 1);
+
+        if (UnpackResourceChunk(&chunk) == 0)     // Decompress resource data (if required)
+        {
+            Image image = LoadImageFromResource(chunk);
+
+            if ((image.data == NULL) || (image.width != IMAGE_SIZE) || (image.height != IMAGE_SIZE) ||
+                (memcmp(image.data, pixels, sizeof(pixels)) != 0)) result = false;
+            if (((uintptr_t)chunk.data.raw%alignments[i]) != 0) result = false;
+
+            UnloadImage(image);
+        }
+        else result = false;
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************************
+*
+*   rres example - rres archive key
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It derives an archive cipher key once (KDFR), resource chunks keys are derived from it (no key stretching per chunk)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_ENCRYPTION_AES
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <string.h>                   // Required for: memcmp()
+
+#define ITEM_COUNT      8             // Resource chunks to pack
+#define DATA_SIZE     256             // Resource chunk raw data size (bytes)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned char data[ITEM_COUNT][DATA_SIZE] = { 0 };
+    static unsigned int props[1] = { DATA_SIZE };   // props[0]:size (bytes)
+    rresPackItem items[ITEM_COUNT] = { 0 };
+
+    for (int i = 0; i < ITEM_COUNT; i++)
+    {
+        for (int k = 0; k < DATA_SIZE; k++) data[i][k] = (unsigned char)(k*i + k/7);
+
+        items[i].info.type[0] = 'R';
+        items[i].info.type[1] = 'A';
+        items[i].info.type[2] = 'W';
+        items[i].info.type[3] = 'D';
+        items[i].info.id = i + 1;
+        items[i].info.cipherType = (i%2 == 0)? RRES_CIPHER_XCHACHA20_POLY1305 : RRES_CIPHER_AES_GCM;
+        items[i].data.propCount = 1;
+        items[i].data.props = props;
+        items[i].data.raw = data[i];
+        items[i].data.rawSize = DATA_SIZE;
+    }
+
+    rresPackContext packContext = { 0 };
+    packContext.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("archive_key.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    // Write archive key derivation record (KDFR): archive key is derived from password once,
+    // resource chunks packed after it are encrypted with keys derived from archive key (RRES_FLAG_ARCHIVE_KEY)
+    bool result = WriteArchiveCipherKey(writer, &packContext) &&
+                  rresPackResourceChunks(writer, items, ITEM_COUNT, PackResourceChunk, &packContext, 1);
+
+    UnloadPackContext(&packContext);    // Archive key is wiped
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Load archive cipher key: key stretching is only done once per archive
+    rresUnpackContext context = LoadUnpackContext("password12345");
+    result = LoadArchiveCipherKey(&context, "archive_key.rres");
+
+    for (int i = 0; result && (i < ITEM_COUNT); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("archive_key.rres", i + 1);
+
+        result = ((chunk.info.flags & RRES_FLAG_ARCHIVE_KEY) != 0) && (UnpackResourceChunkEx(&chunk, &context) == 0) &&
+                 (chunk.data.rawSize == DATA_SIZE) && (memcmp(chunk.data.raw, data[i], DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    UnloadUnpackContext(context);
+
+    // Archive key derived from a wrong password can not decrypt resource chunks
+    rresUnpackContext wrongContext = LoadUnpackContext("wrong password");
+
+    if (result && LoadArchiveCipherKey(&wrongContext, "archive_key.rres"))
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("archive_key.rres", 1);
+        result = (UnpackResourceChunkEx(&chunk, &wrongContext) != 0);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    UnloadUnpackContext(wrongContext);
+
+    return result? 0 : 1;
+}
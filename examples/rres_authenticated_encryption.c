@@ -0,0 +1,111 @@
+/*******************************************************************************************
+*
+*   rres example - rres authenticated encryption
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs resource chunks with authenticated encryption (AES-256-GCM, XChaCha20-Poly1305), modified data is not unpacked
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_ENCRYPTION_AES
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <string.h>                   // Required for: memcmp()
+
+#define DATA_SIZE   10000             // Resource chunk raw data size (bytes)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned char data[DATA_SIZE] = { 0 };
+    for (int i = 0; i < DATA_SIZE; i++) data[i] = (unsigned char)(i%97);
+
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+    int ciphers[2] = { RRES_CIPHER_AES_GCM, RRES_CIPHER_XCHACHA20_POLY1305 };
+    rresPackItem items[2] = { 0 };
+
+    // Pack resource chunks: LZ4 compressed and encrypted, authentication tag appended to packed data
+    for (int i = 0; i < 2; i++)
+    {
+        items[i].info.type[0] = 'R';
+        items[i].info.type[1] = 'A';
+        items[i].info.type[2] = 'W';
+        items[i].info.type[3] = 'D';
+        items[i].info.id = i + 1;
+        items[i].info.compType = RRES_COMP_LZ4;
+        items[i].info.cipherType = ciphers[i];
+        items[i].data.propCount = 1;
+        items[i].data.props = props;
+        items[i].data.raw = data;
+        items[i].data.rawSize = DATA_SIZE;
+    }
+
+    rresPackContext packContext = { 0 };
+    packContext.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("authenticated.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    bool result = rresPackResourceChunks(writer, items, 2, PackResourceChunk, &packContext, 1);
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    rresUnpackContext context = LoadUnpackContext("password12345");
+
+    for (int i = 0; result && (i < 2); i++)
+    {
+        // Unpack resource chunk: data is authenticated while decrypted (single pass)
+        rresResourceChunk chunk = rresLoadResourceChunk("authenticated.rres", i + 1);
+
+        result = (UnpackResourceChunkEx(&chunk, &context) == 0) && (memcmp(chunk.data.raw, data, DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+
+        // Modify packed data: authentication fails, chunk is kept packed
+        chunk = rresLoadResourceChunk("authenticated.rres", i + 1);
+        ((unsigned char *)chunk.data.raw)[10] ^= 0x01;
+
+        if (result) result = (UnpackResourceChunkEx(&chunk, &context) != 0) && (chunk.info.cipherType == ciphers[i]);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    UnloadUnpackContext(context);
+
+    return result? 0 : 1;
+}
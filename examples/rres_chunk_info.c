@@ -67,7 +67,7 @@ int main(void)
             if ((infos[i].id == dir.entries[j].id) && (infos[i].id != prevId))
             {
                 printf("Input File: %s\n", dir.entries[j].fileName);
-                printf("Resource(s) Offset: 0x%08x\n", dir.entries[j].offset);
+                printf("Resource(s) Offset: 0x%08llx\n", dir.entries[j].offset);
                 prevId = dir.entries[j].id;
                 break;
             }
@@ -77,9 +77,9 @@ int main(void)
         printf("       > id:            0x%08x\n", infos[i].id);
         printf("       > compType:      %s (%i)\n", GetCompressionName((int)infos[i].compType), (int)infos[i].compType);
         printf("       > cipherType:    %s (%i)\n", GetCipherName((int)infos[i].cipherType), (int)infos[i].cipherType);
-        printf("       > baseSize:      %i\n", infos[i].baseSize);
-        printf("       > packedSize:    %i (%i%%)\n", infos[i].packedSize, (int)(((float)infos[i].packedSize/infos[i].baseSize)*100)); // Get compression ratio
-        printf("       > nextOffset:    %i\n", infos[i].nextOffset);
+        printf("       > baseSize:      %llu\n", infos[i].baseSize);
+        printf("       > packedSize:    %llu (%i%%)\n", infos[i].packedSize, (int)(((float)infos[i].packedSize/infos[i].baseSize)*100)); // Get compression ratio
+        printf("       > nextOffset:    %llu\n", infos[i].nextOffset);
         printf("       > CRC32:         0x%08x\n", infos[i].crc32);
     }
 
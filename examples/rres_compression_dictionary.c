@@ -0,0 +1,163 @@
+/*******************************************************************************************
+*
+*   rres example - rres compression dictionary
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs many small text resource chunks with an archive compression dictionary (DICT) trained from their data
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <stdio.h>                    // Required for: sprintf()
+#include <string.h>                   // Required for: strlen(), memcmp()
+
+#define TEXT_COUNT      500           // Number of text resource chunks
+#define TEXT_MAX_SIZE   256           // Text maximum size (bytes)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static bool PackTexts(const char *fileName, rresPackItem *items, bool useDictionary); // Pack text resource chunks into file
+static unsigned long long GetPackedDataSize(const char *fileName); // Get resource chunks packed data size from file
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static char texts[TEXT_COUNT][TEXT_MAX_SIZE] = { 0 };
+    static unsigned int props[TEXT_COUNT][4] = { 0 };
+    static rresPackItem items[TEXT_COUNT] = { 0 };
+
+    // Small similar texts: not enough data for compression on its own
+    for (int i = 0; i < TEXT_COUNT; i++)
+    {
+        sprintf(texts[i], "{ \"id\": %i, \"name\": \"item_%i\", \"type\": \"weapon\", \"damage\": %i, \"weight\": %i, \"description\": \"Common item found in dungeon level %i\" }", i, i*7%113, i*13%100, i*3%50, i%20);
+
+        props[i][0] = (unsigned int)strlen(texts[i]);   // props[0]:size (bytes)
+        props[i][1] = RRES_TEXT_ENCODING_UNDEFINED;     // props[1]:rresTextEncoding
+        props[i][2] = RRES_CODE_LANG_UNDEFINED;         // props[2]:rresCodeLang
+        props[i][3] = 0x0409;                           // props[3]:cultureCode (en-US)
+
+        items[i].info.type[0] = 'T';
+        items[i].info.type[1] = 'E';
+        items[i].info.type[2] = 'X';
+        items[i].info.type[3] = 'T';
+        items[i].info.id = 100 + i;
+        items[i].info.compType = RRES_COMP_LZ4;
+        items[i].data.propCount = 4;
+        items[i].data.props = props[i];
+        items[i].data.raw = texts[i];
+        items[i].data.rawSize = props[i][0];
+    }
+
+    bool result = PackTexts("texts.rres", items, false) && PackTexts("texts_dict.rres", items, true);
+
+    // Packed data is smaller using dictionary
+    if (result) result = (GetPackedDataSize("texts_dict.rres") < GetPackedDataSize("texts.rres"));
+
+    rresArchive *archive = result? rresOpenArchive("texts_dict.rres") : NULL;
+
+    if (archive != NULL)
+    {
+        rresUnpackContext context = LoadUnpackContext(NULL);
+
+        // Resource chunk can not be unpacked without dictionary
+        rresResourceChunk chunk = rresLoadArchiveResourceChunk(archive, 100);
+        result = (UnpackResourceChunkEx(&chunk, &context) != 0);
+        rresUnloadResourceChunk(chunk);
+
+        // Load dictionary once per archive, used by all resource chunks
+        if (result) result = LoadArchiveDictionary(&context, "texts_dict.rres");
+
+        for (int i = 0; result && (i < TEXT_COUNT); i++)
+        {
+            chunk = rresLoadArchiveResourceChunk(archive, 100 + i);
+
+            result = (UnpackResourceChunkEx(&chunk, &context) == 0) &&
+                     (chunk.data.props[0] == props[i][0]) && (memcmp(chunk.data.raw, texts[i], props[i][0]) == 0);
+
+            rresUnloadResourceChunk(chunk);
+        }
+
+        UnloadUnpackContext(context);   // Dictionary is freed
+        rresCloseArchive(archive);
+    }
+    else result = false;
+
+    return result? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Pack text resource chunks into file
+static bool PackTexts(const char *fileName, rresPackItem *items, bool useDictionary)
+{
+    rresWriter *writer = rresOpenWriter(fileName, RRES_FILE_VERSION);
+    if (writer == NULL) return false;
+
+    rresPackContext packContext = { 0 };
+    bool result = true;
+
+    // NOTE: Dictionary is trained from provided samples and written before resource chunks
+    if (useDictionary) result = WriteArchiveDictionary(writer, &packContext, items, TEXT_COUNT);
+
+    if (result) result = rresPackResourceChunks(writer, items, TEXT_COUNT, PackResourceChunk, &packContext, 1);
+    if (!rresCloseWriter(writer)) result = false;
+
+    UnloadPackContext(&packContext);
+
+    return result;
+}
+
+// Get resource chunks packed data size from file
+static unsigned long long GetPackedDataSize(const char *fileName)
+{
+    unsigned long long size = 0;
+    unsigned int count = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll(fileName, &count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if ((infos[i].type[0] == 'T') && (infos[i].type[1] == 'E') && (infos[i].type[2] == 'X') && (infos[i].type[3] == 'T')) size += infos[i].packedSize;
+    }
+
+    RRES_FREE(infos);
+
+    return size;
+}
@@ -33,40 +33,24 @@
 #include "raylib.h"
 
 #define RRES_IMPLEMENTATION
-#include "../src/rres.h"              // Required to read rres data chunks
+#include "../src/rres.h"              // Required to write rres data chunks
 
-
-// Load a continuous data buffer from rresResourceChunkData struct
-static unsigned char *LoadDataBuffer(rresResourceChunkData data, unsigned int rawSize);
-static void UnloadDataBuffer(unsigned char *buffer);   // Unload data buffer
+#include <string.h>                   // Required for: strlen()
 
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
 int main(void)
 {
-    FILE *rresFile = fopen("myresources.rres", "wb");
-
-    // Define rres file header
-    // NOTE: We are loading 4 files that generate 5 resource chunks to save in rres
-    rresFileHeader header = {
-        .id[0] = 'r',           // File identifier: rres
-        .id[1] = 'r',           // File identifier: rres
-        .id[2] = 'e',           // File identifier: rres
-        .id[3] = 's',           // File identifier: rres
-        .version = 100,         // File version: 100 for version 1.0
-        .chunkCount = 5,        // Number of resource chunks in the file (MAX: 65535)
-        .cdOffset = 0,          // Central Directory offset in file (0 if not available)
-        .reserved = 0           // <reserved>
-    };
-    
-    // Write rres file header
-    fwrite(&header, sizeof(rresFileHeader), 1, rresFile);
+    // Open rres file writer
+    // NOTE: File header is written on writer close, when chunk count and central directory offset are known
+    rresWriter *writer = rresOpenWriter("myresources.rres", RRES_FILE_VERSION);
+    
+    if (writer == NULL) return 1;
     
     rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
     rresResourceChunkData chunkData = { 0 };    // Chunk data
-    
-    unsigned char *buffer = NULL;
+    unsigned int props[4] = { 0 };              // Chunk properties
     
     // File 01: Text file -> One resource chunk: TEXT
     //---------------------------------------------------------------------------------
@@ -75,6 +59,7 @@ int main(void)
     unsigned int rawSize = strlen(text);
     
     // Define chunk info: TEXT
+    // NOTE: Sizes, CRC32 and next offset are computed by writer
     chunkInfo.type[0] = 'T';         // Resource chunk type (FourCC)
     chunkInfo.type[1] = 'E';         // Resource chunk type (FourCC)
     chunkInfo.type[2] = 'X';         // Resource chunk type (FourCC)
@@ -86,34 +71,22 @@ int main(void)
     chunkInfo.compType = RRES_COMP_NONE,     // Data compression algorithm
     chunkInfo.cipherType = RRES_CIPHER_NONE, // Data encription algorithm
     chunkInfo.flags = 0,             // Data flags (if required)
-    chunkInfo.baseSize = 5*sizeof(unsigned int) + rawSize;   // Data base size (uncompressed/unencrypted)
-    chunkInfo.packedSize = chunkInfo.baseSize; // Data chunk size (compressed/encrypted + custom data appended)
-    chunkInfo.nextOffset = 0,        // Next resource chunk global offset (if resource has multiple chunks)
-    chunkInfo.reserved = 0,          // <reserved>
     
     // Define chunk data: TEXT
+    props[0] = rawSize;              // props[0]:size (bytes)
+    props[1] = RRES_TEXT_ENCODING_UNDEFINED;  // props[1]:rresTextEncoding
+    props[2] = RRES_CODE_LANG_UNDEFINED;      // props[2]:rresCodeLang
+    props[3] = 0x0409;               // props[3]:cultureCode: en-US: English - United States
     chunkData.propCount = 4;
-    chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
-    chunkData.props[0] = rawSize;    // props[0]:size (bytes)
-    chunkData.props[1] = RRES_TEXT_ENCODING_UNDEFINED;  // props[1]:rresTextEncoding
-    chunkData.props[2] = RRES_CODE_LANG_UNDEFINED;      // props[2]:rresCodeLang
-    chunkData.props[3] = 0x0409;     // props[3]:cultureCode: en-US: English - United States
+    chunkData.props = props;
     chunkData.raw = text;
     
-    // Get a continuous data buffer from chunkData
-    buffer = LoadDataBuffer(chunkData, rawSize);
-    
-    // Compute data chunk CRC32 (propCount + props[] + data)
-    chunkInfo.crc32 = rresComputeCRC32(buffer, chunkInfo.packedSize);
-
-    // Write resource chunk into rres file
-    fwrite(&chunkInfo, sizeof(rresResourceChunkInfo), 1, rresFile);
-    fwrite(buffer, 1, chunkInfo.packedSize, rresFile);
+    // Write resource chunk into rres file and register it in central directory
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, rawSize);
+    rresAddCentralDirEntry(writer, chunkInfo.id, "resources/text_data.txt");
     
     // Free required memory
     memset(&chunkInfo, 0, sizeof(rresResourceChunkInfo));
-    RRES_FREE(chunkData.props);
-    UnloadDataBuffer(buffer);
     UnloadFileText(text);
     //---------------------------------------------------------------------------------
     
@@ -134,36 +107,22 @@ int main(void)
     
     chunkInfo.compType = RRES_COMP_NONE,     // Data compression algorithm
     chunkInfo.cipherType = RRES_CIPHER_NONE, // Data encription algorithm
-    chunkInfo.flags = 0,             // Data flags (if required)
-    chunkInfo.baseSize = 5*sizeof(unsigned int) + rawSize;   // Data base size (uncompressed/unencrypted)
-    chunkInfo.packedSize = chunkInfo.baseSize; // Data chunk size (compressed/encrypted + custom data appended)
-    chunkInfo.nextOffset = 0,        // Next resource chunk global offset (if resource has multiple chunks)
-    chunkInfo.reserved = 0,          // <reserved>
+    chunkInfo.flags = rresSetDataAlignment(0, 16); // Data flags: pixel data aligned to 16 bytes in file (padding added by writer)
     
     // Define chunk data: IMGE
-    chunkData.propCount = 4;
-    chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
-    chunkData.props[0] = image.width;      // props[0]:width
-    chunkData.props[1] = image.height;     // props[1]:height
-    chunkData.props[2] = image.format;     // props[2]:rresPixelFormat
-                                           // NOTE: rresPixelFormat matches raylib PixelFormat enum, 
-    chunkData.props[3] = image.mipmaps;    // props[3]:mipmaps                
+    props[0] = image.width;          // props[0]:width
+    props[1] = image.height;         // props[1]:height
+    props[2] = image.format;         // props[2]:rresPixelFormat
+                                     // NOTE: rresPixelFormat matches raylib PixelFormat enum, 
+    props[3] = image.mipmaps;        // props[3]:mipmaps
     chunkData.raw = image.data;
     
-    // Get a continuous data buffer from chunkData
-    buffer = LoadDataBuffer(chunkData, rawSize);
-    
-    // Compute data chunk CRC32 (propCount + props[] + data)
-    chunkInfo.crc32 = rresComputeCRC32(buffer, chunkInfo.packedSize);
-
-    // Write resource chunk into rres file
-    fwrite(&chunkInfo, sizeof(rresResourceChunkInfo), 1, rresFile);
-    fwrite(buffer, 1, chunkInfo.packedSize, rresFile);
+    // Write resource chunk into rres file and register it in central directory
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, rawSize);
+    rresAddCentralDirEntry(writer, chunkInfo.id, "resources/images/fudesumi.png");
     
     // Free required memory
     memset(&chunkInfo, 0, sizeof(rresResourceChunkInfo));
-    RRES_FREE(chunkData.props);
-    UnloadDataBuffer(buffer);
     UnloadImage(image);
     //---------------------------------------------------------------------------------
     
@@ -185,70 +144,103 @@ int main(void)
     chunkInfo.compType = RRES_COMP_NONE,     // Data compression algorithm
     chunkInfo.cipherType = RRES_CIPHER_NONE, // Data encription algorithm
     chunkInfo.flags = 0,             // Data flags (if required)
-    chunkInfo.baseSize = 5*sizeof(unsigned int) + rawSize;   // Data base size (uncompressed/unencrypted)
-    chunkInfo.packedSize = chunkInfo.baseSize; // Data chunk size (compressed/encrypted + custom data appended)
-    chunkInfo.nextOffset = 0,        // Next resource chunk global offset (if resource has multiple chunks)
-    chunkInfo.reserved = 0,          // <reserved>
     
     // Define chunk data: WAVE
-    chunkData.propCount = 4;
-    chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
-    chunkData.props[0] = wave.frameCount;      // props[0]:frameCount
-    chunkData.props[1] = wave.sampleRate;      // props[1]:sampleRate
-    chunkData.props[2] = wave.sampleSize;      // props[2]:sampleSize
-    chunkData.props[3] = wave.channels;        // props[3]:channels    
+    props[0] = wave.frameCount;      // props[0]:frameCount
+    props[1] = wave.sampleRate;      // props[1]:sampleRate
+    props[2] = wave.sampleSize;      // props[2]:sampleSize
+    props[3] = wave.channels;        // props[3]:channels
     chunkData.raw = wave.data;
     
-    // Get a continuous data buffer from chunkData
-    buffer = LoadDataBuffer(chunkData, rawSize);
-    
-    // Compute data chunk CRC32 (propCount + props[] + data)
-    chunkInfo.crc32 = rresComputeCRC32(buffer, chunkInfo.packedSize);
-
-    // Write resource chunk into rres file
-    fwrite(&chunkInfo, sizeof(rresResourceChunkInfo), 1, rresFile);
-    fwrite(buffer, 1, chunkInfo.packedSize, rresFile);
+    // Write resource chunk into rres file and register it in central directory
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, rawSize);
+    rresAddCentralDirEntry(writer, chunkInfo.id, "resources/audio/coin.wav");
     
     // Free required memory
     memset(&chunkInfo, 0, sizeof(rresResourceChunkInfo));
-    RRES_FREE(chunkData.props);
-    UnloadDataBuffer(buffer);
     UnloadWave(wave);
     //---------------------------------------------------------------------------------
     
     // File 04: Font file -> Two resource chunks: FNTG, IMGE
     //---------------------------------------------------------------------------------
     // Load file data
-    Font font = LoadFont("resources/fonts/pixantiqua.ttf");
+    // NOTE: Font glyphs and atlas are generated on CPU, no GPU context required
+    int fontSize = 32;
+    int glyphCount = 95;
+    int glyphPadding = 4;
+    int fileSize = 0;
+    unsigned char *fileData = LoadFileData("resources/fonts/pixantiqua.ttf", &fileSize);
+    GlyphInfo *fontGlyphs = LoadFontData(fileData, fileSize, fontSize, NULL, glyphCount, FONT_DEFAULT);
+    Rectangle *fontRecs = NULL;
+    Image atlas = GenImageFontAtlas(fontGlyphs, &fontRecs, glyphCount, fontSize, glyphPadding, 0);
+    
+    // Define glyphs data, as expected by rresFontGlyphInfo
+    rresFontGlyphInfo *glyphs = (rresFontGlyphInfo *)RRES_CALLOC(glyphCount, sizeof(rresFontGlyphInfo));
+    
+    for (int i = 0; i < glyphCount; i++)
+    {
+        glyphs[i].x = (int)fontRecs[i].x;
+        glyphs[i].y = (int)fontRecs[i].y;
+        glyphs[i].width = (int)fontRecs[i].width;
+        glyphs[i].height = (int)fontRecs[i].height;
+        glyphs[i].value = fontGlyphs[i].value;
+        glyphs[i].offsetX = fontGlyphs[i].offsetX;
+        glyphs[i].offsetY = fontGlyphs[i].offsetY;
+        glyphs[i].advanceX = fontGlyphs[i].advanceX;
+    }
+    
+    // Define chunk info: FNTG
+    // NOTE: Both chunks share the same id, writer links them as a multi-chunk resource (nextOffset)
+    chunkInfo.type[0] = 'F';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'N';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'G';         // Resource chunk type (FourCC)
     
-    // TODO.
+    // Resource chunk identifier (generated from filename CRC32 hash)
+    chunkInfo.id = rresComputeCRC32("resources/fonts/pixantiqua.ttf", strlen("resources/fonts/pixantiqua.ttf"));
     
-    // Free required memory
-    //memset(&chunkInfo, 0, sizeof(rresResourceChunkInfo));
-    //RRES_FREE(data.props);
-    //UnloadDataBuffer(buffer);
-    UnloadFont(font);
-    //---------------------------------------------------------------------------------
+    chunkInfo.compType = RRES_COMP_NONE,     // Data compression algorithm
+    chunkInfo.cipherType = RRES_CIPHER_NONE, // Data encription algorithm
+    chunkInfo.flags = 0,             // Data flags (if required)
     
-    fclose(rresFile);
-
-    return 0;
-}
-
-// Load a continuous data buffer from rresResourceChunkData struct
-static unsigned char *LoadDataBuffer(rresResourceChunkData data, unsigned int rawSize)
-{
-    unsigned char *buffer = (unsigned char *)RRES_CALLOC((data.propCount + 1)*sizeof(unsigned int) + rawSize, 1);
+    // Define chunk data: FNTG
+    props[0] = fontSize;             // props[0]:baseSize
+    props[1] = glyphCount;           // props[1]:glyphCount
+    props[2] = glyphPadding;         // props[2]:glyphPadding
+    props[3] = RRES_FONT_STYLE_REGULAR; // props[3]:rresFontStyle
+    chunkData.raw = glyphs;
     
-    memcpy(buffer, &data.propCount, sizeof(unsigned int));
-    for (int i = 0; i < data.propCount; i++) memcpy(buffer + (i + 1)*sizeof(unsigned int), &data.props[i], sizeof(unsigned int));
-    memcpy(buffer + (data.propCount + 1)*sizeof(unsigned int), data.raw, rawSize);
+    // Write resource chunk into rres file and register it in central directory
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, glyphCount*sizeof(rresFontGlyphInfo));
+    rresAddCentralDirEntry(writer, chunkInfo.id, "resources/fonts/pixantiqua.ttf");
     
-    return buffer;
-}
+    // Define chunk info: IMGE (font atlas)
+    chunkInfo.type[0] = 'I';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'M';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'G';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'E';         // Resource chunk type (FourCC)
+    
+    // Define chunk data: IMGE (font atlas)
+    props[0] = atlas.width;          // props[0]:width
+    props[1] = atlas.height;         // props[1]:height
+    props[2] = atlas.format;         // props[2]:rresPixelFormat
+    props[3] = atlas.mipmaps;        // props[3]:mipmaps
+    chunkData.raw = atlas.data;
+    
+    // Write resource chunk into rres file
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, GetPixelDataSize(atlas.width, atlas.height, atlas.format));
+    
+    // Free required memory
+    memset(&chunkInfo, 0, sizeof(rresResourceChunkInfo));
+    RRES_FREE(glyphs);
+    RRES_FREE(fontRecs);
+    UnloadImage(atlas);
+    UnloadFontData(fontGlyphs, glyphCount);
+    UnloadFileData(fileData);
+    //---------------------------------------------------------------------------------
+    
+    // Close rres file writer: central directory and file header are written
+    bool result = rresCloseWriter(writer);
 
-// Unload data buffer
-static void UnloadDataBuffer(unsigned char *buffer)
-{
-    RRES_FREE(buffer);
+    return result? 0 : 1;
 }
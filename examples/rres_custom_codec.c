@@ -0,0 +1,141 @@
+/*******************************************************************************************
+*
+*   rres example - rres custom codec
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs a resource chunk with a custom compression type (delta encoding) and registers its decompressor to unpack it
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <string.h>                   // Required for: memcmp()
+
+#define COMP_DELTA      100           // Custom compression type: delta encoding, not defined by rres
+#define DATA_SIZE      8192           // Resource chunk raw data size (bytes)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static bool PackDeltaResourceChunk(rresPackItem *item, void *userData); // Pack resource chunk callback: delta encoding
+static int DecodeDelta(rresCodecData *data);                    // Codec decode callback: delta decoding (in place)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned char data[DATA_SIZE] = { 0 };
+    for (int i = 0; i < DATA_SIZE; i++) data[i] = (unsigned char)(i*3 + i/256);
+
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'R';
+    item.info.type[1] = 'A';
+    item.info.type[2] = 'W';
+    item.info.type[3] = 'D';
+    item.info.id = 1;
+    item.info.compType = COMP_DELTA;
+    item.data.propCount = 1;
+    item.data.props = props;
+    item.data.raw = data;
+    item.data.rawSize = DATA_SIZE;
+
+    rresWriter *writer = rresOpenWriter("custom.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    bool result = rresPackResourceChunks(writer, &item, 1, PackDeltaResourceChunk, NULL, 1);
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Custom compression type can not be unpacked until its decompressor is registered
+    rresResourceChunk chunk = rresLoadResourceChunk("custom.rres", 1);
+    result = (chunk.info.compType == COMP_DELTA) && (UnpackResourceChunk(&chunk) != 0);
+    rresUnloadResourceChunk(chunk);
+
+    rresCodec codec = { 0 };
+    codec.name = "DELTA";
+    codec.decode = DecodeDelta;
+    codec.capabilities = RRES_CODEC_IN_PLACE;   // No output bound required, data is decoded into packed data buffer
+
+    if (result) result = RegisterDecompressor(COMP_DELTA, codec);
+
+    if (result)
+    {
+        chunk = rresLoadResourceChunk("custom.rres", 1);
+
+        result = (UnpackResourceChunk(&chunk) == 0) && (chunk.info.compType == RRES_COMP_NONE) &&
+                 (chunk.data.props[0] == DATA_SIZE) && (memcmp(chunk.data.raw, data, DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    // Codec with NULL decode callback unregisters custom decompressor
+    RegisterDecompressor(COMP_DELTA, (rresCodec){ 0 });
+
+    return result? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Pack resource chunk callback: delta encoding
+// NOTE: Resource chunk is packed uncompressed (props + raw data) and packed data is encoded afterwards
+static bool PackDeltaResourceChunk(rresPackItem *item, void *userData)
+{
+    int compType = item->info.compType;
+
+    item->info.compType = RRES_COMP_NONE;
+    if (!PackResourceChunk(item, userData)) return false;
+
+    unsigned char *packedData = (unsigned char *)item->packedData;
+    for (unsigned long long i = item->info.packedSize - 1; i > 0; i--) packedData[i] -= packedData[i - 1];
+
+    item->info.compType = compType;
+
+    return true;
+}
+
+// Codec decode callback: delta decoding (in place)
+// NOTE: Decoded data is the uncompressed data layout: propCount + props[] + raw data
+static int DecodeDelta(rresCodecData *data)
+{
+    if (data->output != data->input) return 4;   // Decompression failed
+
+    for (unsigned long long i = 1; i < data->inputSize; i++) data->output[i] += data->output[i - 1];
+    data->outputSize = data->inputSize;
+
+    return 0;
+}
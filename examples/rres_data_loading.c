@@ -97,7 +97,7 @@ int main(void)
                     // List all files contained on central directory
                     for (unsigned int i = 0; i < dir.count; i++)
                     {
-                        TraceLog(LOG_INFO, "RRES: CDIR: File entry %03i: %s | Resource(s) id: 0x%08x | Offset: 0x%08x", i + 1, dir.entries[i].fileName, dir.entries[i].id, dir.entries[i].offset);
+                        TraceLog(LOG_INFO, "RRES: CDIR: File entry %03i: %s | Resource(s) id: 0x%08x | Offset: 0x%08llx", i + 1, dir.entries[i].fileName, dir.entries[i].id, dir.entries[i].offset);
                     
                         // TODO: List contained resource chunks info
                         //rresResourceChunkInfo info = rresGetResourceChunkInfo(droppedFiles.paths[0], dir.entries[i]);
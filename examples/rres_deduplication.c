@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   rres example - rres deduplication
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It writes identical resource chunks data once, duplicated chunks are written as alias chunks
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#include <stdio.h>                    // Required for: FILE, fopen(), fseek(), ftell(), fclose()
+#include <string.h>                   // Required for: memset(), memcmp()
+
+#define CHUNK_COUNT     4             // Resource chunks to write
+#define DATA_SIZE    4096             // Resource chunk raw data size (bytes)
+
+// Write resource chunks into file, deduplication enabled if requested
+static bool WriteFile(const char *fileName, const unsigned char (*data)[DATA_SIZE], bool deduplication)
+{
+    rresWriter *writer = rresOpenWriter(fileName, RRES_FILE_VERSION);
+    if (writer == NULL) return false;
+
+    rresSetWriterDeduplication(writer, deduplication);
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+
+    chunkInfo.type[0] = 'R';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'A';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'W';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'D';         // Resource chunk type (FourCC)
+
+    chunkData.propCount = 1;
+    chunkData.props = props;
+
+    bool result = true;
+
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        chunkInfo.id = i + 1;
+        chunkData.raw = (void *)data[i];
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, DATA_SIZE);
+    }
+
+    return rresCloseWriter(writer) && result;
+}
+
+// Get file size
+static long GetDataFileSize(const char *fileName)
+{
+    long size = 0;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fclose(file);
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Resource chunks data: chunks 1, 2 and 4 are identical
+    static unsigned char data[CHUNK_COUNT][DATA_SIZE] = { 0 };
+    for (int i = 0; i < CHUNK_COUNT; i++) memset(data[i], (i == 2)? 'b' : 'a', DATA_SIZE);
+
+    if (!WriteFile("duplicated.rres", data, false) || !WriteFile("deduplicated.rres", data, true)) return 1;
+
+    // Verify duplicated chunks are written as alias chunks (data stored once)
+    unsigned int chunkCount = 0;
+    unsigned int aliasCount = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll("deduplicated.rres", &chunkCount);
+
+    for (unsigned int i = 0; (infos != NULL) && (i < chunkCount); i++) if ((infos[i].flags & RRES_FLAG_ALIAS) != 0) aliasCount++;
+
+    RRES_FREE(infos);
+
+    bool result = (aliasCount == 2) && ((GetDataFileSize("duplicated.rres") - GetDataFileSize("deduplicated.rres")) >= 2*DATA_SIZE);
+
+    // Load resource chunks back, alias chunks are resolved to the chunk containing the data
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("deduplicated.rres", i + 1);
+        result = (chunk.data.raw != NULL) && (chunk.data.rawSize == DATA_SIZE) && (memcmp(chunk.data.raw, data[i], DATA_SIZE) == 0);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return result? 0 : 1;
+}
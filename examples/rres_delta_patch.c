@@ -0,0 +1,106 @@
+/*******************************************************************************************
+*
+*   rres example - rres delta patch
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It creates a patch with changed resource chunks between two file versions and applies it to base file
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#include <string.h>                   // Required for: memset(), memcmp()
+
+#define CHUNK_COUNT     8             // Resource chunks to write
+#define DATA_SIZE    4096             // Resource chunk raw data size (bytes)
+
+// Write file version: version 2 changes resource chunk 3 and removes resource chunk 6
+static bool WriteFileVersion(const char *fileName, int version, unsigned char (*data)[DATA_SIZE])
+{
+    rresWriter *writer = rresOpenWriter(fileName, RRES_FILE_VERSION);
+    if (writer == NULL) return false;
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+
+    chunkInfo.type[0] = 'R';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'A';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'W';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'D';         // Resource chunk type (FourCC)
+
+    chunkData.propCount = 1;
+    chunkData.props = props;
+
+    bool result = true;
+
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        if ((version == 2) && (i == 6)) continue;
+
+        memset(data[i], 'a' + i + (((version == 2) && (i == 3))? 16 : 0), DATA_SIZE);
+
+        chunkInfo.id = i + 1;
+        chunkData.raw = data[i];
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, DATA_SIZE);
+    }
+
+    return rresCloseWriter(writer) && result;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned char data[CHUNK_COUNT][DATA_SIZE] = { 0 };
+
+    if (!WriteFileVersion("base.rres", 1, data) || !WriteFileVersion("target.rres", 2, data)) return 1;
+
+    // Create patch: only changed resource chunks are stored, unchanged ones are copied from base file
+    // NOTE: Patch can only be applied to the base file it was created from (checksum verified)
+    bool result = rresCreatePatch("base.rres", "target.rres", "update.rres") &&
+                  rresApplyPatch("base.rres", "update.rres", "patched.rres");
+
+    // Verify patched file contains target file resources
+    for (int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("patched.rres", i + 1);
+
+        if (i == 6) result = (chunk.data.raw == NULL);
+        else result = (chunk.data.raw != NULL) && (memcmp(chunk.data.raw, data[i], DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    // Patch is not applied to a different base file
+    if (result) result = !rresApplyPatch("target.rres", "update.rres", "wrong.rres");
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************************
+*
+*   rres example - rres key cache
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It unpacks an encrypted resource chunk multiple times, derived cipher key is cached in unpack context (no key stretching)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <string.h>                   // Required for: strlen(), strcmp()
+#include <time.h>                     // Required for: clock()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    const char *text = "Secret text data, encrypted with a key derived from password (Argon2i)";
+    unsigned int props[4] = { (unsigned int)strlen(text), RRES_TEXT_ENCODING_UNDEFINED, RRES_CODE_LANG_UNDEFINED, 0x0409 };
+
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'T';
+    item.info.type[1] = 'E';
+    item.info.type[2] = 'X';
+    item.info.type[3] = 'T';
+    item.info.id = 1;
+    item.info.cipherType = RRES_CIPHER_XCHACHA20_POLY1305;
+    item.data.propCount = 4;
+    item.data.props = props;
+    item.data.raw = (void *)text;
+    item.data.rawSize = props[0];
+
+    rresPackContext packContext = { 0 };
+    packContext.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("encrypted.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    bool result = rresPackResourceChunks(writer, &item, 1, PackResourceChunk, &packContext, 1);
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Unpack resource chunk multiple times with the same unpack context
+    // NOTE: Key stretching (Argon2i) is only done on first unpack, derived key is cached for chunk salt
+    rresUnpackContext context = LoadUnpackContext("password12345");
+    clock_t unpackTime[2] = { 0 };
+
+    for (int i = 0; result && (i < 2); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("encrypted.rres", 1);
+
+        clock_t start = clock();
+        result = (UnpackResourceChunkEx(&chunk, &context) == 0);
+        unpackTime[i] = clock() - start;
+
+        char *loadedText = result? LoadTextFromResource(chunk) : NULL;
+        if ((loadedText == NULL) || (strcmp(loadedText, text) != 0)) result = false;
+
+        RL_FREE(loadedText);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    if (result) result = (unpackTime[1] < unpackTime[0]);
+
+    // Cached keys are wiped on context flush/unload
+    UnloadUnpackContext(context);
+
+    return result? 0 : 1;
+}
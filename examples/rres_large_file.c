@@ -0,0 +1,99 @@
+/*******************************************************************************************
+*
+*   rres example - rres large file
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It writes more than 65535 resource chunks, only supported by large file version (64bit offsets/sizes)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define CHUNK_COUNT     70000         // Resource chunks to write, more than version 100 maximum (65535)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Open rres file for writing, large file version is required for big files or many chunks
+    rresWriter *writer = rresOpenWriter("large.rres", RRES_FILE_VERSION_LARGE);
+    if (writer == NULL) return 1;
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[1] = { sizeof(unsigned int) };
+    unsigned int value = 0;
+
+    chunkInfo.type[0] = 'R';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'A';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'W';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'D';         // Resource chunk type (FourCC)
+
+    chunkData.propCount = 1;
+    chunkData.props = props;         // props[0]:size (bytes)
+    chunkData.raw = &value;
+
+    bool result = true;
+
+    // Write one small RAWD resource chunk per id, data is the chunk index
+    for (unsigned int i = 0; result && (i < CHUNK_COUNT); i++)
+    {
+        chunkInfo.id = i + 1;
+        value = i;
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, sizeof(unsigned int));
+    }
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Verify chunks count and load some resource chunks back
+    unsigned int chunkCount = 0;
+    rresResourceChunkInfo *infos = rresLoadResourceChunkInfoAll("large.rres", &chunkCount);
+
+    if ((infos == NULL) || (chunkCount != CHUNK_COUNT)) result = false;
+    RRES_FREE(infos);
+
+    rresArchive *archive = rresOpenArchive("large.rres");
+    if (archive == NULL) return 1;
+
+    unsigned int ids[3] = { 1, 65536, CHUNK_COUNT };
+
+    for (int i = 0; result && (i < 3); i++)
+    {
+        rresResourceChunk chunk = rresLoadArchiveResourceChunk(archive, ids[i]);
+
+        result = (chunk.data.raw != NULL) && (chunk.data.rawSize == sizeof(unsigned int)) && (*(unsigned int *)chunk.data.raw == (ids[i] - 1));
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    rresCloseArchive(archive);
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************************
+*
+*   rres example - rres mesh vertex formats
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It loads a mesh with vertex attributes stored as half floats and normalized integers, float positions are adopted by mesh (no copy)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to load rres data chunks as raylib data
+
+#include <string.h>                   // Required for: memcmp()
+
+#define GRID_SIZE       4             // Grid vertices per side
+#define VERTEX_COUNT    (GRID_SIZE*GRID_SIZE)
+#define INDEX_COUNT     ((GRID_SIZE - 1)*(GRID_SIZE - 1)*6)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static float positions[VERTEX_COUNT*3] = { 0 };             // RRES_VERTEX_FORMAT_FLOAT: raylib format
+    static unsigned short normals[VERTEX_COUNT*3] = { 0 };      // RRES_VERTEX_FORMAT_HFLOAT: half floats
+    static unsigned short texcoords[VERTEX_COUNT*2] = { 0 };    // RRES_VERTEX_FORMAT_USHORT: normalized [0..1]
+    static unsigned int indices[INDEX_COUNT] = { 0 };           // RRES_VERTEX_FORMAT_UINT: 16 bit indices required
+
+    // Plane grid on XZ, normals pointing up
+    for (int i = 0; i < VERTEX_COUNT; i++)
+    {
+        int x = i%GRID_SIZE, z = i/GRID_SIZE;
+
+        positions[i*3 + 0] = (float)x;
+        positions[i*3 + 1] = 0.0f;
+        positions[i*3 + 2] = (float)z;
+
+        normals[i*3 + 0] = 0x0000;      // 0.0f
+        normals[i*3 + 1] = 0x3c00;      // 1.0f
+        normals[i*3 + 2] = 0x0000;      // 0.0f
+
+        texcoords[i*2 + 0] = (unsigned short)(x*65535/(GRID_SIZE - 1));
+        texcoords[i*2 + 1] = (unsigned short)(z*65535/(GRID_SIZE - 1));
+    }
+
+    for (int i = 0, k = 0; i < (GRID_SIZE - 1)*(GRID_SIZE - 1); i++)
+    {
+        unsigned int v = (i/(GRID_SIZE - 1))*GRID_SIZE + i%(GRID_SIZE - 1);
+
+        indices[k++] = v;
+        indices[k++] = v + GRID_SIZE;
+        indices[k++] = v + 1;
+        indices[k++] = v + 1;
+        indices[k++] = v + GRID_SIZE;
+        indices[k++] = v + GRID_SIZE + 1;
+    }
+
+    // Vertex attributes: props[0]:vertexCount, props[1]:rresVertexAttribute, props[2]:componentCount, props[3]:rresVertexFormat
+    unsigned int props[4][4] = {
+        { VERTEX_COUNT, RRES_VERTEX_ATTRIBUTE_POSITION, 3, RRES_VERTEX_FORMAT_FLOAT },
+        { VERTEX_COUNT, RRES_VERTEX_ATTRIBUTE_NORMAL, 3, RRES_VERTEX_FORMAT_HFLOAT },
+        { VERTEX_COUNT, RRES_VERTEX_ATTRIBUTE_TEXCOORD1, 2, RRES_VERTEX_FORMAT_USHORT },
+        { INDEX_COUNT, RRES_VERTEX_ATTRIBUTE_INDEX, 1, RRES_VERTEX_FORMAT_UINT }
+    };
+    const void *attributes[4] = { positions, normals, texcoords, indices };
+    unsigned int attributeSizes[4] = { sizeof(positions), sizeof(normals), sizeof(texcoords), sizeof(indices) };
+
+    rresWriter *writer = rresOpenWriter("mesh.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    rresResourceChunkInfo chunkInfo = { 0 };
+    chunkInfo.type[0] = 'V';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'R';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'X';         // Resource chunk type (FourCC)
+    chunkInfo.id = 1;                // All chunks with same id: linked as one multi-chunk resource
+
+    rresResourceChunkData chunkData = { 0 };
+    chunkData.propCount = 4;
+
+    bool result = true;
+
+    for (int i = 0; result && (i < 4); i++)
+    {
+        chunkData.props = props[i];
+        chunkData.raw = (void *)attributes[i];
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, attributeSizes[i]);
+    }
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    rresResourceMulti multi = rresLoadResourceMulti("mesh.rres", 1);
+
+    // Vertex data converted to raylib formats, position data adopted (if allocation is aligned as required)
+    Mesh mesh = LoadMeshFromResourceEx(&multi);
+
+    result = (multi.count == 4) && (mesh.vertexCount == VERTEX_COUNT) && (mesh.triangleCount == INDEX_COUNT/3) &&
+             (mesh.vertices != NULL) && (mesh.normals != NULL) && (mesh.texcoords != NULL) && (mesh.indices != NULL) &&
+             (memcmp(mesh.vertices, positions, sizeof(positions)) == 0);
+
+    // Half float normals and normalized texcoords are converted into new buffers
+    if (result) result = (multi.chunks[1].data.raw != NULL) && (multi.chunks[2].data.raw != NULL);
+
+    for (int i = 0; result && (i < VERTEX_COUNT); i++)
+    {
+        float u = (float)(i%GRID_SIZE)/(GRID_SIZE - 1);
+        float v = (float)(i/GRID_SIZE)/(GRID_SIZE - 1);
+        float du = mesh.texcoords[i*2] - u;
+        float dv = mesh.texcoords[i*2 + 1] - v;
+
+        result = (mesh.normals[i*3] == 0.0f) && (mesh.normals[i*3 + 1] == 1.0f) && (mesh.normals[i*3 + 2] == 0.0f) &&
+                 (du*du < 1e-10f) && (dv*dv < 1e-10f);
+    }
+
+    for (int i = 0; result && (i < INDEX_COUNT); i++) result = (mesh.indices[i] == indices[i]);
+
+    // NOTE: Adopted data is removed from chunks, so both can be unloaded
+    rresUnloadResourceMulti(multi);
+    UnloadMesh(mesh);
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************************
+*
+*   rres example - rres mount archives
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It mounts a base archive and a patch archive, resources in higher priority archives override the base ones
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#include <string.h>                   // Required for: strcmp()
+
+// Write archive with text resources for ids [firstId..lastId]
+static bool WriteArchive(const char *fileName, const char *text, int firstId, int lastId)
+{
+    rresWriter *writer = rresOpenWriter(fileName, RRES_FILE_VERSION);
+    if (writer == NULL) return false;
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[4] = { 0 };              // Chunk properties
+
+    chunkInfo.type[0] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'E';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'X';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'T';         // Resource chunk type (FourCC)
+
+    props[0] = (unsigned int)strlen(text) + 1;  // props[0]:size (bytes), NULL terminator included
+
+    chunkData.propCount = 4;
+    chunkData.props = props;
+    chunkData.raw = (void *)text;
+
+    bool result = true;
+
+    for (int id = firstId; result && (id <= lastId); id++)
+    {
+        chunkInfo.id = id;
+        result = rresWriteResourceChunk(writer, chunkInfo, chunkData, props[0]);
+    }
+
+    return rresCloseWriter(writer) && result;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Base archive provides resources [1..4], patch archive overrides resources [3..5]
+    if (!WriteArchive("base_data.rres", "base", 1, 4) || !WriteArchive("patch_data.rres", "patch", 3, 5)) return 1;
+
+    rresArchive *base = rresOpenArchive("base_data.rres");
+    rresArchive *patch = rresOpenArchive("patch_data.rres");
+    rresMountSet *set = rresLoadMountSet();
+
+    // Mount archives: priority defines resources override, not mount order
+    bool result = (base != NULL) && (patch != NULL) && (set != NULL) &&
+                  rresMountArchive(set, patch, 1) && rresMountArchive(set, base, 0);
+
+    const char *expected[5] = { "base", "base", "patch", "patch", "patch" };
+
+    for (int i = 0; result && (i < 5); i++)
+    {
+        rresResourceChunk chunk = rresLoadMountedResourceChunk(set, i + 1);
+        result = (chunk.data.raw != NULL) && (strcmp((const char *)chunk.data.raw, expected[i]) == 0);
+        rresUnloadResourceChunk(chunk);
+    }
+
+    // Unmount patch archive: base resources are provided again, patch only resources are not available
+    if (result) result = rresUnmountArchive(set, patch) && (rresGetMountedArchive(set, 3) == base) && (rresGetMountedArchive(set, 5) == NULL);
+
+    // NOTE: Mount set does not close mounted archives
+    rresUnloadMountSet(set);
+    rresCloseArchive(base);
+    rresCloseArchive(patch);
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************************
+*
+*   rres example - rres parallel pack
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs resource chunks with multiple threads, written file is identical to single thread packing
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#define RRES_SUPPORT_THREADS
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <stdio.h>                    // Required for: FILE, fopen(), fgetc(), fclose()
+#include <string.h>                   // Required for: memcmp()
+
+#define ITEM_COUNT      16            // Resource chunks to pack
+#define DATA_SIZE   100000            // Resource chunk raw data size (bytes)
+
+// Pack resource chunks into file using provided threads
+static bool PackFile(const char *fileName, rresPackItem *items, unsigned int threadCount)
+{
+    // NOTE: Seed is fixed so packed data does not depend on packing order
+    rresPackContext context = { 0 };
+    context.password = "password12345";
+    for (int i = 0; i < 32; i++) context.seed[i] = (unsigned char)i;
+
+    rresWriter *writer = rresOpenWriter(fileName, RRES_FILE_VERSION);
+    if (writer == NULL) return false;
+
+    bool result = rresPackResourceChunks(writer, items, ITEM_COUNT, PackResourceChunk, &context, threadCount);
+
+    return rresCloseWriter(writer) && result;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned char data[ITEM_COUNT][DATA_SIZE] = { 0 };
+    static unsigned int props[ITEM_COUNT][1] = { 0 };
+    rresPackItem items[ITEM_COUNT] = { 0 };
+
+    // Generate resource chunks: LZ4 compressed, half of them encrypted (XChaCha20-Poly1305)
+    for (int i = 0; i < ITEM_COUNT; i++)
+    {
+        for (int k = 0; k < DATA_SIZE; k++) data[i][k] = (unsigned char)((k/64)*i + (k%7));
+        props[i][0] = DATA_SIZE;                    // props[0]:size (bytes)
+
+        items[i].info.type[0] = 'R';
+        items[i].info.type[1] = 'A';
+        items[i].info.type[2] = 'W';
+        items[i].info.type[3] = 'D';
+        items[i].info.id = i + 1;
+        items[i].info.compType = RRES_COMP_LZ4;
+        items[i].info.cipherType = (i%2 == 0)? RRES_CIPHER_XCHACHA20_POLY1305 : RRES_CIPHER_NONE;
+        items[i].data.propCount = 1;
+        items[i].data.props = props[i];
+        items[i].data.raw = data[i];
+        items[i].data.rawSize = DATA_SIZE;
+    }
+
+    // Pack same resource chunks with 1 and 4 threads, chunks are written in items order
+    if (!PackFile("packed1.rres", items, 1) || !PackFile("packed4.rres", items, 4)) return 1;
+
+    bool result = true;
+
+    // Compare written files
+    FILE *file1 = fopen("packed1.rres", "rb");
+    FILE *file4 = fopen("packed4.rres", "rb");
+
+    if ((file1 != NULL) && (file4 != NULL))
+    {
+        int c1 = 0, c4 = 0;
+        do { c1 = fgetc(file1); c4 = fgetc(file4); } while ((c1 == c4) && (c1 != EOF));
+        if (c1 != c4) result = false;
+    }
+    else result = false;
+
+    if (file1 != NULL) fclose(file1);
+    if (file4 != NULL) fclose(file4);
+
+    // Load resource chunks back and unpack them
+    rresSetCipherPassword("password12345");
+
+    for (int i = 0; result && (i < ITEM_COUNT); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("packed4.rres", i + 1);
+
+        result = (UnpackResourceChunk(&chunk) == 0) && (chunk.data.rawSize == DATA_SIZE) && (memcmp(chunk.data.raw, data[i], DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return result? 0 : 1;
+}
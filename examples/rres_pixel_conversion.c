@@ -0,0 +1,160 @@
+/*******************************************************************************************
+*
+*   rres example - rres pixel conversion
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It loads images stored as R5G6B5 and grayscale converted to RGBA8 and BGRA8 while loading (no intermediate copy)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to load rres data chunks as raylib data
+
+#define IMAGE_WIDTH     64            // Image width (pixels)
+#define IMAGE_HEIGHT    32            // Image height (pixels)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static bool CheckImagePixels(Image image, const unsigned char *colors, bool bgra); // Check image pixels (RGBA8/BGRA8), colors expected per row
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    static unsigned short pixels565[IMAGE_WIDTH*IMAGE_HEIGHT] = { 0 };
+    static unsigned char pixelsGray[IMAGE_WIDTH*IMAGE_HEIGHT] = { 0 };
+    static unsigned char colors565[IMAGE_HEIGHT][4] = { 0 };    // Expected color per row (RGBA)
+    static unsigned char colorsGray[IMAGE_HEIGHT][4] = { 0 };   // Expected color per row (RGBA)
+
+    // Rows in red, green, blue and white, 5/6 bits channels expanded to 8 bits (bit replication)
+    const unsigned short values565[4] = { 0xf800, 0x07e0, 0x001f, 0xffff };
+    const unsigned char expected565[4][4] = { { 255, 0, 0, 255 }, { 0, 255, 0, 255 }, { 0, 0, 255, 255 }, { 255, 255, 255, 255 } };
+
+    for (int y = 0; y < IMAGE_HEIGHT; y++)
+    {
+        for (int x = 0; x < IMAGE_WIDTH; x++)
+        {
+            pixels565[y*IMAGE_WIDTH + x] = values565[y%4];
+            pixelsGray[y*IMAGE_WIDTH + x] = (unsigned char)(y*8);
+        }
+
+        for (int c = 0; c < 4; c++) colors565[y][c] = expected565[y%4][c];
+        colorsGray[y][0] = colorsGray[y][1] = colorsGray[y][2] = (unsigned char)(y*8);
+        colorsGray[y][3] = 255;
+    }
+
+    rresWriter *writer = rresOpenWriter("pixels.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    rresResourceChunkInfo chunkInfo = { 0 };
+    chunkInfo.type[0] = 'I';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'M';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'G';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'E';         // Resource chunk type (FourCC)
+
+    // props[0]:width, props[1]:height, props[2]:rresPixelFormat, props[3]:mipmaps
+    unsigned int props565[4] = { IMAGE_WIDTH, IMAGE_HEIGHT, RRES_PIXELFORMAT_UNCOMP_R5G6B5, 1 };
+    unsigned int propsGray[4] = { IMAGE_WIDTH, IMAGE_HEIGHT, RRES_PIXELFORMAT_UNCOMP_GRAYSCALE, 1 };
+
+    rresResourceChunkData chunkData = { 0 };
+    chunkData.propCount = 4;
+
+    chunkInfo.id = 1;
+    chunkData.props = props565;
+    chunkData.raw = pixels565;
+    bool result = rresWriteResourceChunk(writer, chunkInfo, chunkData, sizeof(pixels565));
+
+    chunkInfo.id = 2;
+    chunkData.props = propsGray;
+    chunkData.raw = pixelsGray;
+    if (result) result = rresWriteResourceChunk(writer, chunkInfo, chunkData, sizeof(pixelsGray));
+
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    for (int id = 1; result && (id <= 2); id++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("pixels.rres", id);
+        const unsigned char *colors = (id == 1)? &colors565[0][0] : &colorsGray[0][0];
+
+        // Pixels converted while copied into image data
+        Image image = LoadImageFromResourceEx(chunk, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        result = CheckImagePixels(image, colors, false);
+        UnloadImage(image);
+
+        // Red and blue channels swapped, image.format is PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+        if (result)
+        {
+            image = LoadImageFromResourceEx(chunk, RRES_IMAGE_FORMAT_B8G8R8A8);
+            result = CheckImagePixels(image, colors, true);
+            UnloadImage(image);
+        }
+
+        // Stored pixel format kept
+        if (result)
+        {
+            image = LoadImageFromResourceEx(chunk, 0);
+            result = (image.data != NULL) && (image.format == ((id == 1)? PIXELFORMAT_UNCOMPRESSED_R5G6B5 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
+            UnloadImage(image);
+        }
+
+        rresUnloadResourceChunk(chunk);
+    }
+
+    return result? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Check image pixels (RGBA8/BGRA8), colors expected per row
+static bool CheckImagePixels(Image image, const unsigned char *colors, bool bgra)
+{
+    if ((image.data == NULL) || (image.width != IMAGE_WIDTH) || (image.height != IMAGE_HEIGHT) ||
+        (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return false;
+
+    const unsigned char *pixels = (const unsigned char *)image.data;
+
+    for (int i = 0; i < IMAGE_WIDTH*IMAGE_HEIGHT; i++)
+    {
+        const unsigned char *pixel = pixels + i*4;
+        const unsigned char *color = colors + (i/IMAGE_WIDTH)*4;
+
+        if ((pixel[0] != color[bgra? 2 : 0]) || (pixel[1] != color[1]) ||
+            (pixel[2] != color[bgra? 0 : 2]) || (pixel[3] != color[3])) return false;
+    }
+
+    return true;
+}
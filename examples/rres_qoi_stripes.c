@@ -0,0 +1,120 @@
+/*******************************************************************************************
+*
+*   rres example - rres QOI image stripes
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs a big image QOI compressed in independent stripes, stripes are decoded in parallel while unpacking
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#define RRES_SUPPORT_THREADS
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to pack, unpack and load rres data chunks
+
+#include <stdlib.h>                   // Required for: malloc(), free()
+#include <string.h>                   // Required for: memcmp()
+
+#define IMAGE_WIDTH    2048           // Image width (pixels)
+#define IMAGE_HEIGHT   1024           // Image height (pixels), several stripes
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    unsigned int dataSize = IMAGE_WIDTH*IMAGE_HEIGHT*4;
+    unsigned char *pixels = (unsigned char *)malloc(dataSize);
+    if (pixels == NULL) return 1;
+
+    // Image with smooth gradients and some noise
+    for (int i = 0; i < IMAGE_WIDTH*IMAGE_HEIGHT; i++)
+    {
+        int x = i%IMAGE_WIDTH, y = i/IMAGE_WIDTH;
+
+        pixels[i*4 + 0] = (unsigned char)(x/8);
+        pixels[i*4 + 1] = (unsigned char)(y/4);
+        pixels[i*4 + 2] = ((x*7 + y*13)%61 == 0)? (unsigned char)(x*y) : 128;
+        pixels[i*4 + 3] = 255;
+    }
+
+    // props[0]:width, props[1]:height, props[2]:rresPixelFormat, props[3]:mipmaps
+    unsigned int props[4] = { IMAGE_WIDTH, IMAGE_HEIGHT, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'I';
+    item.info.type[1] = 'M';
+    item.info.type[2] = 'G';
+    item.info.type[3] = 'E';
+    item.info.id = 1;
+    item.info.compType = RRES_COMP_QOI;
+    item.info.flags = RRES_FLAG_INDEPENDENT_BLOCKS;     // Image encoded in stripes of whole rows
+    item.data.propCount = 4;
+    item.data.props = props;
+    item.data.raw = pixels;
+    item.data.rawSize = dataSize;
+
+    rresWriter *writer = rresOpenWriter("qoi.rres", RRES_FILE_VERSION);
+    if (writer == NULL) { free(pixels); return 1; }
+
+    bool result = rresPackResourceChunks(writer, &item, 1, PackResourceChunk, NULL, 1);
+    if (!rresCloseWriter(writer)) result = false;
+
+    for (int threadCount = 1; result && (threadCount <= 4); threadCount += 3)
+    {
+        rresUnpackContext context = LoadUnpackContext(NULL);
+        context.threadCount = threadCount;
+
+        rresResourceChunk chunk = rresLoadResourceChunk("qoi.rres", 1);
+
+        result = (chunk.info.compType == RRES_COMP_QOI) && ((chunk.info.flags & RRES_FLAG_INDEPENDENT_BLOCKS) != 0) &&
+                 (chunk.info.packedSize < dataSize) && (UnpackResourceChunkEx(&chunk, &context) == 0);
+
+        if (result)
+        {
+            Image image = LoadImageFromResource(chunk);
+
+            result = (image.data != NULL) && (image.width == IMAGE_WIDTH) && (image.height == IMAGE_HEIGHT) &&
+                     (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (memcmp(image.data, pixels, dataSize) == 0);
+
+            UnloadImage(image);
+        }
+
+        rresUnloadResourceChunk(chunk);
+        UnloadUnpackContext(context);
+    }
+
+    free(pixels);
+
+    return result? 0 : 1;
+}
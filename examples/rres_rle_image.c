@@ -0,0 +1,112 @@
+/*******************************************************************************************
+*
+*   rres example - rres RLE image
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It packs an image with large flat color areas RLE compressed (pixel size runs), image is loaded after unpacking
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#include "../src/rres-raylib.h"       // Required to pack, unpack and load rres data chunks
+
+#include <string.h>                   // Required for: memcmp()
+
+#define IMAGE_WIDTH     256           // Image width (pixels)
+#define IMAGE_HEIGHT    256           // Image height (pixels)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Image with flat color areas (i.e. UI sprites, tiles)
+    static unsigned char pixels[IMAGE_WIDTH*IMAGE_HEIGHT*4] = { 0 };
+
+    for (int y = 0; y < IMAGE_HEIGHT; y++)
+    {
+        for (int x = 0; x < IMAGE_WIDTH; x++)
+        {
+            unsigned char *pixel = pixels + (y*IMAGE_WIDTH + x)*4;
+            bool border = (x < 8) || (y < 8) || (x >= IMAGE_WIDTH - 8) || (y >= IMAGE_HEIGHT - 8);
+
+            pixel[0] = border? 40 : 200;
+            pixel[1] = border? 40 : (unsigned char)(100 + (y/32)*10);
+            pixel[2] = border? 80 : 60;
+            pixel[3] = 255;
+        }
+    }
+
+    // props[0]:width, props[1]:height, props[2]:rresPixelFormat, props[3]:mipmaps
+    unsigned int props[4] = { IMAGE_WIDTH, IMAGE_HEIGHT, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'I';
+    item.info.type[1] = 'M';
+    item.info.type[2] = 'G';
+    item.info.type[3] = 'E';
+    item.info.id = 1;
+    item.info.compType = RRES_COMP_RLE;     // Runs of pixels (4 bytes) are compressed
+    item.data.propCount = 4;
+    item.data.props = props;
+    item.data.raw = pixels;
+    item.data.rawSize = sizeof(pixels);
+
+    rresWriter *writer = rresOpenWriter("rle.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    bool result = rresPackResourceChunks(writer, &item, 1, PackResourceChunk, NULL, 1);
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    rresResourceChunk chunk = rresLoadResourceChunk("rle.rres", 1);
+
+    // Flat color areas are stored as a few runs
+    result = (chunk.info.compType == RRES_COMP_RLE) && (chunk.info.packedSize < sizeof(pixels)/16);
+
+    if (result) result = (UnpackResourceChunk(&chunk) == 0);
+
+    if (result)
+    {
+        Image image = LoadImageFromResource(chunk);
+
+        result = (image.data != NULL) && (image.width == IMAGE_WIDTH) && (image.height == IMAGE_HEIGHT) &&
+                 (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (memcmp(image.data, pixels, sizeof(pixels)) == 0);
+
+        UnloadImage(image);
+    }
+
+    rresUnloadResourceChunk(chunk);
+
+    return result? 0 : 1;
+}
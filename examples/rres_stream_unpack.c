@@ -0,0 +1,126 @@
+/*******************************************************************************************
+*
+*   rres example - rres stream unpack
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It unpacks a big resource chunk progressively from archive (LZ4 stream blocks, AES-GCM), no packed data copy is loaded
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_ENCRYPTION_AES
+#include "../src/rres-raylib.h"       // Required to pack and unpack rres data chunks
+
+#include <stdlib.h>                   // Required for: malloc(), free()
+#include <string.h>                   // Required for: memcmp()
+
+#define DATA_SIZE   (4*1024*1024 + 17)  // Resource chunk raw data size (bytes), several stream blocks
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    unsigned char *data = (unsigned char *)malloc(DATA_SIZE);
+    if (data == NULL) return 1;
+    for (int i = 0; i < DATA_SIZE; i++) data[i] = (unsigned char)((i%1000 < 500)? i/7 : i*13 + i/3);
+
+    unsigned int props[1] = { DATA_SIZE };      // props[0]:size (bytes)
+
+    // Pack resource chunk: LZ4 compressed in independent stream blocks and encrypted
+    rresPackItem item = { 0 };
+    item.info.type[0] = 'R';
+    item.info.type[1] = 'A';
+    item.info.type[2] = 'W';
+    item.info.type[3] = 'D';
+    item.info.id = 1;
+    item.info.compType = RRES_COMP_LZ4;
+    item.info.cipherType = RRES_CIPHER_AES_GCM;
+    item.info.flags = RRES_FLAG_STREAM_BLOCKS;
+    item.data.propCount = 1;
+    item.data.props = props;
+    item.data.raw = data;
+    item.data.rawSize = DATA_SIZE;
+
+    rresPackContext packContext = { 0 };
+    packContext.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("stream.rres", RRES_FILE_VERSION);
+    if (writer == NULL) { free(data); return 1; }
+
+    bool result = rresPackResourceChunks(writer, &item, 1, PackResourceChunk, &packContext, 1);
+    if (!rresCloseWriter(writer)) result = false;
+
+    rresArchive *archive = result? rresOpenArchive("stream.rres") : NULL;
+
+    if (archive != NULL)
+    {
+        rresUnpackContext context = LoadUnpackContext("password12345");
+
+        // Unpack resource chunk progressively: blocks are read, decrypted and decompressed one by one
+        rresResourceChunk chunk = { 0 };
+        result = (UnpackResourceChunkStream(archive, 1, &context, &chunk) == 0) &&
+                 (chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE) &&
+                 (chunk.data.props[0] == DATA_SIZE) && (memcmp(chunk.data.raw, data, DATA_SIZE) == 0);
+
+        rresUnloadResourceChunk(chunk);
+
+        // Same resource chunk unpacked from full packed data copy
+        if (result)
+        {
+            chunk = rresLoadArchiveResourceChunk(archive, 1);
+            result = (UnpackResourceChunkEx(&chunk, &context) == 0) && (memcmp(chunk.data.raw, data, DATA_SIZE) == 0);
+            rresUnloadResourceChunk(chunk);
+        }
+
+        UnloadUnpackContext(context);
+
+        // Wrong password: no data is provided
+        if (result)
+        {
+            context = LoadUnpackContext("password");
+            chunk = (rresResourceChunk){ 0 };
+            result = (UnpackResourceChunkStream(archive, 1, &context, &chunk) != 0) && (chunk.data.raw == NULL);
+            UnloadUnpackContext(context);
+        }
+
+        rresCloseArchive(archive);
+    }
+    else result = false;
+
+    free(data);
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************************
+*
+*   rres example - rres streaming writer
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It writes a resource chunk in several pieces and a multi-chunk resource, then loads them back
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#include <string.h>                   // Required for: strlen(), memcmp()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    const char *lines[3] = { "First line of text data\n", "Second line of text data\n", "Third line of text data\n" };
+    char text[128] = { 0 };
+    for (int i = 0; i < 3; i++) strcat(text, lines[i]);
+    unsigned int textSize = (unsigned int)strlen(text);
+
+    rresWriter *writer = rresOpenWriter("streamed.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    unsigned int props[4] = { 0 };              // Chunk properties
+
+    chunkInfo.type[0] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'E';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'X';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.id = rresComputeCRC32((unsigned char *)"resources/text_data.txt", (int)strlen("resources/text_data.txt"));
+
+    props[0] = textSize;             // props[0]:size (bytes)
+    props[1] = RRES_TEXT_ENCODING_UNDEFINED;  // props[1]:rresTextEncoding
+    props[2] = RRES_CODE_LANG_UNDEFINED;      // props[2]:rresCodeLang
+    props[3] = 0x0409;               // props[3]:cultureCode: en-US: English - United States
+
+    // Write text resource chunk data in several pieces (data is not buffered)
+    // NOTE: Chunk info sizes and CRC32 are written on chunk end
+    //---------------------------------------------------------------------------------
+    bool result = rresBeginResourceChunk(writer, chunkInfo, 4, props);
+    for (int i = 0; result && (i < 3); i++) result = rresWriteResourceChunkData(writer, lines[i], strlen(lines[i]));
+    if (result) result = rresEndResourceChunk(writer);
+    if (result) result = rresAddCentralDirEntry(writer, chunkInfo.id, "resources/text_data.txt");
+    //---------------------------------------------------------------------------------
+
+    // Write multi-chunk resource: consecutive chunks with the same id are linked (nextOffset)
+    //---------------------------------------------------------------------------------
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int rawProps[4] = { 0 };
+    rawProps[0] = textSize;
+
+    chunkInfo.type[0] = 'R';
+    chunkInfo.type[1] = 'A';
+    chunkInfo.type[2] = 'W';
+    chunkInfo.type[3] = 'D';
+    chunkInfo.id = 0x12345678;
+
+    chunkData.propCount = 4;
+    chunkData.props = rawProps;
+    chunkData.raw = text;
+
+    for (int i = 0; result && (i < 2); i++) result = rresWriteResourceChunk(writer, chunkInfo, chunkData, textSize);
+    //---------------------------------------------------------------------------------
+
+    // Close rres file writer: central directory and file header are written
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Load resources back and verify data
+    rresCentralDir dir = rresLoadCentralDirectory("streamed.rres");
+    rresResourceChunk chunk = rresLoadResourceChunk("streamed.rres", rresGetResourceId(dir, "resources/text_data.txt"));
+
+    if ((chunk.data.propCount != 4) || (chunk.data.props[0] != textSize) || (chunk.data.rawSize != textSize) ||
+        (memcmp(chunk.data.raw, text, textSize) != 0)) result = false;
+
+    rresUnloadResourceChunk(chunk);
+    rresUnloadCentralDirectory(dir);
+
+    rresResourceMulti multi = rresLoadResourceMulti("streamed.rres", 0x12345678);
+
+    if (multi.count != 2) result = false;
+    for (unsigned int i = 0; result && (i < multi.count); i++) result = (memcmp(multi.chunks[i].data.raw, text, textSize) == 0);
+
+    rresUnloadResourceMulti(multi);
+
+    return result? 0 : 1;
+}
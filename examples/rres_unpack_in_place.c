@@ -0,0 +1,115 @@
+/*******************************************************************************************
+*
+*   rres example - rres unpack in place
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*   This example uses raylib (www.raylib.com) data structures to load resources
+*
+*   NOTE: It unpacks compressed/encrypted resource chunks, props and raw data point into the unpacked data buffer (no copies)
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to write and read rres data chunks
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#define RRES_SUPPORT_ENCRYPTION_XCHACHA20
+#include "../src/rres-raylib.h"       // Required to pack, unpack and map rres data chunks into raylib structs
+
+#include <stdint.h>                   // Required for: uintptr_t
+#include <string.h>                   // Required for: memcmp()
+
+#define IMAGE_SIZE      64            // Image width and height (pixels)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Generate image pixel data: RRES_PIXELFORMAT_UNCOMP_R8G8B8A8
+    static unsigned char pixels[IMAGE_SIZE*IMAGE_SIZE*4] = { 0 };
+    for (int i = 0; i < IMAGE_SIZE*IMAGE_SIZE*4; i++) pixels[i] = (unsigned char)((i%4 == 3)? 255 : (i/256)*13);
+
+    unsigned int props[4] = { IMAGE_SIZE, IMAGE_SIZE, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+    rresPackItem items[2] = { 0 };
+
+    // Pack images: LZ4 compressed (id: 1) and LZ4 compressed + XChaCha20-Poly1305 encrypted (id: 2)
+    for (int i = 0; i < 2; i++)
+    {
+        items[i].info.type[0] = 'I';
+        items[i].info.type[1] = 'M';
+        items[i].info.type[2] = 'G';
+        items[i].info.type[3] = 'E';
+        items[i].info.id = i + 1;
+        items[i].info.compType = RRES_COMP_LZ4;
+        items[i].info.cipherType = (i == 1)? RRES_CIPHER_XCHACHA20_POLY1305 : RRES_CIPHER_NONE;
+        items[i].data.propCount = 4;
+        items[i].data.props = props;
+        items[i].data.raw = pixels;
+        items[i].data.rawSize = sizeof(pixels);
+    }
+
+    rresPackContext context = { 0 };
+    context.password = "password12345";
+
+    rresWriter *writer = rresOpenWriter("packed.rres", RRES_FILE_VERSION);
+    if (writer == NULL) return 1;
+
+    bool result = rresPackResourceChunks(writer, items, 2, PackResourceChunk, &context, 1);
+    if (!rresCloseWriter(writer) || !result) return 1;
+
+    // Unpack resource chunks
+    // NOTE: Data is decrypted in place and decompressed once into the unpacked data buffer,
+    // chunk props and raw data point into that buffer, raw data is aligned (RRES_DATA_ALIGNMENT)
+    rresSetCipherPassword("password12345");
+
+    for (int i = 0; result && (i < 2); i++)
+    {
+        rresResourceChunk chunk = rresLoadResourceChunk("packed.rres", i + 1);
+
+        if (UnpackResourceChunk(&chunk) == 0)
+        {
+            unsigned char *buffer = (unsigned char *)chunk.data.buffer;
+
+            result = (buffer != NULL) && (chunk.data.propCount == 4) &&
+                     ((unsigned char *)chunk.data.props > buffer) && ((unsigned char *)chunk.data.raw > (unsigned char *)chunk.data.props) &&
+                     (((uintptr_t)chunk.data.raw%RRES_DATA_ALIGNMENT) == 0) && (chunk.data.rawSize == sizeof(pixels));
+
+            Image image = LoadImageFromResource(chunk);
+            if ((image.data == NULL) || (memcmp(image.data, pixels, sizeof(pixels)) != 0)) result = false;
+            UnloadImage(image);
+        }
+        else result = false;
+
+        rresUnloadResourceChunk(chunk);     // Unpacked data buffer is freed
+    }
+
+    return result? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************************
+*
+*   rres example - rres update file
+*
+*   This example has been created using rres 1.1 (github.com/raysan5/rres)
+*
+*   NOTE: It updates the file generated by rres_create_file example
+*
+*
+*   LICENSE: MIT
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   Permission is hereby granted, free of charge, to any person obtaining a copy
+*   of this software and associated documentation files (the "Software"), to deal
+*   in the Software without restriction, including without limitation the rights
+*   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*   copies of the Software, and to permit persons to whom the Software is
+*   furnished to do so, subject to the following conditions:
+*
+*   The above copyright notice and this permission notice shall be included in all
+*   copies or substantial portions of the Software.
+*
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*   SOFTWARE.
+*
+**********************************************************************************************/
+
+#define RRES_IMPLEMENTATION
+#include "../src/rres.h"              // Required to update rres file
+
+#include <string.h>                   // Required for: strlen()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Open existing rres file for appending
+    // NOTE: New resource chunks are written at file end, existing chunks with the same id
+    // are marked as dead and central directory and file header are updated on writer close
+    rresWriter *writer = rresOpenWriterAppend("myresources.rres");
+    
+    if (writer == NULL) return 1;
+    
+    rresResourceChunkInfo chunkInfo = { 0 };    // Chunk info
+    rresResourceChunkData chunkData = { 0 };    // Chunk data
+    unsigned int props[4] = { 0 };              // Chunk properties
+    
+    // Update text file: TEXT resource chunk is replaced
+    //---------------------------------------------------------------------------------
+    const char *text = "Updated text data, only this resource chunk is written";
+    unsigned int rawSize = strlen(text);
+    
+    chunkInfo.type[0] = 'T';         // Resource chunk type (FourCC)
+    chunkInfo.type[1] = 'E';         // Resource chunk type (FourCC)
+    chunkInfo.type[2] = 'X';         // Resource chunk type (FourCC)
+    chunkInfo.type[3] = 'T';         // Resource chunk type (FourCC)
+    
+    // Resource chunk identifier, same id than the resource chunk to replace
+    chunkInfo.id = rresComputeCRC32("resources/text_data.txt", strlen("resources/text_data.txt"));
+    
+    props[0] = rawSize;              // props[0]:size (bytes)
+    props[1] = RRES_TEXT_ENCODING_UNDEFINED;  // props[1]:rresTextEncoding
+    props[2] = RRES_CODE_LANG_UNDEFINED;      // props[2]:rresCodeLang
+    props[3] = 0x0409;               // props[3]:cultureCode: en-US: English - United States
+    chunkData.propCount = 4;
+    chunkData.props = props;
+    chunkData.raw = (void *)text;
+    
+    rresWriteResourceChunk(writer, chunkInfo, chunkData, rawSize);
+    //---------------------------------------------------------------------------------
+    
+    // Remove sound file: WAVE resource chunk is marked as dead and its central directory entry removed
+    rresRemoveResource(writer, rresComputeCRC32("resources/audio/coin.wav", strlen("resources/audio/coin.wav")));
+    
+    // Close rres file writer: new central directory and file header are written
+    if (!rresCloseWriter(writer)) return 1;
+    
+    // Compact rres file: dead resource chunks are discarded, space is reclaimed
+    // NOTE: Compaction writes a new file, it can be done at any time after multiple updates
+    bool result = rresCompactFile("myresources.rres", "myresources_compact.rres");
+
+    return result? 0 : 1;
+}
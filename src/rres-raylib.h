@@ -1,6 +1,6 @@
 /**********************************************************************************************
 *
-*   rres-raylib v1.2 - rres loaders specific for raylib data structures
+*   rres-raylib v1.3 - rres loaders specific for raylib data structures
 *
 *   CONFIGURATION:
 *
@@ -14,22 +14,46 @@
 *
 *   #define RRES_SUPPORT_ENCRYPTION_AES
 *       Support data encryption algorithm AES, provided by aes.h/aes.c library
+*       NOTE: AES-256 CTR is hardware accelerated when supported by CPU (x86 AES-NI checked on runtime,
+*       ARMv8 Crypto Extensions if enabled on compilation), aes.h/aes.c is used as fallback
+*       AES-256 GCM is also supported (authenticated encryption), GHASH uses x86 PCLMULQDQ if available
 *
 *   #define RRES_SUPPORT_ENCRYPTION_XCHACHA20
 *       Support data encryption algorithm XChaCha20-Poly1305,
 *       provided by monocypher.h/monocypher.c library
 *
+*   NOTE: Encryption algorithms require monocypher.h/monocypher.c library for key derivation (Argon2i)
+*   NOTE: Additional compression/encryption algorithms can be registered on runtime as codecs,
+*   with RegisterDecompressor() and RegisterDecryptor(), no library changes required
+*
 *   DEPENDENCIES:
 *
 *     - raylib.h: Data types definition and data loading from memory functions
 *                 WARNING: raylib.h MUST be included before including rres-raylib.h
 *     - rres.h:   Base implementation of rres specs, required to read rres files and resource chunks
 *     - lz4.h:    LZ4 compression support (optional)
-*     - aes.h:    AES-256 CTR encryption support (optional)
+*     - aes.h:    AES-256 CTR/GCM encryption support (optional)
 *     - monocypher.h: for XChaCha20-Poly1305 encryption support (optional) 
+*     - windows.h: Memory locking for derived cipher keys cache on Windows, only if encryption is supported (GDI and USER APIs excluded)
 *
 *   VERSION HISTORY:
 *
+*     - 1.3 (19-Oct-2026): Unpacked resource chunks cache loading (LoadResourceChunkCached())
+*                          Unpack context (UnpackResourceChunkEx()), resource chunks unpacked from multiple threads
+*                          Resource chunks packing callback: compression and encryption (PackResourceChunk())
+*                          Resource chunks unpacked without redundant copies, data decrypted/decompressed in place when possible
+*                          Derived cipher keys cache per unpack context (locked memory)
+*                          Archive cipher key support (WriteArchiveCipherKey(), LoadArchiveCipherKey())
+*                          AES-256-CTR decryption hardware accelerated (AES-NI/ARMv8) and multi-threaded
+*                          AES-256-GCM cipher (RRES_CIPHER_AES_GCM), single-pass authenticated decryption
+*                          Progressive unpacking with bounded memory (UnpackResourceChunkStream())
+*                          LZ4 independent blocks, parallel and partial unpacking (UnpackResourceChunkRange())
+*                          Archive compression dictionary (WriteArchiveDictionary(), LoadArchiveDictionary())
+*                          Runtime codec registry (RegisterDecompressor(), RegisterDecryptor())
+*                          RLE compression (RRES_COMP_RLE), SIMD runs expansion
+*                          QOI images decoded straight into unpacked data, independent stripes decoded in parallel
+*                          Pixel format conversion on image loading (LoadImageFromResourceEx())
+*                          Vertex format conversion and data adoption on mesh loading (LoadMeshFromResourceEx())
 *     - 1.2 (15-Apr-2023): Updated to monocypher 4.0.1
 *     - 1.0 (11-May-2022): Initial implementation release
 *
@@ -68,12 +92,76 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+// rres codec capabilities
+#define RRES_CODEC_IN_PLACE     0x01    // Data is decoded in place: output is input data buffer (output size <= input size)
+#define RRES_CODEC_STREAMING    0x02    // Data is decoded progressively while it's read (UnpackResourceChunkStream()), built-in codecs only
+#define RRES_CODEC_PARTIAL      0x04    // Raw data ranges are decoded without decoding all data (UnpackResourceChunkRange()), built-in codecs only
+
+// Image target pixel format, not available in raylib PixelFormat
+// NOTE: Image data is RGBA8 with red and blue channels swapped, image.format is PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+#define RRES_IMAGE_FORMAT_B8G8R8A8  100 // LoadImageFromResourceEx(): Pixels stored as BGRA8 (renderers requiring BGRA)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// rres unpack context
+// NOTE: Context keeps the cipher password, the derived cipher keys and the scratch memory required to unpack data,
+// every thread should use its own context to unpack resource chunks concurrently
+typedef struct rresUnpackContext {
+    const char *password;           // Cipher password, it's up to the user to manage that sensible data properly
+    void *workArea;                 // Key stretching work area (Argon2i), allocated on first use and reused
+    void *keyCache;                 // Derived cipher keys cache (locked memory), allocated on first use
+    unsigned int threadCount;       // Threads used to unpack big chunks (AES CTR, LZ4 independent blocks), calling thread is one of them
+    void *dictionary;               // Archive compression dictionary (DICT), loaded with LoadArchiveDictionary()
+} rresUnpackContext;
+
+// rres pack context
+// NOTE: Encryption salt and nonce are derived from seed and chunk data, so packing the same input
+// with the same seed produces the same output (independently of the threads used), seed should be
+// random and kept secret, it's up to the user to manage password and seed sensible data properly
+// NOTE: Archive key is set by WriteArchiveCipherKey() and dictionary by WriteArchiveDictionary(),
+// UnloadPackContext() should be called once packing is done (archive key is wiped, dictionary is freed)
+typedef struct rresPackContext {
+    const char *password;           // Cipher password
+    unsigned char seed[32];         // Salt/nonce derivation seed
+    unsigned char archiveKey[32];   // Archive cipher key, chunks keys are derived from it (RRES_FLAG_ARCHIVE_KEY)
+    bool useArchiveKey;             // Archive cipher key available, set by WriteArchiveCipherKey()
+    unsigned char *dictionary;      // Archive compression dictionary, small chunks are compressed with it (RRES_FLAG_DICTIONARY)
+    unsigned int dictionarySize;    // Archive compression dictionary size
+    unsigned int dictionaryId;      // Archive compression dictionary id (CRC32 of dictionary)
+} rresPackContext;
+
+// rres codec data, provided to codec decode callback
+// NOTE: Decryptors decode packed data (cipher data included) into encrypted data size bytes, decompressors
+// decode decrypted data into unpacked data: propCount + props[] (+ padding) + raw data (info.baseSize bytes)
+typedef struct rresCodecData {
+    rresResourceChunkInfo info;     // Resource chunk info, as stored in archive
+    unsigned char *input;           // Input data
+    unsigned long long inputSize;   // Input data size
+    void *outputBuffer;             // Output data allocation (RRES_MALLOC()), allocated by codec if no output bound is provided
+    unsigned char *output;          // Output data, contained in outputBuffer
+    unsigned long long outputCapacity; // Output data capacity: output bound, input size (RRES_CODEC_IN_PLACE) or 0
+    unsigned long long outputSize;  // Output data size, set by codec
+    rresUnpackContext *context;     // Unpack context: password, archive key, dictionary, threads
+    void *userData;                 // Codec user data
+} rresCodecData;
+
+// rres codec callbacks
+// NOTE: Decode callback returns 0 on success or an UnpackResourceChunkEx() error code on failure,
+// in place decryptors must keep input data unchanged on failure
+typedef int (*rresDecodeCallback)(rresCodecData *data);                                     // Codec decode callback: decompress/decrypt data
+typedef unsigned long long (*rresOutputBoundCallback)(rresResourceChunkInfo info, const unsigned char *input); // Codec output bound callback: output data size required
+
+// rres codec: decompressor (compType) or decryptor (cipherType)
+// NOTE: Output data is allocated by unpack path when codec provides an output bound (or it decodes in place),
+// otherwise codec allocates it (i.e. to place raw data aligned, see rresAllocUnpackedData())
+typedef struct rresCodec {
+    const char *name;               // Codec name, used on log
+    rresDecodeCallback decode;      // Decode callback, NULL: not supported
+    rresOutputBoundCallback outputBound; // Output bound callback, NULL: output allocated by codec
+    unsigned int capabilities;      // Codec capabilities: RRES_CODEC_*
+    void *userData;                 // Codec user data, provided to callbacks
+} rresCodec;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -92,13 +180,58 @@ extern "C" {            // Prevents name mangling of functions
 RLAPI void *LoadDataFromResource(rresResourceChunk chunk, unsigned int *size); // Load raw data from rres resource chunk
 RLAPI char *LoadTextFromResource(rresResourceChunk chunk);      // Load text data from rres resource chunk
 RLAPI Image LoadImageFromResource(rresResourceChunk chunk);     // Load Image data from rres resource chunk
+RLAPI Image LoadImageFromResourceEx(rresResourceChunk chunk, int format); // Load Image data from rres resource chunk, converted to pixel format (0: stored format)
 RLAPI Wave LoadWaveFromResource(rresResourceChunk chunk);       // Load Wave data from rres resource chunk
 RLAPI Font LoadFontFromResource(rresResourceMulti multi);       // Load Font data from rres resource multiple chunks
 RLAPI Mesh LoadMeshFromResource(rresResourceMulti multi);       // Load Mesh data from rres resource multiple chunks
+RLAPI Mesh LoadMeshFromResourceEx(rresResourceMulti *multi);    // Load Mesh data from rres resource multiple chunks, chunks data adopted if possible (no copy)
 
 // Unpack resource chunk data (decompres/decrypt data)
-// NOTE: Function return 0 on success or other value on failure
+// NOTE 1: Function return 0 on success or other value on failure
+// NOTE 2: UnpackResourceChunk() uses the password set with rresSetCipherPassword(), to unpack
+// resource chunks from multiple threads, every thread should use its own context with UnpackResourceChunkEx()
 RLAPI int UnpackResourceChunk(rresResourceChunk *chunk);        // Unpack resource chunk data (decompress/decrypt)
+RLAPI int UnpackResourceChunkEx(rresResourceChunk *chunk, rresUnpackContext *context); // Unpack resource chunk data using provided context (NULL for UnpackResourceChunk() state)
+RLAPI rresUnpackContext LoadUnpackContext(const char *password);    // Load unpack context for provided password
+RLAPI void UnloadUnpackContext(rresUnpackContext context);          // Unload unpack context, cached keys are wiped and scratch memory is freed
+RLAPI void FlushUnpackContext(rresUnpackContext *context);          // Flush unpack context, cached keys are wiped and scratch memory is freed
+RLAPI void FlushCipherKeys(void);                                   // Flush cipher keys cached by UnpackResourceChunk(), cached keys are wiped
+RLAPI bool LoadArchiveCipherKey(rresUnpackContext *context, const char *fileName); // Load archive cipher key from file key derivation record (KDFR), NULL context for UnpackResourceChunk()
+RLAPI void SetUnpackThreadCount(unsigned int threadCount);          // Set threads used by UnpackResourceChunk() to unpack big chunks (default: 1)
+RLAPI bool LoadArchiveDictionary(rresUnpackContext *context, const char *fileName); // Load archive compression dictionary (DICT) from file, NULL context for UnpackResourceChunk()
+RLAPI void UnloadArchiveDictionary(rresUnpackContext *context);     // Unload archive compression dictionary, NULL context for UnpackResourceChunk()
+
+// Unpack codecs registry: decompressors (compType) and decryptors (cipherType)
+// NOTE: Built-in algorithms are registered by default, registered codecs replace them; codecs should be
+// registered before unpacking data (registry is not thread-safe), streaming and partial decoding require
+// specific code, so those capabilities are not available for registered codecs
+RLAPI bool RegisterDecompressor(int compType, rresCodec codec);    // Register decompressor for compression type, NULL decode restores built-in
+RLAPI bool RegisterDecryptor(int cipherType, rresCodec codec);     // Register decryptor for encryption type, NULL decode restores built-in
+RLAPI rresCodec GetDecompressor(int compType);                     // Get decompressor for compression type (registered or built-in), NULL decode if not supported
+RLAPI rresCodec GetDecryptor(int cipherType);                      // Get decryptor for encryption type (registered or built-in), NULL decode if not supported
+
+// Unpack resource chunk data while it's read from archive (streaming decryption/decompression)
+// NOTE: Packed data is read, decrypted and decompressed progressively into the unpacked data buffer,
+// peak memory is the unpacked data plus a small window, not streamable chunks (DEFLATE, QOI, LZ4 without
+// RRES_FLAG_STREAM_BLOCKS, registered codecs) are loaded and unpacked with UnpackResourceChunkEx()
+RLAPI int UnpackResourceChunkStream(rresArchive *archive, int rresId, rresUnpackContext *context, rresResourceChunk *chunk); // Load resource chunk unpacked progressively from archive, NULL context for UnpackResourceChunk() password
+
+// Unpack resource chunk raw data range (partial decompression)
+// NOTE: Only the packed data required by the range is read and decompressed for not encrypted chunks stored
+// not compressed or LZ4 compressed with RRES_FLAG_INDEPENDENT_BLOCKS, other chunks are fully unpacked
+RLAPI int UnpackResourceChunkRange(rresArchive *archive, int rresId, rresUnpackContext *context, unsigned long long offset, unsigned long long size, void *buffer); // Load resource chunk raw data range into buffer, NULL context for UnpackResourceChunk() password
+
+// Pack resource chunk data (compress/encrypt), inverse of UnpackResourceChunk()
+// NOTE: It can be used as rres.h rresPackCallback with a rresPackContext as user data, it does not use
+// any global or static state so it can be called from multiple threads (i.e. rresPackResourceChunks())
+RLAPI bool PackResourceChunk(rresPackItem *item, void *context);    // Pack resource chunk data: item->packedData, item->info.packedSize and item->info.baseSize
+RLAPI bool WriteArchiveCipherKey(rresWriter *writer, rresPackContext *context); // Write archive key derivation record (KDFR) and derive archive cipher key into context
+RLAPI bool WriteArchiveDictionary(rresWriter *writer, rresPackContext *context, const rresPackItem *samples, unsigned int sampleCount); // Train archive compression dictionary from samples raw data, write it (DICT) and keep it into context
+RLAPI void UnloadPackContext(rresPackContext *context);             // Unload pack context: archive cipher key is wiped and dictionary is freed
+
+// Load unpacked resource chunk through resource cache
+// NOTE: Returned chunk is shared, it must be released with rresReleaseCachedResourceChunk()
+RLAPI const rresResourceChunk *LoadResourceChunkCached(rresResourceCache *cache, rresArchive *archive, int rresId); // Load resource chunk (unpacked) through cache
                                                             
 // Set base directory for externally linked data
 // NOTE: When resource chunk contains an external link (FourCC: LINK, Type: RRES_DATA_LINK),
@@ -124,6 +257,7 @@ RLAPI void SetBaseDirectory(const char *baseDir);               // Set base dire
 // NOTE: They should be the same supported by the rres packaging tool (rrespacker)
 // https://github.com/phoboslab/qoi
 #include "external/qoi.h"                   // Compression algorithm: QOI (implementation in raylib)
+// NOTE: Compression algorithm RLE (byte/pixel runs) is implemented in this module
 
 #if defined(RRES_SUPPORT_COMPRESSION_LZ4)
     // https://github.com/lz4/lz4
@@ -134,27 +268,215 @@ RLAPI void SetBaseDirectory(const char *baseDir);               // Set base dire
     // https://github.com/kokke/tiny-AES-c
     #include "external/aes.h"               // Encryption algorithm: AES
     #include "external/aes.c"               // Encryption algorithm implementation: AES
+
+    // AES hardware acceleration: x86 AES-NI (checked on runtime) or ARMv8 Crypto Extensions (enabled on compilation)
+    #if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+        #define RRES_AES_NI
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+        #include <tmmintrin.h>              // Required for: SSSE3 intrinsics (_mm_shuffle_epi8)
+        #include <wmmintrin.h>              // Required for: AES-NI and PCLMULQDQ intrinsics
+        #if defined(_MSC_VER)
+            #include <intrin.h>             // Required for: __cpuid(), _InterlockedOr(), _InterlockedExchange()
+            #define RRES_AES_NI_TARGET
+            #define RRES_PCLMUL_TARGET
+            #define RRES_ATOMIC_LOAD(ptr)           _InterlockedOr((volatile long *)(ptr), 0)
+            #define RRES_ATOMIC_STORE(ptr, value)   _InterlockedExchange((volatile long *)(ptr), (long)(value))
+        #else
+            #include <cpuid.h>              // Required for: __get_cpuid()
+            #define RRES_AES_NI_TARGET __attribute__((target("aes,sse2")))
+            #define RRES_PCLMUL_TARGET __attribute__((target("pclmul,ssse3,sse2")))
+            #define RRES_ATOMIC_LOAD(ptr)           __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+            #define RRES_ATOMIC_STORE(ptr, value)   __atomic_store_n(ptr, value, __ATOMIC_RELEASE)
+        #endif
+    #elif (defined(__aarch64__) || defined(_M_ARM64)) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+        #define RRES_AES_ARMV8
+        #include <arm_neon.h>               // Required for: ARMv8 AES intrinsics
+    #endif
 #endif
-#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+
+// SIMD support (enabled on compilation), used by data decoding kernels
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RRES_SIMD_SSE2
+    #include <emmintrin.h>                  // Required for: SSE2 intrinsics
+    #if defined(__SSSE3__) || defined(__AVX__)
+        #define RRES_SIMD_SSSE3
+        #include <tmmintrin.h>              // Required for: SSSE3 intrinsics (bytes shuffle)
+    #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define RRES_SIMD_NEON
+    #include <arm_neon.h>                   // Required for: NEON intrinsics
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
     // https://github.com/LoupVaillant/Monocypher
     #include "external/monocypher.h"        // Encryption algorithm: XChaCha20-Poly1305
     #include "external/monocypher.c"        // Encryption algorithm implementation: XChaCha20-Poly1305
+
+    // Memory locking, required by derived cipher keys cache
+    #if defined(_WIN32)
+        // NOTE: GDI and USER APIs are excluded, they conflict with some raylib symbols (Rectangle, CloseWindow, DrawText...),
+        // same configuration used by rres.h (RRES_SUPPORT_THREADS), windows.h is included once per translation unit
+        #if !defined(WIN32_LEAN_AND_MEAN)
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #if !defined(NOGDI)
+            #define NOGDI
+        #endif
+        #if !defined(NOUSER)
+            #define NOUSER
+        #endif
+        #if !defined(NOMINMAX)
+            #define NOMINMAX
+        #endif
+        #include <windows.h>                // Required for: VirtualLock(), VirtualUnlock()
+    #else
+        #include <sys/mman.h>               // Required for: mlock(), munlock()
+    #endif
 #endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define RRES_CIPHER_KEY_CACHE_SIZE     32       // Derived cipher keys cached per unpack context
+#define RRES_AES_JOB_SIZE       (1024*1024)     // AES CTR data size decrypted per job (multiple of 16 bytes), big chunks are split in jobs
+#define RRES_AES_GCM_SEGMENT_SIZE    4096       // AES GCM data size authenticated and decrypted at once (multiple of 16 bytes), kept in cache
+#define RRES_UNPACK_WINDOW_SIZE (64*1024)       // Streaming unpack: packed data size read and decrypted at once (multiple of 64 bytes)
+#define RRES_STREAM_BLOCK_SIZE  (64*1024)       // LZ4 linked blocks size (RRES_FLAG_STREAM_BLOCKS), uncompressed data per block
+#define RRES_LZ4_BLOCK_SIZE     (1024*1024)     // LZ4 independent blocks size (RRES_FLAG_INDEPENDENT_BLOCKS), uncompressed data per block
+#define RRES_QOI_STRIPE_SIZE    (1024*1024)     // QOI image stripes size (RRES_FLAG_INDEPENDENT_BLOCKS), pixel data per stripe (whole rows)
+#define RRES_RLE_MAX_STRIDE             16      // RLE element maximum size (pixel stride), biggest pixel format: R32G32B32A32
+#define RRES_PACK_MAX_SIZE      0x7e000000      // Packing: chunk base data maximum size, codecs use int sizes (LZ4_MAX_INPUT_SIZE)
+
+// Archive compression dictionary configuration (LZ4)
+#define RRES_DICTIONARY_SIZE    (64*1024)       // Dictionary maximum size, LZ4 window size
+#define RRES_DICTIONARY_CHUNK_SIZE (64*1024)    // Chunks with raw data up to this size are compressed with dictionary
+#define RRES_DICTIONARY_SEGMENT_SIZE    64      // Dictionary training: samples segment size selected per epoch
+#define RRES_DICTIONARY_TRAINING_SIZE (8*1024*1024) // Dictionary training: maximum samples data size considered
+#define RRES_DICTIONARY_DMER_SIZE        8      // Dictionary training: d-mer size, substrings counted on samples
+#define RRES_DICTIONARY_HASH_BITS       20      // Dictionary training: d-mers frequency table size (log2)
+
+// Key stretching configuration, recorded in archive key derivation record (KDFR)
+#define RRES_KDF_ARGON2I                1       // Key derivation algorithm: Argon2i
+#define RRES_KDF_ARGON2I_BLOCKS     16384       // Key stretching memory blocks (KB): 16 MB
+#define RRES_KDF_ARGON2I_PASSES         3       // Key stretching iterations
+#define RRES_KDF_ARGON2I_LANES          1       // Key stretching lanes: single-threaded
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Derived cipher key, cached by (password, salt)
+typedef struct rresCipherKey {
+    unsigned char passHash[32];     // Key: Password hash (BLAKE2b), password is not kept
+    unsigned char salt[16];         // Key: Key stretching salt
+    unsigned char key[32];          // Derived cipher key (Argon2i)
+} rresCipherKey;
+
+// Derived cipher keys cache
+// NOTE: Cache memory is locked (not swapped to disk) when supported by platform, keys are wiped on flush
+typedef struct rresCipherKeyCache {
+    rresCipherKey keys[RRES_CIPHER_KEY_CACHE_SIZE]; // Cached keys
+    unsigned int count;             // Cached keys count
+    unsigned int next;              // Next key to be replaced when cache is full (round robin)
+    unsigned char archiveKey[32];   // Archive cipher key, loaded with LoadArchiveCipherKey()
+    bool archiveKeyLoaded;          // Archive cipher key available
+    bool locked;                    // Cache memory locked
+} rresCipherKeyCache;
+
+// Archive compression dictionary
+typedef struct rresDictionary {
+    unsigned int id;                // Dictionary id: CRC32 of dictionary data
+    unsigned int size;              // Dictionary data size
+    unsigned char data[RRES_DICTIONARY_SIZE]; // Dictionary data
+} rresDictionary;
+
+// MD5 hash state
+// NOTE: Data is processed in 64 bytes blocks, so it can be provided in pieces
+typedef struct rresMD5 {
+    unsigned int hash[4];           // Hash value
+    unsigned char block[64];        // Pending data block
+    unsigned long long size;        // Data size processed
+} rresMD5;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// AES CTR jobs, data is split on counter block boundaries
+typedef struct rresAesCtrJobs {
+    const struct AES_ctx *ctx;      // AES context, expanded round keys
+    unsigned char *data;            // Data to be encrypted/decrypted
+    unsigned long long size;        // Data size
+} rresAesCtrJobs;
+
+// AES GCM GHASH state
+typedef struct rresGhash {
+    unsigned char h[16];            // Hash subkey: H = AES(key, 0^128)
+    unsigned char x[16];            // Hash value
+} rresGhash;
+#endif
+
+// QOI image stripes jobs (RRES_FLAG_INDEPENDENT_BLOCKS), one stripe decoded per job
+typedef struct rresQOIStripeJobs {
+    const unsigned char *data;      // Stripes data, block table first
+    const unsigned long long *stripeOffsets; // Stripes offsets in stripes data (stripeCount + 1)
+    unsigned int stripeHeight;      // Image rows per stripe
+    unsigned int width;             // Image width
+    unsigned int height;            // Image height
+    unsigned int channels;          // Image channels: 3 (RGB) or 4 (RGBA)
+    unsigned char *pixels;          // Decoded image pixels, first stripe rows
+    bool *failed;                   // Stripe decoding failed, one per job
+} rresQOIStripeJobs;
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+// LZ4 independent blocks jobs (RRES_FLAG_INDEPENDENT_BLOCKS), one block decompressed per job
+typedef struct rresLZ4BlockJobs {
+    const unsigned char *data;      // Compressed blocks data
+    unsigned long long dataOffset;  // Compressed blocks data offset in packed data
+    const unsigned long long *blockOffsets; // Blocks offsets in packed data (blockCount + 1)
+    unsigned int firstBlock;        // First block to be decompressed (job 0)
+    unsigned int blockSize;         // Uncompressed data size per block
+    unsigned long long baseSize;    // Uncompressed data size, all blocks
+    unsigned char *output;          // Decompressed data, first block data
+    bool *failed;                   // Block decompression failed, one per job
+} rresLZ4BlockJobs;
+#endif
+
+// Resource chunk unpack stream
+// NOTE: Packed data is read and decrypted progressively through a small window, data is authenticated
+// (MD5, tag or MAC) while it's decrypted and verified once all data has been read
+typedef struct rresUnpackStream {
+    rresChunkReader *reader;        // Resource chunk packed data reader
+    unsigned char cipherType;       // Data encryption algorithm
+    unsigned long long dataSize;    // Encrypted data size (additional cipher data not considered)
+    unsigned long long readSize;    // Encrypted data size already read and decrypted
+    unsigned int extraSize;         // Additional cipher data size: salt, nonce, MAC...
+    unsigned char *window;          // Decrypted data window
+    unsigned int windowCapacity;    // Window capacity
+    unsigned int windowPosition;    // Window position, next byte to be provided
+    unsigned int windowSize;        // Window data size
+    unsigned char mac[16];          // Authentication data appended on encryption: MD5, tag or MAC
+    unsigned long long counter;     // Cipher counter: next block to be decrypted
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+    struct AES_ctx aes;             // AES context, expanded round keys
+    unsigned char nonce[12];        // AES GCM nonce
+    unsigned char tagMask[16];      // AES GCM tag mask: AES(key, J0)
+    rresGhash ghash;                // AES GCM GHASH state
+    rresMD5 md5;                    // AES CTR decrypted data MD5
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    crypto_aead_ctx chacha;         // XChaCha20 state: subkey and nonce
+    crypto_poly1305_ctx poly;       // Poly1305 state
+#endif
+} rresUnpackStream;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *baseDir = NULL;      // Base directory pointer, used on external linked data loading
+static void *cipherKeyCache = NULL;     // Derived cipher keys cache used by UnpackResourceChunk()
+static unsigned int unpackThreadCount = 1;  // Threads used by UnpackResourceChunk() to unpack big chunks
+static void *archiveDictionary = NULL;  // Archive compression dictionary used by UnpackResourceChunk()
+static rresCodec decompressors[256] = { 0 };    // Registered decompressors (by compType), built-in used if not registered
+static rresCodec decryptors[256] = { 0 };       // Registered decryptors (by cipherType), built-in used if not registered
+#if defined(RRES_AES_NI)
+static long aesCpuFeatures = -1;        // AES CPU features: AES-NI (1), PCLMULQDQ + SSSE3 (2), -1: not checked yet (atomic access)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -165,10 +487,84 @@ static const char *baseDir = NULL;      // Base directory pointer, used on exter
 static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size);      // Load chunk: RRES_DATA_LINK
 static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size);     // Load chunk: RRES_DATA_RAW
 static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang); // Load chunk: RRES_DATA_TEXT
-static Image LoadImageFromResourceChunk(rresResourceChunk chunk);                        // Load chunk: RRES_DATA_IMAGE
-
-static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02);        // Get file extension from RRES_DATA_RAW properties (unsigned int) 
-static unsigned int *ComputeMD5(unsigned char *data, int size);                          // Compute MD5 hash code, returns 4 integers array (static)
+static Image LoadImageFromResourceChunk(rresResourceChunk chunk, int format);            // Load chunk: RRES_DATA_IMAGE (converted to format, 0: stored format)
+static void ConvertImageFormat(Image *image, int format);                                // Convert image to pixel format with raylib ImageFormat() (BGRA8 supported)
+static Mesh LoadMeshFromResourceChunks(rresResourceMulti multi, bool adopt);             // Load Mesh data from resource chunks (chunks data adopted if requested)
+static void *LoadMeshAttributeFromResourceChunk(rresResourceChunk *chunk, int format, unsigned int componentCount, bool adopt); // Load chunk: RRES_DATA_VERTEX (converted to vertex format)
+
+static void GetExtensionFromProps(unsigned int ext01, unsigned int ext02, char *extension); // Get file extension from RRES_DATA_RAW properties (unsigned int), extension[9]
+
+// Built-in codecs, registered by default
+static rresCodec GetBuiltInDecompressor(int compType);                                  // Get built-in decompressor for compression type
+static rresCodec GetBuiltInDecryptor(int cipherType);                                   // Get built-in decryptor for encryption type
+static int DecompressDEFLATE(rresCodecData *data);                                      // Decompress data: DEFLATE (raylib)
+static int DecompressQOI(rresCodecData *data);                                          // Decompress data: QOI (data header not compressed)
+static bool DecodeQOIData(const unsigned char *data, unsigned long long size, unsigned char *pixels, unsigned int width, unsigned int height, unsigned int channels); // Decode QOI data into provided pixels buffer
+static void QOIStripeJob(void *jobs, unsigned int index);                               // QOI image stripes job: decode one stripe
+static unsigned long long *LoadBlockOffsets(const unsigned char *table, unsigned long long packedSize, unsigned long long baseSize, unsigned int *blockSize, unsigned int *blockCount); // Load independent blocks offsets from block table (RRES_FLAG_INDEPENDENT_BLOCKS)
+static int DecompressRLE(rresCodecData *data);                                          // Decompress data: RLE (data header not compressed)
+static unsigned long long CompressRLEData(const unsigned char *data, unsigned long long size, unsigned int stride, unsigned char *output, unsigned long long capacity); // Compress data with RLE (elements of stride bytes), returns compressed size (0 on failure)
+static bool DecompressRLEData(const unsigned char *data, unsigned long long size, unsigned char *output, unsigned long long outputSize); // Decompress RLE data, output size must match
+static void ExpandRunRLE(unsigned char *output, unsigned long long capacity, const unsigned char *element, unsigned int stride, unsigned long long count); // Expand RLE run: element (stride bytes) repeated count times (SIMD)
+static unsigned int GetPixelSize(int format);                                           // Get uncompressed pixel format size in bytes (0 for compressed formats)
+static void GetPixelRGBA8(const unsigned char *pixels, int format, unsigned long long index, unsigned char *rgba); // Get uncompressed pixel as RGBA8 (8 bit and 16 bit packed formats)
+static void ConvertPixelsRGBA8(const unsigned char *pixels, int format, unsigned char *output, unsigned long long count, bool bgra); // Convert uncompressed pixels to RGBA8 or BGRA8 (SIMD)
+static unsigned int GetVertexFormatSize(int format);                                    // Get vertex format size in bytes
+static float HalfToFloat(unsigned short half);                                          // Convert half float (16 bit) to float
+static bool ConvertVertexComponents(const unsigned char *data, int format, float *output, unsigned long long count); // Convert vertex components to float (SIMD, integer formats normalized)
+static bool ConvertVertexColors(const unsigned char *data, int format, unsigned char *output, unsigned long long count); // Convert vertex colors components to unsigned char
+static bool ConvertVertexIndices(const unsigned char *data, int format, unsigned short *output, unsigned long long count); // Convert vertex indices to unsigned short (SIMD)
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+static int DecompressLZ4(rresCodecData *data);                                          // Decompress data: LZ4 (single block, linked blocks, independent blocks or dictionary)
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static int DecryptAES(rresCodecData *data);                                             // Decrypt data in place: AES-256 CTR (MD5 verified)
+static int DecryptAESGCM(rresCodecData *data);                                          // Decrypt data in place: AES-256 GCM
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static int DecryptXChaCha20(rresCodecData *data);                                       // Decrypt data in place: XChaCha20-Poly1305
+#endif
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+static unsigned int TrainDictionary(const rresPackItem *samples, unsigned int sampleCount, unsigned char *dictionary, unsigned int capacity); // Train compression dictionary from samples raw data, returns dictionary size
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+static void DeriveCipherKey(const char *password, const unsigned char *salt, unsigned char *key, void **workArea); // Derive cipher key[32] from password and salt[16] (Argon2i)
+static void GetCipherKey(rresUnpackContext *context, const unsigned char *salt, unsigned char *key); // Get cipher key[32] for context password and salt[16], derived keys are cached
+static bool GetArchiveChunkKey(rresUnpackContext *context, const unsigned char *nonce, unsigned int nonceSize, unsigned char *key); // Get chunk cipher key[32] from context archive key and chunk nonce
+static void DeriveChunkKey(const unsigned char *archiveKey, const unsigned char *nonce, unsigned int nonceSize, unsigned char *key); // Derive chunk cipher key[32] from archive key[32] and nonce (BLAKE2b)
+static void DerivePackBytes(const rresPackContext *context, const rresPackItem *item, const unsigned char *data, unsigned int size, unsigned char label, unsigned char *bytes, unsigned int count); // Derive deterministic bytes (salt/nonce) from seed and data
+#endif
+static void ComputeMD5(const unsigned char *data, unsigned long long size, unsigned int *hash); // Compute MD5 hash code, hash[4]
+static void MD5Init(rresMD5 *md5);                                                      // Init MD5 hash state
+static void MD5Update(rresMD5 *md5, const unsigned char *data, unsigned long long size); // Update MD5 hash with provided data
+static void MD5Final(rresMD5 *md5, unsigned int *hash);                                 // Finish MD5 hash, hash[4]
+static void MD5ProcessBlock(unsigned int *hash, const unsigned char *block);            // Process MD5 64 bytes block
+static int OpenUnpackStream(rresUnpackStream *stream, rresChunkReader *reader, rresResourceChunkInfo info, rresUnpackContext *context); // Open unpack stream, cipher key is derived (returns UnpackResourceChunkEx() error codes)
+static bool ReadUnpackStream(rresUnpackStream *stream, void *buffer, unsigned long long size); // Read decrypted data from unpack stream
+static void DecryptUnpackStream(rresUnpackStream *stream, unsigned char *data, unsigned int size); // Decrypt unpack stream data piece (in place), authentication is updated
+static bool CloseUnpackStream(rresUnpackStream *stream);                                // Close unpack stream, returns true if decrypted data is authenticated
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+static int DecompressLZ4Blocks(const unsigned char *data, unsigned long long size, unsigned char *output, int outputSize); // Decompress LZ4 linked blocks (RRES_FLAG_STREAM_BLOCKS), returns decompressed size
+static bool DecompressLZ4BlockJobs(rresLZ4BlockJobs *jobs, unsigned int blockCount, unsigned int threadCount); // Decompress LZ4 independent blocks in parallel
+static void LZ4BlockJob(void *jobs, unsigned int index);                                // LZ4 independent blocks job: decompress one block
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static void AesCtrXcrypt(const unsigned char *key, unsigned char *data, unsigned long long size, unsigned int threadCount); // AES-256 CTR encryption/decryption (counter starts at 0)
+static void AesCtrXcryptBlocks(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter); // AES-256 CTR starting at provided counter block, best backend available
+static void AesCtrJob(void *jobs, unsigned int index);                                  // AES CTR job: encrypt/decrypt one data part
+static bool AesGcmXcrypt(const unsigned char *key, const unsigned char *nonce, unsigned char *data, unsigned long long size, unsigned char *tag, bool encrypt); // AES-256 GCM encryption/decryption, nonce[12], tag[16] computed over ciphertext
+static void GhashUpdate(rresGhash *ghash, const unsigned char *data, unsigned long long size); // GHASH data (last block zero padded), best backend available
+static void GhashMultiply(unsigned char *x, const unsigned char *h);                    // GHASH multiply in GF(2^128): x = x*h (software, constant time)
+#if defined(RRES_AES_NI)
+static int GetAesCpuFeatures(void);                                                     // Get x86 AES CPU features (checked once)
+RRES_AES_NI_TARGET static void AesCtrXcryptNI(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter); // AES CTR: x86 AES-NI backend
+RRES_PCLMUL_TARGET static void GhashUpdateCLMUL(rresGhash *ghash, const unsigned char *data, unsigned long long size); // GHASH: x86 PCLMULQDQ backend
+#endif
+#if defined(RRES_AES_ARMV8)
+static void AesCtrXcryptARMv8(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter); // AES CTR: ARMv8 Crypto Extensions backend
+#endif
+#endif
+static void UnloadCipherKeyCache(void *keyCache);                                       // Unload derived cipher keys cache, keys are wiped
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -228,19 +624,29 @@ char *LoadTextFromResource(rresResourceChunk chunk)
 
 // Load Image data from rres resource
 Image LoadImageFromResource(rresResourceChunk chunk)
+{
+    return LoadImageFromResourceEx(chunk, 0);
+}
+
+// Load Image data from rres resource, converted to pixel format
+// NOTE: Uncompressed 8 bit and 16 bit images are converted to RGBA8/BGRA8 while copied out of chunk raw data,
+// other conversions (and images loaded from files) are done after loading with raylib ImageFormat()
+Image LoadImageFromResourceEx(rresResourceChunk chunk, int format)
 {
     Image image = { 0 };
 
     if (rresGetDataType(chunk.info.type) == RRES_DATA_IMAGE)          // Image data
     {
-        image = LoadImageFromResourceChunk(chunk);
+        image = LoadImageFromResourceChunk(chunk, format);
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)       // Raw image file
     {
         unsigned int dataSize = 0;
         unsigned char *data = (unsigned char *)LoadDataFromResourceChunk(chunk, &dataSize);
 
-        image = LoadImageFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
+        char extension[9] = { 0 };
+        GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2], extension);
+        image = LoadImageFromMemory(extension, data, dataSize);
 
         RL_FREE(data);
     }
@@ -256,6 +662,10 @@ Image LoadImageFromResource(rresResourceChunk chunk)
         image = LoadImageFromMemory(GetFileExtension((char *)chunk.data.raw), (unsigned char *)data, dataSize);
     }
 
+
+    // NOTE: Images loaded from files are converted after loading
+    if ((rresGetDataType(chunk.info.type) != RRES_DATA_IMAGE) && (format != 0)) ConvertImageFormat(&image, format);
+
     return image;
 }
 
@@ -273,18 +683,26 @@ Wave LoadWaveFromResource(rresResourceChunk chunk)
             wave.sampleSize = chunk.data.props[2];
             wave.channels = chunk.data.props[3];
 
-            unsigned int size = wave.frameCount*wave.sampleSize/8;
-            wave.data = RL_CALLOC(size, 1);
-            memcpy(wave.data, chunk.data.raw, size);
+            // NOTE: Computed wave data must fit the raw data of the chunk processed
+            unsigned long long size = (unsigned long long)wave.frameCount*wave.channels*wave.sampleSize/8;
+
+            if ((chunk.data.raw != NULL) && (size <= chunk.data.rawSize))
+            {
+                wave.data = RL_CALLOC((size_t)size, 1);
+                if (wave.data != NULL) memcpy(wave.data, chunk.data.raw, (size_t)size);
+            }
+            else RRES_LOG("RRES: WARNING: WAVE: Chunk data size do not match expected wave data size\n");
         }
-        RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+        else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)   // Raw wave file
     {
         unsigned int dataSize = 0;
         unsigned char *data = (unsigned char *)LoadDataFromResourceChunk(chunk, &dataSize);
 
-        wave = LoadWaveFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
+        char extension[9] = { 0 };
+        GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2], extension);
+        wave = LoadWaveFromMemory(extension, data, dataSize);
 
         RL_FREE(data);
     }
@@ -349,7 +767,7 @@ Font LoadFontFromResource(rresResourceMulti multi)
         {
             if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
             {
-                Image image = LoadImageFromResourceChunk(multi.chunks[1]);
+                Image image = LoadImageFromResourceChunk(multi.chunks[1], 0);
                 font.texture = LoadTextureFromImage(image);
                 UnloadImage(image);
             }
@@ -363,7 +781,9 @@ Font LoadFontFromResource(rresResourceMulti multi)
             unsigned int dataSize = 0;
             unsigned char *rawData = (unsigned char *)LoadDataFromResourceChunk(multi.chunks[0], &dataSize);
 
-            font = LoadFontFromMemory(GetExtensionFromProps(multi.chunks[0].data.props[1], multi.chunks[0].data.props[2]), rawData, dataSize, 32, NULL, 0);
+            char extension[9] = { 0 };
+            GetExtensionFromProps(multi.chunks[0].data.props[1], multi.chunks[0].data.props[2], extension);
+            font = LoadFontFromMemory(extension, rawData, dataSize, 32, NULL, 0);
 
             RL_FREE(rawData);
         }
@@ -390,133 +810,275 @@ Font LoadFontFromResource(rresResourceMulti multi)
 // NOTE: We try to load vertex data following raylib structure constraints,
 // in case data does not fit raylib Mesh structure, it is not loaded
 Mesh LoadMeshFromResource(rresResourceMulti multi)
+{
+    return LoadMeshFromResourceChunks(multi, false);
+}
+
+// Load Mesh data from rres resource, chunks data is adopted by mesh (no copy) if possible
+// NOTE: Chunks data already in raylib expected vertex format is adopted by mesh and removed from chunks
+// (chunk.data.raw set to NULL), resource multi must still be unloaded with rresUnloadResourceMulti()
+// WARNING: Adopted data is freed by raylib UnloadMesh(), RRES_FREE() and RL_FREE() must be compatible,
+// cached chunks (shared) must not be provided
+Mesh LoadMeshFromResourceEx(rresResourceMulti *multi)
 {
     Mesh mesh = { 0 };
 
-    // TODO: Support externally linked mesh resource?
+    if (multi != NULL) mesh = LoadMeshFromResourceChunks(*multi, true);
 
-    // Mesh resource consist of (n) chunks:
-    for (unsigned int i = 0; i < multi.count; i++)
+    return mesh;
+}
+
+// Unpack compressed/encrypted data from resource chunk
+// NOTE: Password set with rresSetCipherPassword() is used for decryption, derived keys are
+// cached between calls (keyed by password and salt) until FlushCipherKeys() is called
+int UnpackResourceChunk(rresResourceChunk *chunk)
+{
+    rresUnpackContext context = LoadUnpackContext(rresGetCipherPassword());
+    context.keyCache = cipherKeyCache;
+    context.threadCount = unpackThreadCount;
+    context.dictionary = archiveDictionary;
+
+    int result = UnpackResourceChunkEx(chunk, &context);
+
+    // Keep derived keys cache and dictionary, only scratch memory is freed
+    cipherKeyCache = context.keyCache;
+    context.keyCache = NULL;
+    context.dictionary = NULL;
+    UnloadUnpackContext(context);
+
+    return result;
+}
+
+// Load unpack context for provided password
+// NOTE: Password is kept as a pointer to provided string, scratch memory is allocated on first use
+rresUnpackContext LoadUnpackContext(const char *password)
+{
+    rresUnpackContext context = { 0 };
+
+    context.password = (password != NULL)? password : rresGetCipherPassword();
+    context.threadCount = 1;
+
+    return context;
+}
+
+// Unload unpack context
+void UnloadUnpackContext(rresUnpackContext context)
+{
+    UnloadArchiveDictionary(&context);
+    FlushUnpackContext(&context);
+}
+
+// Flush unpack context
+// NOTE: Cached keys are wiped, context can still be used (keys are derived again when required)
+void FlushUnpackContext(rresUnpackContext *context)
+{
+    if (context != NULL)
+    {
+        UnloadCipherKeyCache(context->keyCache);
+        RL_FREE(context->workArea);
+
+        context->keyCache = NULL;
+        context->workArea = NULL;
+    }
+}
+
+// Flush cipher keys cached by UnpackResourceChunk()
+// NOTE: It should be called once encrypted resources are loaded or when cipher password changes
+void FlushCipherKeys(void)
+{
+    UnloadCipherKeyCache(cipherKeyCache);
+    cipherKeyCache = NULL;
+}
+
+// Set threads used by UnpackResourceChunk() to decrypt big chunks
+// NOTE: AES CTR chunks bigger than RRES_AES_JOB_SIZE are split on counter block boundaries and
+// decrypted in parallel, it requires rres.h RRES_SUPPORT_THREADS (otherwise decrypted in calling thread)
+void SetUnpackThreadCount(unsigned int threadCount)
+{
+    unpackThreadCount = (threadCount > 0)? threadCount : 1;
+}
+
+// Load archive compression dictionary (DICT) from file
+// NOTE: Dictionary is loaded once per archive and kept in context (replacing previous one), chunks compressed
+// with it (RRES_FLAG_DICTIONARY) require it, a NULL context sets the dictionary used by UnpackResourceChunk()
+bool LoadArchiveDictionary(rresUnpackContext *context, const char *fileName)
+{
+    bool result = false;
+    rresResourceChunk chunk = rresLoadDictionaryChunk(fileName);
+
+    // NOTE: Dictionary chunk data: propCount + props[] + dictionary
+    unsigned long long size = chunk.data.rawSize;
+
+    // Verify dictionary: supported algorithm, size and id (CRC32 of dictionary data)
+    if ((chunk.data.propCount >= 2) && (chunk.data.raw != NULL) && (chunk.data.props[0] == RRES_COMP_LZ4) &&
+        (size > 0) && (size <= RRES_DICTIONARY_SIZE) && (rresComputeCRC32((unsigned char *)chunk.data.raw, (int)size) == chunk.data.props[1]))
     {
-        if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
+        rresDictionary *dictionary = (rresDictionary *)RL_MALLOC(sizeof(rresDictionary));
+
+        if (dictionary != NULL)
         {
-            // NOTE: raylib only supports vertex arrays with same vertex count,
-            // rres.chunks[0] defined vertexCount will be the reference for the following chunks
-            // The only exception to vertexCount is the mesh.indices array
-            if (mesh.vertexCount == 0) mesh.vertexCount = multi.chunks[0].data.props[0];
+            dictionary->id = chunk.data.props[1];
+            dictionary->size = (unsigned int)size;
+            memcpy(dictionary->data, chunk.data.raw, (size_t)size);
 
-            // Verify chunk type and vertex count
-            if (rresGetDataType(multi.chunks[i].info.type) == RRES_DATA_VERTEX)
-            {
-                // In case vertex count do not match we skip that resource chunk
-                if ((multi.chunks[i].data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) && (multi.chunks[i].data.props[0] != mesh.vertexCount)) continue;
+            UnloadArchiveDictionary(context);
 
-                // NOTE: We are only loading raylib supported rresVertexFormat and raylib expected components count
-                switch (multi.chunks[i].data.props[1])    // Check rresVertexAttribute value
-                {
-                    case RRES_VERTEX_ATTRIBUTE_POSITION:
-                    {
-                        // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.vertices = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.vertices, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
+            if (context != NULL) context->dictionary = dictionary;
+            else archiveDictionary = dictionary;
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD1:
-                    {
-                        // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
+            result = true;
+            RRES_LOG("RRES: DICT: [%s] Compression dictionary loaded (%u bytes)\n", fileName, dictionary->size);
+        }
+    }
+    else if (chunk.data.propCount > 0) RRES_LOG("RRES: WARNING: DICT: [%s] Compression dictionary not supported\n", fileName);
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD2:
-                    {
-                        // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords2 = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords2, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
+    rresUnloadResourceChunk(chunk);
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD3:
-                    {
-                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord3 not supported\n");
+    return result;
+}
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD4:
-                    {
-                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord4 not supported\n");
+// Unload archive compression dictionary
+void UnloadArchiveDictionary(rresUnpackContext *context)
+{
+    if (context != NULL)
+    {
+        RL_FREE(context->dictionary);
+        context->dictionary = NULL;
+    }
+    else
+    {
+        RL_FREE(archiveDictionary);
+        archiveDictionary = NULL;
+    }
+}
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_NORMAL:
-                    {
-                        // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.normals = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.normals, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
+// Register decompressor for compression type
+// NOTE: Registered decompressor replaces built-in one (if any), a codec with NULL decode restores built-in
+bool RegisterDecompressor(int compType, rresCodec codec)
+{
+    if ((compType <= RRES_COMP_NONE) || (compType > 255)) return false;
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_TANGENT:
-                    {
-                        // raylib expects 4 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.tangents = (float *)RL_CALLOC(mesh.vertexCount*4, sizeof(float));
-                            memcpy(mesh.tangents, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
+    codec.capabilities &= ~(RRES_CODEC_STREAMING | RRES_CODEC_PARTIAL);
+    decompressors[compType] = codec;
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_COLOR:
-                    {
-                        // raylib expects 4 components per vertex and unsigned char vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UBYTE))
-                        {
-                            mesh.colors = (unsigned char *)RL_CALLOC(mesh.vertexCount*4, sizeof(unsigned char));
-                            memcpy(mesh.colors, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(unsigned char));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
+    return true;
+}
 
-                    } break;
-                    case RRES_VERTEX_ATTRIBUTE_INDEX:
-                    {
-                        // raylib expects 1 components per index and unsigned short vertex format
-                        if ((multi.chunks[i].data.props[2] == 1) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_USHORT))
-                        {
-                            mesh.indices = (unsigned short *)RL_CALLOC(multi.chunks[i].data.props[0], sizeof(unsigned short));
-                            memcpy(mesh.indices, multi.chunks[i].data.raw, multi.chunks[i].data.props[0]*sizeof(unsigned short));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, componentCount/vertexFormat do not fit\n");
+// Register decryptor for encryption type
+// NOTE: Registered decryptor replaces built-in one (if any), a codec with NULL decode restores built-in
+bool RegisterDecryptor(int cipherType, rresCodec codec)
+{
+    if ((cipherType <= RRES_CIPHER_NONE) || (cipherType > 255)) return false;
 
-                    } break;
-                    default: break;
-                }
-            }
+    codec.capabilities &= ~(RRES_CODEC_STREAMING | RRES_CODEC_PARTIAL);
+    decryptors[cipherType] = codec;
+
+    return true;
+}
+
+// Get decompressor for compression type
+rresCodec GetDecompressor(int compType)
+{
+    rresCodec codec = { 0 };
+
+    if ((compType > RRES_COMP_NONE) && (compType <= 255))
+    {
+        codec = decompressors[compType];
+        if (codec.decode == NULL) codec = GetBuiltInDecompressor(compType);
+    }
+
+    return codec;
+}
+
+// Get decryptor for encryption type
+rresCodec GetDecryptor(int cipherType)
+{
+    rresCodec codec = { 0 };
+
+    if ((cipherType > RRES_CIPHER_NONE) && (cipherType <= 255))
+    {
+        codec = decryptors[cipherType];
+        if (codec.decode == NULL) codec = GetBuiltInDecryptor(cipherType);
+    }
+
+    return codec;
+}
+
+// Load archive cipher key from file key derivation record (KDFR)
+// NOTE 1: Key is derived from context password (key stretching is done once per archive) and kept in context
+// keys cache, chunks with RRES_FLAG_ARCHIVE_KEY derive their key from it, a NULL context sets the archive key
+// used by UnpackResourceChunk() (password set with rresSetCipherPassword())
+// NOTE 2: Only one archive key is kept per context, password is verified on chunks decryption
+bool LoadArchiveCipherKey(rresUnpackContext *context, const char *fileName)
+{
+    bool result = false;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    rresUnpackContext defaultContext = { 0 };
+    rresUnpackContext *keyContext = context;
+
+    if (context == NULL)
+    {
+        defaultContext = LoadUnpackContext(rresGetCipherPassword());
+        defaultContext.keyCache = cipherKeyCache;
+        keyContext = &defaultContext;
+    }
+
+    rresResourceChunk chunk = rresLoadKeyDerivationChunk(fileName);
+
+    // Verify key derivation record: Argon2i with supported parameters and salt[16]
+    if ((chunk.data.propCount >= 4) && (chunk.data.raw != NULL) &&
+        (chunk.data.rawSize >= 16) &&
+        (chunk.data.props[0] == RRES_KDF_ARGON2I) && (chunk.data.props[1] == RRES_KDF_ARGON2I_BLOCKS) &&
+        (chunk.data.props[2] == RRES_KDF_ARGON2I_PASSES) && (chunk.data.props[3] == RRES_KDF_ARGON2I_LANES))
+    {
+        uint8_t key[32] = { 0 };
+
+        // NOTE: Archive key is derived through context keys cache, loading it again does not require key stretching
+        GetCipherKey(keyContext, (const unsigned char *)chunk.data.raw, key);
+
+        rresCipherKeyCache *cache = (rresCipherKeyCache *)keyContext->keyCache;
+
+        if (cache != NULL)
+        {
+            memcpy(cache->archiveKey, key, 32);
+            cache->archiveKeyLoaded = true;
+            result = true;
+
+            RRES_LOG("RRES: KDFR: [%s] Archive cipher key loaded\n", fileName);
         }
-        else RRES_LOG("RRES: WARNING: Vertex provided data must be decompressed/decrypted\n");
+
+        crypto_wipe(key, 32);
     }
+    else if (chunk.data.propCount > 0) RRES_LOG("RRES: WARNING: KDFR: [%s] Key derivation record not supported\n", fileName);
 
-    return mesh;
+    rresUnloadResourceChunk(chunk);
+
+    if (context == NULL)
+    {
+        // Keep derived keys cache, only scratch memory is freed
+        cipherKeyCache = defaultContext.keyCache;
+        defaultContext.keyCache = NULL;
+        UnloadUnpackContext(defaultContext);
+    }
+#else
+    RRES_LOG("RRES: WARNING: KDFR: Archive cipher key requires encryption support\n");
+#endif
+
+    return result;
 }
 
-// Unpack compressed/encrypted data from resource chunk
+// Unpack compressed/encrypted data from resource chunk using provided context
 // In case data could not be processed by rres.h, it is just copied in chunk.data.raw for processing here
 // NOTE 1: Function return 0 on success or an error code on failure
 // NOTE 2: Data corruption CRC32 check has already been performed by rresLoadResourceMulti() on rres.h
-int UnpackResourceChunk(rresResourceChunk *chunk)
+// NOTE 3: Function does not use any global or static state, it can be called from multiple threads,
+// as long as every thread uses its own context (and codecs are not registered meanwhile),
+// NULL context falls back to UnpackResourceChunk() (password set with rresSetCipherPassword(), not reentrant)
+int UnpackResourceChunkEx(rresResourceChunk *chunk, rresUnpackContext *context)
 {
+    if (context == NULL) return UnpackResourceChunk(chunk);
+
     int result = 0;
     bool updateProps = false;
 
@@ -526,474 +1088,3767 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
     //  2 - Invalid password on decryption
     //  3 - Compression algorithm not supported
     //  4 - Error on data decompression
+    //  5 - Archive cipher key not loaded (LoadArchiveCipherKey() required)
+    //  8 - Archive compression dictionary not loaded (LoadArchiveDictionary() required)
+    // NOTE: Codes 6 and 7 are used by UnpackResourceChunkStream() and UnpackResourceChunkRange()
 
     // NOTE 1: If data is compressed/encrypted the properties are not loaded by rres.h because
     // it's up to the user to process the data; *chunk must be properly updated by this function
-    // NOTE 2: rres-raylib should support the same algorithms and libraries used by rrespacker tool
-    void *unpackedData = NULL;    
-
-    // STEP 1. Data decryption
+    // NOTE 2: rres-raylib should support the same algorithms and libraries used by rrespacker tool,
+    // algorithms are provided by the codecs registered for chunk cipherType and compType
+    // NOTE 3: Data is decrypted in place and decompressed straight into the unpacked data buffer,
+    // chunk->data.props and chunk->data.raw point into that buffer (no additional copies)
+    void *unpackedBuffer = NULL;            // Unpacked data allocation, owned by chunk data once unpacked
+    unsigned char *unpackedData = NULL;     // Unpacked data: propCount + props[] (+ padding) + data, contained in unpackedBuffer
+
+    // STEP 1. Data decryption (in place if supported by decryptor)
     //-------------------------------------------------------------------------------------
-    unsigned char *decryptedData = NULL;
+    unsigned char *decryptedData = (unsigned char *)chunk->data.raw;
 
-    switch (chunk->info.cipherType)
+    if (chunk->info.cipherType != RRES_CIPHER_NONE)
     {
-        case RRES_CIPHER_NONE: decryptedData = (unsigned char *)chunk->data.raw; break;
-#if defined(RRES_SUPPORT_ENCRYPTION_AES)
-        case RRES_CIPHER_AES:
+        rresCodec decryptor = GetDecryptor(chunk->info.cipherType);
+        rresCodecData data = { 0 };
+
+        data.info = chunk->info;
+        data.input = decryptedData;
+        data.inputSize = chunk->info.packedSize;
+        data.context = context;
+        data.userData = decryptor.userData;
+
+        if (decryptor.decode == NULL) result = 1;
+        else if ((decryptor.capabilities & RRES_CODEC_IN_PLACE) != 0)
         {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
-
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 16, 1);
-            if (decryptedData != NULL) memcpy(decryptedData, chunk->data.raw, chunk->info.packedSize - 16 - 16);
-
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
-
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 16), 16);
-            
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(),   // User password
-                .pass_size = strlen(rresGetCipherPassword()),       // Password length
-                .salt = salt,                           // Salt for the password
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
-
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
-
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
-
-            // Required variables for decryption and message authentication
-            unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
-
-            // Retrieve MD5 from chunk packed data
-            // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
-            memcpy(md5, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 4*sizeof(unsigned int));
-
-            // Message decryption, requires key
-            struct AES_ctx ctx = { 0 };
-            AES_init_ctx(&ctx, key);
-            AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)decryptedData, chunk->info.packedSize - 16 - 16);   // AES Counter mode, stream cipher
-
-            // Verify MD5 to check if data decryption worked
-            unsigned int decryptMD5[4] = { 0 };
-            unsigned int *md5Ptr = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16);
-            for (int i = 0; i < 4; i++) decryptMD5[i] = md5Ptr[i];
-
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(key, 32);
-
-            if (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0)    // Decrypted successfully!
-            {
-                chunk->info.packedSize -= (16 + 16);    // We remove additional data size from packed size (salt[16] + MD5[16])
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (AES)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-            else
-            {
-                result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
+            data.outputBuffer = chunk->data.raw;
+            data.output = decryptedData;
+            data.outputCapacity = data.inputSize;
+        }
+        else if (decryptor.outputBound != NULL)
+        {
+            data.outputCapacity = decryptor.outputBound(chunk->info, decryptedData);
+            data.outputBuffer = RRES_MALLOC((data.outputCapacity > 0)? (size_t)data.outputCapacity : 1);
+            data.output = (unsigned char *)data.outputBuffer;
 
-        } break;
-#endif
-#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
-        case RRES_CIPHER_XCHACHA20_POLY1305:
+            if (data.output == NULL) result = 2;
+        }
+
+        if (result == 0) result = decryptor.decode(&data);
+        if ((result == 0) && (data.output == NULL)) result = 2;
+
+        if (result == 0)
         {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
-
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 24 - 16, 1);
-
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
-
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24 - 16), 16);
-            
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(),   // User password
-                .pass_size = strlen(rresGetCipherPassword()),       // Password length
-                .salt = salt,                           // Salt for the password
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
-
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
-
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
-
-            // Required variables for decryption and message authentication
-            uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
-            uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
-
-            // Retrieve nonce and MAC from chunk packed data
-            // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
-            memcpy(nonce, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24), 24);
-            memcpy(mac, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 16);
-
-            // Message decryption requires key, nonce and MAC
-            int decryptResult = crypto_aead_unlock(decryptedData, mac, key, nonce, NULL, 0, chunk->data.raw, (chunk->info.packedSize - 16 - 24 - 16));
-
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(nonce, 24);
-            crypto_wipe(key, 32);
-
-            if (decryptResult == 0)    // Decrypted successfully!
-            {
-                chunk->info.packedSize -= (16 + 24 + 16);    // We remove additional data size from packed size
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (XChaCha20)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-            else if (decryptResult == -1)
+            // Decrypted data replaces packed data
+            if (data.outputBuffer != chunk->data.raw)
             {
-                result = 2;   // Wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                RRES_FREE(chunk->data.raw);
+                chunk->data.raw = data.outputBuffer;
             }
-        } break;
-#endif
-        default: 
+
+            chunk->data.rawSize = data.outputSize;
+
+            decryptedData = data.output;
+            chunk->info.packedSize = data.outputSize;   // Additional cipher data is not considered any more
+            RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (%s)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], decryptor.name);
+        }
+        else
         {
-            result = 1;    // Decryption algorithm not supported
-            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            if (data.outputBuffer != chunk->data.raw) RRES_FREE(data.outputBuffer);
 
-        } break;
+            if (result == 1) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            else if (result == 5) RRES_LOG("RRES: WARNING: %c%c%c%c: Archive cipher key not loaded\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            else RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
     }
 
     if ((result == 0) && (chunk->info.cipherType != RRES_CIPHER_NONE))
     {
         // Data is not encrypted any more, register it
         chunk->info.cipherType = RRES_CIPHER_NONE;
+        chunk->info.flags &= ~RRES_FLAG_ARCHIVE_KEY;
         updateProps = true;
     }
 
     // STEP 2: Data decompression (if decryption was successful)
     //-------------------------------------------------------------------------------------
-    unsigned char *uncompData = NULL;
-
-    if (result == 0)
+    if ((result == 0) && (chunk->info.compType == RRES_COMP_NONE))
+    {
+        // NOTE: Decrypted data buffer becomes the unpacked data buffer
+        unpackedBuffer = chunk->data.raw;
+        unpackedData = decryptedData;
+    }
+    else if (result == 0)
     {
-        switch (chunk->info.compType)
+        rresCodec decompressor = GetDecompressor(chunk->info.compType);
+        rresCodecData data = { 0 };
+
+        data.info = chunk->info;
+        data.input = decryptedData;
+        data.inputSize = chunk->info.packedSize;
+        data.context = context;
+        data.userData = decompressor.userData;
+
+        if (decompressor.decode == NULL) result = 3;
+        else if ((decompressor.capabilities & RRES_CODEC_IN_PLACE) != 0)
         {
-            case RRES_COMP_NONE: unpackedData = decryptedData; break;
-            case RRES_COMP_DEFLATE:
-            {
-                int uncompDataSize = 0;
+            data.outputBuffer = chunk->data.raw;
+            data.output = decryptedData;
+            data.outputCapacity = data.inputSize;
+        }
+        else if (decompressor.outputBound != NULL)
+        {
+            // NOTE: Data header size is unknown, raw data is copied on chunk data loading if not aligned
+            data.outputCapacity = decompressor.outputBound(chunk->info, decryptedData);
+            data.output = (unsigned char *)rresAllocUnpackedData(data.outputCapacity, 0, chunk->info.flags, &data.outputBuffer);
 
-                // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
-                uncompData = DecompressData(decryptedData, chunk->info.packedSize, &uncompDataSize);
+            if (data.output == NULL) result = 4;
+        }
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
-                {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (DEFLATE)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
-                else
-                {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
+        if (result == 0) result = decompressor.decode(&data);
+        if ((result == 0) && ((data.output == NULL) || (data.outputSize == 0) || ((data.outputCapacity > 0) && (data.outputSize > data.outputCapacity)))) result = 4;
 
-                // Security check, uncompDataSize must match the provided chunk->baseSize
-                if (uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
-#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
-            case RRES_COMP_LZ4:
-            {
-                int uncompDataSize = 0;
-                uncompData = (unsigned char *)RRES_CALLOC(chunk->info.baseSize, 1);
-                uncompDataSize = LZ4_decompress_safe((char *)decryptedData, (char *)uncompData, chunk->info.packedSize, chunk->info.baseSize);
+        if (result == 0)
+        {
+            unpackedBuffer = data.outputBuffer;
+            unpackedData = data.output;
+            chunk->info.packedSize = data.outputSize;
+            RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (%s)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3], decompressor.name);
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
-                {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (LZ4)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
-                else
-                {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-                }
+            // WARNING: Decompression could be successful but not the original message size returned
+            if (data.outputSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
+        }
+        else
+        {
+            if (data.outputBuffer != chunk->data.raw) RRES_FREE(data.outputBuffer);
 
-                // WARNING: Decompression could be successful but not the original message size returned
-                if (uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
+            if (result == 3) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            else if (result == 8) RRES_LOG("RRES: WARNING: %c%c%c%c: Archive compression dictionary not loaded\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+    }
+
+    if ((result == 0) && (chunk->info.compType != RRES_COMP_NONE))
+    {
+        // Data is not compressed any more, register it
+        chunk->info.compType = RRES_COMP_NONE;
+        chunk->info.flags &= ~(RRES_FLAG_STREAM_BLOCKS | RRES_FLAG_INDEPENDENT_BLOCKS | RRES_FLAG_DICTIONARY);
+        updateProps = true;
+    }
+
+    // Update chunk->data.propCount and chunk->data.props if required
+    if ((result == 0) && updateProps && (unpackedData != NULL))
+    {
+        // Data is decompressed/decrypted into unpacked buffer but data.propCount and data.props[] are still empty,
+        // they point into the unpacked buffer (that contains everything), so no data is copied
+        // NOTE: If unpacked buffer is the packed data buffer (decrypted in place), it must not be unloaded
+        if (unpackedBuffer == chunk->data.raw) chunk->data.raw = NULL;
+
+        rresUnloadResourceChunkData(chunk->data);
+        chunk->data = rresLoadResourceChunkDataInPlace(unpackedBuffer, unpackedData, chunk->info.baseSize, chunk->info.flags);
+    }
+    else if (unpackedBuffer != chunk->data.raw) RRES_FREE(unpackedBuffer);
+
+    return result;
+}
+
+// Unpack resource chunk data while it's read from archive (streaming decryption/decompression)
+// NOTE 1: Function return 0 on success or an error code on failure, chunk is only provided on success
+// NOTE 2: Packed data is read in RRES_UNPACK_WINDOW_SIZE pieces, decrypted in place (in calling thread) and
+// decompressed straight into unpacked data, data is authenticated and CRC32 checked once all data is read,
+// on failure unpacked data is discarded
+int UnpackResourceChunkStream(rresArchive *archive, int rresId, rresUnpackContext *context, rresResourceChunk *chunk)
+{
+    int result = 0;
+
+    // Result error codes: Same as UnpackResourceChunkEx() and:
+    //  6 - Resource chunk not found or data corrupted (CRC32 does not match)
+
+    rresUnpackContext defaultContext = { 0 };
+    rresUnpackContext *unpackContext = context;
+
+    if (context == NULL)
+    {
+        defaultContext = LoadUnpackContext(rresGetCipherPassword());
+        defaultContext.keyCache = cipherKeyCache;
+        defaultContext.threadCount = unpackThreadCount;
+        defaultContext.dictionary = archiveDictionary;
+        unpackContext = &defaultContext;
+    }
+
+    rresResourceChunk unpacked = { 0 };
+    rresResourceChunkInfo info = { 0 };
+    rresChunkReader *reader = rresOpenChunkReader(archive, rresId, &info);
+
+    // Check if chunk data can be decrypted and decompressed progressively (codecs with RRES_CODEC_STREAMING)
+    bool streamed = (info.compType == RRES_COMP_NONE);
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    bool streamedLZ4 = (info.compType == RRES_COMP_LZ4) && ((GetDecompressor(RRES_COMP_LZ4).capabilities & RRES_CODEC_STREAMING) != 0);
+    if (streamedLZ4 && ((info.flags & RRES_FLAG_STREAM_BLOCKS) != 0)) streamed = true;
+
+    // NOTE: Independent blocks are decompressed one after the other while streaming,
+    // if multiple threads are available, packed data is loaded and blocks are decompressed in parallel
+    bool independentBlocks = ((info.flags & (RRES_FLAG_STREAM_BLOCKS | RRES_FLAG_INDEPENDENT_BLOCKS)) == RRES_FLAG_INDEPENDENT_BLOCKS);
+    if (streamedLZ4 && independentBlocks && (unpackContext->threadCount <= 1)) streamed = true;
 #endif
-            case RRES_COMP_QOI:
+    if ((info.cipherType != RRES_CIPHER_NONE) && ((GetDecryptor(info.cipherType).capabilities & RRES_CODEC_STREAMING) == 0)) streamed = false;
+
+    if (reader == NULL) result = 6;
+    else if (!streamed)
+    {
+        // Chunk data can not be decompressed progressively, packed data is loaded and unpacked
+        rresCloseChunkReader(reader);
+
+        unpacked = rresLoadArchiveResourceChunk(archive, rresId);
+
+        if (unpacked.data.raw == NULL) result = 6;
+        else if ((unpacked.info.compType != RRES_COMP_NONE) || (unpacked.info.cipherType != RRES_CIPHER_NONE)) result = UnpackResourceChunkEx(&unpacked, unpackContext);
+    }
+    else
+    {
+        rresUnpackStream stream = { 0 };
+        void *unpackedBuffer = NULL;            // Unpacked data allocation
+        unsigned char *unpackedData = NULL;     // Unpacked data: propCount + props[] (+ padding) + data, contained in unpackedBuffer
+        unsigned char header[256] = { 0 };      // Chunk data header, required to allocate unpacked data with raw data aligned
+        unsigned int headerSize = 0;
+
+        result = OpenUnpackStream(&stream, reader, info, unpackContext);
+
+        if (result == 0)
+        {
+            if (info.compType == RRES_COMP_NONE)
             {
-                int uncompDataSize = 0;
-                qoi_desc desc = { 0 };
+                // Decrypted data is read straight into unpacked data, once header is available
+                unsigned int headerBytes = (info.baseSize < 256)? (unsigned int)info.baseSize : 256;
 
-                // TODO: WARNING: Possible issue with allocators: QOI_MALLOC() vs RRES_MALLOC()
-                uncompData = (unsigned char *)qoi_decode(decryptedData, chunk->info.packedSize, &desc, 0);
-                uncompDataSize = (desc.width*desc.height*desc.channels) + 20;   // Add the 20 bytes of (propCount + props[4])
+                if ((stream.dataSize == info.baseSize) && ReadUnpackStream(&stream, header, headerBytes))
+                {
+                    headerSize = rresGetDataHeaderSize(header, headerBytes, info.flags);
+                    unpackedData = (unsigned char *)rresAllocUnpackedData(info.baseSize, headerSize, info.flags, &unpackedBuffer);
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
+                    if (unpackedData != NULL)
+                    {
+                        memcpy(unpackedData, header, headerBytes);
+                        if (!ReadUnpackStream(&stream, unpackedData + headerBytes, info.baseSize - headerBytes)) result = 6;
+                    }
+                    else result = 6;
+                }
+                else result = 6;
+            }
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+            else
+            {
+                // LZ4 linked blocks: compressed size (4 bytes) + block, every block is decompressed
+                // straight into unpacked data, previous decompressed data is the dictionary
+                // LZ4 independent blocks: block table + blocks, every block is decompressed into its place
+                LZ4_streamDecode_t lz4Stream = { 0 };
+                LZ4_setStreamDecode(&lz4Stream, NULL, 0);
+
+                unsigned char *block = NULL;
+                unsigned int blockCapacity = 0;
+                unsigned long long uncompDataSize = 0;
+
+                unsigned long long *blockOffsets = NULL;
+                unsigned int blockCount = 0;
+                unsigned int blockIndex = 0;
+                unsigned int independentBlockSize = 0;
+
+                if (info.baseSize > 0x7fffffff) result = 4;
+                else if (independentBlocks)
                 {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
-                    RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (QOI)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                    // Block table is read first: blockSize (4 bytes) + blockCount (4 bytes) + blocks compressed size
+                    unsigned int tableHeader[2] = { 0 };
+
+                    if (ReadUnpackStream(&stream, tableHeader, 8) && (tableHeader[1] > 0) && ((8 + 4ULL*tableHeader[1]) <= stream.dataSize))
+                    {
+                        unsigned char *table = (unsigned char *)RL_MALLOC(8 + 4ULL*tableHeader[1]);
+
+                        if (table != NULL)
+                        {
+                            memcpy(table, tableHeader, 8);
+                            if (ReadUnpackStream(&stream, table + 8, 4ULL*tableHeader[1])) blockOffsets = LoadBlockOffsets(table, stream.dataSize, info.baseSize, &independentBlockSize, &blockCount);
+                            RL_FREE(table);
+                        }
+                    }
+
+                    if (blockOffsets == NULL) result = 4;
                 }
-                else
+
+                while ((result == 0) && (uncompDataSize < info.baseSize))
                 {
-                    result = 4;    // Decompression process failed
-                    RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                    unsigned int blockSize = 0;
+
+                    if (independentBlocks)
+                    {
+                        if (blockIndex < blockCount) blockSize = (unsigned int)(blockOffsets[blockIndex + 1] - blockOffsets[blockIndex]);
+                    }
+                    else if (!ReadUnpackStream(&stream, &blockSize, 4)) blockSize = 0;
+
+                    if ((blockSize == 0) || (blockSize > (stream.dataSize - stream.readSize + stream.windowSize - stream.windowPosition)))
+                    {
+                        result = 4;
+                        break;
+                    }
+
+                    if (blockSize > blockCapacity)
+                    {
+                        RL_FREE(block);
+                        block = (unsigned char *)RL_MALLOC(blockSize);
+                        blockCapacity = (block != NULL)? blockSize : 0;
+                    }
+
+                    if ((block == NULL) || !ReadUnpackStream(&stream, block, blockSize))
+                    {
+                        result = 4;
+                        break;
+                    }
+
+                    if (unpackedData == NULL)
+                    {
+                        // Decompress data header first, so data is decompressed with raw data aligned
+                        int headerBytes = LZ4_decompress_safe_partial((char *)block, (char *)header, blockSize, (info.baseSize < 256)? (int)info.baseSize : 256, 256);
+                        headerSize = (headerBytes > 0)? rresGetDataHeaderSize(header, headerBytes, info.flags) : 0;
+
+                        unpackedData = (unsigned char *)rresAllocUnpackedData(info.baseSize, headerSize, info.flags, &unpackedBuffer);
+                        if (unpackedData == NULL) result = 4;
+                    }
+
+                    int blockDataSize = -1;
+
+                    if ((result == 0) && independentBlocks)
+                    {
+                        int expectedSize = ((info.baseSize - uncompDataSize) < independentBlockSize)? (int)(info.baseSize - uncompDataSize) : (int)independentBlockSize;
+                        blockDataSize = LZ4_decompress_safe((char *)block, (char *)unpackedData + uncompDataSize, blockSize, expectedSize);
+                        if (blockDataSize != expectedSize) blockDataSize = -1;
+                        blockIndex++;
+                    }
+                    else if (result == 0) blockDataSize = LZ4_decompress_safe_continue(&lz4Stream, (char *)block, (char *)unpackedData + uncompDataSize, blockSize, (int)(info.baseSize - uncompDataSize));
+
+                    if (blockDataSize > 0) uncompDataSize += blockDataSize;
+                    else result = 4;
                 }
 
-                if (uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
-            } break;
-            default:
+                RL_FREE(blockOffsets);
+                RL_FREE(block);
+            }
+#endif
+            // Remaining data is read and decrypted data is authenticated, CRC32 is verified once all packed data is read
+            bool authenticated = CloseUnpackStream(&stream);
+            bool verified = rresCloseChunkReader(reader);
+
+            if (!verified) result = 6;
+            else if (!authenticated)
             {
-                result = 3;
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            } break;
+                result = 2;    // Data was not authenticated, wrong password or message corrupted
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+            }
+            else if (result == 4) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+        }
+        else rresCloseChunkReader(reader);
+
+        if (result == 0)
+        {
+            // Data is not compressed/encrypted any more, register it
+            unpacked.info = info;
+            unpacked.info.compType = RRES_COMP_NONE;
+            unpacked.info.cipherType = RRES_CIPHER_NONE;
+            unpacked.info.flags &= ~(RRES_FLAG_ARCHIVE_KEY | RRES_FLAG_STREAM_BLOCKS | RRES_FLAG_INDEPENDENT_BLOCKS);
+            unpacked.info.packedSize = info.baseSize;
+            unpacked.data = rresLoadResourceChunkDataInPlace(unpackedBuffer, unpackedData, info.baseSize, unpacked.info.flags);
+
+            RRES_LOG("RRES: %c%c%c%c: Data unpacked successfully (streaming)\n", info.type[0], info.type[1], info.type[2], info.type[3]);
         }
+        else RRES_FREE(unpackedBuffer);
     }
 
-    if ((result == 0) && (chunk->info.compType != RRES_COMP_NONE))
+    if (context == NULL)
     {
-        // Data is not encrypted any more, register it
-        chunk->info.compType = RRES_COMP_NONE;
-        updateProps = true;
+        // Keep derived keys cache and dictionary, only scratch memory is freed
+        cipherKeyCache = defaultContext.keyCache;
+        defaultContext.keyCache = NULL;
+        defaultContext.dictionary = NULL;
+        UnloadUnpackContext(defaultContext);
     }
 
-    // Update chunk->data.propCount and chunk->data.props if required
-    if (updateProps && (unpackedData != NULL))
+    if (result == 0) *chunk = unpacked;
+    else rresUnloadResourceChunk(unpacked);
+
+    return result;
+}
+
+// Unpack resource chunk raw data range (partial decompression)
+// NOTE 1: Function return 0 on success or an error code on failure, range is relative to chunk raw data
+// (propCount + props[] not considered) and it's copied into provided buffer (size bytes)
+// NOTE 2: Not encrypted chunks stored not compressed or LZ4 compressed with RRES_FLAG_INDEPENDENT_BLOCKS are read
+// partially, only the blocks containing the range are read and decompressed (in parallel, context->threadCount),
+// CRC32 can not be checked on partial reads; encrypted data must be authenticated, so encrypted chunks (and
+// chunks with other compression layouts) are fully unpacked with UnpackResourceChunkStream()
+int UnpackResourceChunkRange(rresArchive *archive, int rresId, rresUnpackContext *context, unsigned long long offset, unsigned long long size, void *buffer)
+{
+    int result = 0;
+
+    // Result error codes: Same as UnpackResourceChunkStream() and:
+    //  7 - Requested range is out of resource chunk raw data
+
+    rresResourceChunkInfo info = { 0 };
+    rresChunkReader *reader = rresOpenChunkReader(archive, rresId, &info);
+
+    bool partial = (info.cipherType == RRES_CIPHER_NONE) && (info.compType == RRES_COMP_NONE);
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    bool independentBlocks = ((info.flags & (RRES_FLAG_STREAM_BLOCKS | RRES_FLAG_INDEPENDENT_BLOCKS)) == RRES_FLAG_INDEPENDENT_BLOCKS);
+    if ((info.cipherType == RRES_CIPHER_NONE) && (info.compType == RRES_COMP_LZ4) && independentBlocks &&
+        ((GetDecompressor(RRES_COMP_LZ4).capabilities & RRES_CODEC_PARTIAL) != 0)) partial = true;
+#endif
+
+    if (reader == NULL) result = 6;
+    else if (!partial)
+    {
+        // Chunk data can not be read partially, full chunk is unpacked
+        rresCloseChunkReader(reader);
+
+        rresResourceChunk chunk = { 0 };
+        result = UnpackResourceChunkStream(archive, rresId, context, &chunk);
+
+        if (result == 0)
+        {
+            if ((offset > chunk.data.rawSize) || (size > (chunk.data.rawSize - offset))) result = 7;
+            else if (size > 0) memcpy(buffer, (unsigned char *)chunk.data.raw + offset, (size_t)size);
+        }
+
+        rresUnloadResourceChunk(chunk);
+    }
+    else
     {
-        // Data is decompressed/decrypted into chunk->data.raw but data.propCount and data.props[] are still empty, 
-        // they must be filled with the just updated chunk->data.raw (that contains everything)
-        chunk->data.propCount = ((int *)unpackedData)[0];
+        unsigned char header[256] = { 0 };      // Chunk data header, required to locate raw data
+        unsigned int headerSize = 0;
 
-        if (chunk->data.propCount > 0)
+        if (info.compType == RRES_COMP_NONE)
         {
-            chunk->data.props = (unsigned int *)RRES_CALLOC(chunk->data.propCount, sizeof(int));
-            for (unsigned int i = 0; i < chunk->data.propCount; i++) chunk->data.props[i] = ((int *)unpackedData)[1 + i];
+            // Not compressed data is read straight into buffer
+            unsigned int headerBytes = (info.packedSize < 256)? (unsigned int)info.packedSize : 256;
+
+            if (rresReadChunkDataAt(reader, 0, header, headerBytes)) headerSize = rresGetDataHeaderSize(header, headerBytes, info.flags);
+
+            if (headerSize == 0) result = 6;
+            else if ((offset > (info.packedSize - headerSize)) || (size > (info.packedSize - headerSize - offset))) result = 7;
+            else if ((size > 0) && !rresReadChunkDataAt(reader, headerSize + offset, buffer, size)) result = 6;
         }
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+        else
+        {
+            // LZ4 independent blocks: block table is read first, then only the blocks containing the range
+            unsigned int tableHeader[2] = { 0 };
+            unsigned int blockSize = 0;
+            unsigned int blockCount = 0;
+            unsigned long long *blockOffsets = NULL;
+
+            if (rresReadChunkDataAt(reader, 0, tableHeader, 8) && (tableHeader[1] > 0) && ((8 + 4ULL*tableHeader[1]) <= info.packedSize))
+            {
+                unsigned char *table = (unsigned char *)RL_MALLOC(8 + 4ULL*tableHeader[1]);
+
+                if ((table != NULL) && rresReadChunkDataAt(reader, 0, table, 8 + 4ULL*tableHeader[1])) blockOffsets = LoadBlockOffsets(table, info.packedSize, info.baseSize, &blockSize, &blockCount);
+
+                RL_FREE(table);
+            }
+
+            // Decompress data header from first block, so raw data range can be located
+            unsigned int firstBlockSize = (blockOffsets != NULL)? (unsigned int)(blockOffsets[1] - blockOffsets[0]) : 0;
+            unsigned char *block = (firstBlockSize > 0)? (unsigned char *)RL_MALLOC(firstBlockSize) : NULL;
+
+            if ((block != NULL) && rresReadChunkDataAt(reader, blockOffsets[0], block, firstBlockSize))
+            {
+                int headerBytes = LZ4_decompress_safe_partial((char *)block, (char *)header, firstBlockSize, (info.baseSize < 256)? (int)info.baseSize : 256, 256);
+                headerSize = (headerBytes > 0)? rresGetDataHeaderSize(header, headerBytes, info.flags) : 0;
+            }
+
+            RL_FREE(block);
+
+            if (headerSize == 0) result = 4;
+            else if ((offset > (info.baseSize - headerSize)) || (size > (info.baseSize - headerSize - offset))) result = 7;
+            else if (size > 0)
+            {
+                // Blocks containing the range are read at once and decompressed in parallel
+                unsigned long long start = headerSize + offset;
+                unsigned int firstBlock = (unsigned int)(start/blockSize);
+                unsigned int lastBlock = (unsigned int)((start + size - 1)/blockSize);
+                unsigned long long firstPosition = (unsigned long long)firstBlock*blockSize;
+                unsigned long long lastPosition = (((unsigned long long)lastBlock + 1)*blockSize < info.baseSize)? ((unsigned long long)lastBlock + 1)*blockSize : info.baseSize;
+
+                unsigned long long compSize = blockOffsets[lastBlock + 1] - blockOffsets[firstBlock];
+                unsigned char *compData = (unsigned char *)RL_MALLOC((size_t)compSize);
+                unsigned char *blocksData = (unsigned char *)RL_MALLOC((size_t)(lastPosition - firstPosition));
+
+                if ((compData != NULL) && (blocksData != NULL) && rresReadChunkDataAt(reader, blockOffsets[firstBlock], compData, compSize))
+                {
+                    rresLZ4BlockJobs jobs = { 0 };
+                    jobs.data = compData;
+                    jobs.dataOffset = blockOffsets[firstBlock];
+                    jobs.blockOffsets = blockOffsets;
+                    jobs.firstBlock = firstBlock;
+                    jobs.blockSize = blockSize;
+                    jobs.baseSize = info.baseSize;
+                    jobs.output = blocksData;
+
+                    if (DecompressLZ4BlockJobs(&jobs, lastBlock - firstBlock + 1, (context != NULL)? context->threadCount : unpackThreadCount)) memcpy(buffer, blocksData + (start - firstPosition), (size_t)size);
+                    else result = 4;
+                }
+                else result = 4;
+
+                RL_FREE(blocksData);
+                RL_FREE(compData);
+            }
+
+            RL_FREE(blockOffsets);
 
-        // Move chunk->data.raw pointer (chunk->data.propCount*sizeof(int)) positions
-        void *raw = RRES_CALLOC(chunk->info.baseSize - 20, 1);
-        if (raw != NULL) memcpy(raw, ((unsigned char *)unpackedData) + 20, chunk->info.baseSize - 20);
-        RRES_FREE(chunk->data.raw);
-        chunk->data.raw = raw;
-        RL_FREE(unpackedData);
+            if (result == 4) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+        }
+#endif
+        // NOTE: CRC32 is not checked, packed data has been partially read
+        rresCloseChunkReader(reader);
     }
 
     return result;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+// Load unpacked resource chunk through resource cache
+// NOTE: On cache miss, chunk is loaded from archive and unpacked progressively (UnpackResourceChunkStream()),
+// only the unpacked chunk is cached, so following requests skip data reading, CRC32 check, decompression and decryption
+const rresResourceChunk *LoadResourceChunkCached(rresResourceCache *cache, rresArchive *archive, int rresId)
+{
+    const rresResourceChunk *cached = rresGetCachedResourceChunk(cache, archive, rresId, true);
 
-// Load data chunk: RRES_DATA_LINK
-static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+    if ((cached == NULL) && (cache != NULL))
+    {
+        rresResourceChunk chunk = { 0 };
+        int result = UnpackResourceChunkStream(archive, rresId, NULL, &chunk);
+
+        // NOTE: Chunks not found, corrupted or not unpacked are not cached
+        if ((result == 0) && (chunk.data.raw != NULL)) cached = rresCacheResourceChunk(cache, archive, rresId, true, chunk);
+        else rresUnloadResourceChunk(chunk);
+    }
+
+    return cached;
+}
+
+// Pack resource chunk data (compress/encrypt)
+// NOTE 1: Packed data follows the same layout expected by UnpackResourceChunk():
+//  - Compression is applied to full chunk data: propCount + props[] (+ padding) + raw data
+//    LZ4 compressed data is split in linked blocks if RRES_FLAG_STREAM_BLOCKS is set (streaming decompression)
+//    or in RRES_LZ4_BLOCK_SIZE independent blocks if RRES_FLAG_INDEPENDENT_BLOCKS is set (parallel/partial decompression),
+//    small LZ4 chunks are compressed with context dictionary if available (RRES_FLAG_DICTIONARY, data header not compressed)
+//    QOI compression keeps chunk data header uncompressed, only raw pixel data is QOI encoded (RGB/RGBA images),
+//    in RRES_QOI_STRIPE_SIZE horizontal stripes with a block table if RRES_FLAG_INDEPENDENT_BLOCKS is set (parallel decoding)
+//    RLE compression keeps chunk data header uncompressed, raw data is RLE encoded as pixels (images) or bytes
+//  - Encryption is applied to compressed data, AES: data + salt[16] + MD5[16], XChaCha20-Poly1305: data + salt[16] + nonce[24] + MAC[16]
+// NOTE 2: Packed data is allocated with RRES_MALLOC(), it's freed by rres.h once written
+bool PackResourceChunk(rresPackItem *item, void *context)
 {
-    char fullFilePath[2048] = { 0 };
-    void *data = NULL;
-    *size = 0;
+    rresPackContext *packContext = (rresPackContext *)context;
+    bool result = true;
 
-    // Get external link filepath
-    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
-    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+    item->packedData = NULL;
 
-    // Get base directory to append filepath if not provided by user
-    if (baseDir == NULL) baseDir = GetApplicationDirectory();
-    
-    strcpy(fullFilePath, baseDir);
-    strcat(fullFilePath, linkFilePath);
+    // Encryption requires a pack context with a password (or an archive key)
+    if ((item->info.cipherType != RRES_CIPHER_NONE) && ((packContext == NULL) || (!packContext->useArchiveKey && (packContext->password == NULL))))
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption requires a pack context with password\n", item->info.type[0], item->info.type[1], item->info.type[2], item->info.type[3]);
+        return false;
+    }
 
-    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+    // NOTE: Only LZ4 compressed data can be split in blocks (QOI images in independent stripes), independent blocks are used if both layouts are requested
+    if (item->info.compType != RRES_COMP_LZ4) item->info.flags &= ~RRES_FLAG_STREAM_BLOCKS;
+    if ((item->info.compType != RRES_COMP_LZ4) && (item->info.compType != RRES_COMP_QOI)) item->info.flags &= ~RRES_FLAG_INDEPENDENT_BLOCKS;
+    if ((item->info.flags & RRES_FLAG_INDEPENDENT_BLOCKS) != 0) item->info.flags &= ~RRES_FLAG_STREAM_BLOCKS;
 
-    if (FileExists(fullFilePath))
+    // NOTE: Small chunks are compressed with archive dictionary (if available), LZ4 single block only
+    item->info.flags &= ~RRES_FLAG_DICTIONARY;
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    bool useDictionary = (packContext != NULL) && (packContext->dictionary != NULL) && (item->info.compType == RRES_COMP_LZ4) &&
+        ((item->info.flags & (RRES_FLAG_STREAM_BLOCKS | RRES_FLAG_INDEPENDENT_BLOCKS)) == 0) && (item->data.rawSize <= RRES_DICTIONARY_CHUNK_SIZE);
+#endif
+
+    // Get chunk base data: propCount + props[] (+ padding size + padding) + raw data
+    // NOTE: Padding aligns raw data to the start of unpacked data
+    unsigned int padding = rresGetDataPaddingSize(0, item->data.propCount, item->info.flags);
+    unsigned int headerSize = sizeof(int) + item->data.propCount*sizeof(int);
+    if ((item->info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0) headerSize += (sizeof(int) + padding);
+
+    // NOTE: Codecs and packed sizes are limited to int, bigger chunks can not be packed
+    if ((item->data.rawSize > RRES_PACK_MAX_SIZE) || ((headerSize + item->data.rawSize) > RRES_PACK_MAX_SIZE))
     {
-        // Load external file as raw data
-        // NOTE: We check if file is a text file to allow automatic line-endings processing
-        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
-        {
-            data = LoadFileText(fullFilePath);
-            *size = TextLength((char *)data);
-        }
-        else data = LoadFileData(fullFilePath, (int *)size);
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size exceeds packing maximum size (%i bytes)\n", item->info.type[0], item->info.type[1], item->info.type[2], item->info.type[3], RRES_PACK_MAX_SIZE);
+        return false;
+    }
 
-        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    unsigned int baseSize = headerSize + (unsigned int)item->data.rawSize;
+    unsigned char *baseData = (unsigned char *)RL_CALLOC(baseSize, 1);
+
+    if (baseData == NULL)
+    {
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data could not be allocated for packing\n", item->info.type[0], item->info.type[1], item->info.type[2], item->info.type[3]);
+        return false;
     }
-    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
 
-    return data;
-}
+    memcpy(baseData, &item->data.propCount, sizeof(int));
+    if (item->data.propCount > 0) memcpy(baseData + sizeof(int), item->data.props, item->data.propCount*sizeof(int));
+    if ((item->info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0) memcpy(baseData + sizeof(int) + item->data.propCount*sizeof(int), &padding, sizeof(int));
+    if (item->data.rawSize > 0) memcpy(baseData + headerSize, item->data.raw, (size_t)item->data.rawSize);
 
-// Load data chunk: RRES_DATA_RAW
-// NOTE: This chunk can be used raw files embedding or other binary blobs
-static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
-{
-    void *rawData = NULL;
+    // STEP 1: Data compression
+    //-------------------------------------------------------------------------------------
+    unsigned char *compData = NULL;
+    int compDataSize = 0;
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    switch (item->info.compType)
+    {
+        case RRES_COMP_NONE: compData = baseData; compDataSize = baseSize; break;
+        case RRES_COMP_DEFLATE:
+        {
+            // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
+            compData = CompressData(baseData, baseSize, &compDataSize);
+        } break;
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+        case RRES_COMP_LZ4:
+        {
+            if ((item->info.flags & RRES_FLAG_STREAM_BLOCKS) != 0)
+            {
+                // Linked blocks: compressed size (4 bytes) + block, every block uses previous data as dictionary
+                unsigned int blockCount = (baseSize + RRES_STREAM_BLOCK_SIZE - 1)/RRES_STREAM_BLOCK_SIZE;
+                int bound = blockCount*(4 + LZ4_COMPRESSBOUND(RRES_STREAM_BLOCK_SIZE));
+                LZ4_stream_t *lz4Stream = LZ4_createStream();
+                compData = (unsigned char *)RL_MALLOC(bound);
+
+                if ((compData != NULL) && (lz4Stream != NULL))
+                {
+                    for (unsigned int offset = 0; offset < baseSize; offset += RRES_STREAM_BLOCK_SIZE)
+                    {
+                        int blockSize = ((baseSize - offset) < RRES_STREAM_BLOCK_SIZE)? (int)(baseSize - offset) : RRES_STREAM_BLOCK_SIZE;
+                        int blockCompSize = LZ4_compress_fast_continue(lz4Stream, (const char *)baseData + offset, (char *)compData + compDataSize + 4, blockSize, bound - compDataSize - 4, 1);
+
+                        if (blockCompSize <= 0)
+                        {
+                            compDataSize = 0;
+                            break;
+                        }
+
+                        memcpy(compData + compDataSize, &blockCompSize, 4);
+                        compDataSize += (4 + blockCompSize);
+                    }
+                }
+
+                LZ4_freeStream(lz4Stream);
+            }
+            else if ((item->info.flags & RRES_FLAG_INDEPENDENT_BLOCKS) != 0)
+            {
+                // Independent blocks: block table (blockSize, blockCount, blocks compressed size) + blocks,
+                // every block is compressed without dictionary so it can be decompressed on its own
+                unsigned int blockSize = RRES_LZ4_BLOCK_SIZE;
+                unsigned int blockCount = (baseSize + RRES_LZ4_BLOCK_SIZE - 1)/RRES_LZ4_BLOCK_SIZE;
+                int tableSize = 8 + 4*blockCount;
+                int bound = tableSize + blockCount*LZ4_COMPRESSBOUND(RRES_LZ4_BLOCK_SIZE);
+                compData = (unsigned char *)RL_MALLOC(bound);
+
+                if (compData != NULL)
+                {
+                    memcpy(compData, &blockSize, 4);
+                    memcpy(compData + 4, &blockCount, 4);
+                    compDataSize = tableSize;
+
+                    for (unsigned int i = 0; i < blockCount; i++)
+                    {
+                        unsigned int offset = i*RRES_LZ4_BLOCK_SIZE;
+                        int blockDataSize = ((baseSize - offset) < RRES_LZ4_BLOCK_SIZE)? (int)(baseSize - offset) : RRES_LZ4_BLOCK_SIZE;
+                        int blockCompSize = LZ4_compress_default((const char *)baseData + offset, (char *)compData + compDataSize, blockDataSize, bound - compDataSize);
+
+                        if (blockCompSize <= 0)
+                        {
+                            compDataSize = 0;
+                            break;
+                        }
+
+                        memcpy(compData + 8 + 4*i, &blockCompSize, 4);
+                        compDataSize += blockCompSize;
+                    }
+                }
+            }
+            else if (useDictionary)
+            {
+                // Dictionary chunk: dictionaryId (4 bytes) + data header (not compressed) + raw data compressed with dictionary
+                int bound = 4 + headerSize + LZ4_compressBound((int)item->data.rawSize);
+                LZ4_stream_t *lz4Stream = LZ4_createStream();
+                compData = (unsigned char *)RL_MALLOC(bound);
+
+                if ((compData != NULL) && (lz4Stream != NULL))
+                {
+                    LZ4_loadDict(lz4Stream, (const char *)packContext->dictionary, (int)packContext->dictionarySize);
+
+                    memcpy(compData, &packContext->dictionaryId, 4);
+                    memcpy(compData + 4, baseData, headerSize);
+                    int rawCompSize = LZ4_compress_fast_continue(lz4Stream, (const char *)baseData + headerSize, (char *)compData + 4 + headerSize, (int)item->data.rawSize, bound - 4 - headerSize, 1);
+
+                    if (rawCompSize > 0)
+                    {
+                        compDataSize = 4 + headerSize + rawCompSize;
+                        item->info.flags |= RRES_FLAG_DICTIONARY;
+                    }
+                }
+
+                LZ4_freeStream(lz4Stream);
+            }
+            else
+            {
+                int bound = LZ4_compressBound(baseSize);
+                compData = (unsigned char *)RL_MALLOC(bound);
+                if (compData != NULL) compDataSize = LZ4_compress_default((const char *)baseData, (char *)compData, baseSize, bound);
+            }
+        } break;
+#endif
+        case RRES_COMP_RLE:
+        {
+            // NOTE: Image pixels are encoded as elements (pixel stride), so runs of pixels are detected
+            // on multi-byte pixel formats, other data types (and compressed pixel formats) are encoded as bytes
+            unsigned int stride = 1;
+            if ((rresGetDataType(item->info.type) == RRES_DATA_IMAGE) && (item->data.propCount >= 3)) stride = GetPixelSize(item->data.props[2]);
+            if ((stride == 0) || (stride > RRES_RLE_MAX_STRIDE)) stride = 1;
+
+            // NOTE: RLE worst case overhead is one byte every 64 bytes (long literal runs headers)
+            unsigned long long bound = headerSize + item->data.rawSize + item->data.rawSize/64 + 32;
+            compData = (unsigned char *)RL_MALLOC((size_t)bound);
+
+            if (compData != NULL)
+            {
+                memcpy(compData, baseData, headerSize);
+                unsigned long long rleSize = CompressRLEData(baseData + headerSize, item->data.rawSize, stride, compData + headerSize, bound - headerSize);
+                if (rleSize > 0) compDataSize = (int)(headerSize + rleSize);
+            }
+        } break;
+        case RRES_COMP_QOI:
+        {
+            // NOTE: Only RGB/RGBA images can be QOI encoded
+            if ((rresGetDataType(item->info.type) == RRES_DATA_IMAGE) && (item->data.propCount >= 3) &&
+                ((item->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R8G8B8) || (item->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)))
+            {
+                qoi_desc desc = { 0 };
+                desc.width = item->data.props[0];
+                desc.height = item->data.props[1];
+                desc.channels = (item->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R8G8B8)? 3 : 4;
+                desc.colorspace = QOI_SRGB;
+
+                unsigned int rowSize = desc.width*desc.channels;
+
+                if (((item->info.flags & RRES_FLAG_INDEPENDENT_BLOCKS) != 0) && (rowSize > 0) && (desc.height > 0))
+                {
+                    // Independent stripes: block table (blockSize, blockCount, stripes size) + stripes, every stripe is
+                    // a QOI image of stripeHeight rows (last one could be smaller), so stripes can be decoded in parallel
+                    unsigned int stripeHeight = (rowSize < RRES_QOI_STRIPE_SIZE)? RRES_QOI_STRIPE_SIZE/rowSize : 1;
+                    unsigned int blockSize = stripeHeight*rowSize;
+                    unsigned int blockCount = (desc.height + stripeHeight - 1)/stripeHeight;
+                    unsigned char **stripes = (unsigned char **)RL_CALLOC(blockCount, sizeof(unsigned char *));
+                    int *stripeSizes = (int *)RL_CALLOC(blockCount, sizeof(int));
+                    int stripesSize = 8 + 4*blockCount;
+                    bool encoded = (stripes != NULL) && (stripeSizes != NULL);
+
+                    for (unsigned int i = 0; encoded && (i < blockCount); i++)
+                    {
+                        qoi_desc stripeDesc = desc;
+                        stripeDesc.height = ((desc.height - i*stripeHeight) < stripeHeight)? (desc.height - i*stripeHeight) : stripeHeight;
+
+                        stripes[i] = (unsigned char *)qoi_encode(baseData + headerSize + (unsigned long long)i*blockSize, &stripeDesc, &stripeSizes[i]);
+
+                        if (stripes[i] == NULL) encoded = false;
+                        else stripesSize += stripeSizes[i];
+                    }
+
+                    if (encoded) compData = (unsigned char *)RL_MALLOC(headerSize + stripesSize);
+
+                    if (compData != NULL)
+                    {
+                        memcpy(compData, baseData, headerSize);
+                        memcpy(compData + headerSize, &blockSize, 4);
+                        memcpy(compData + headerSize + 4, &blockCount, 4);
+                        compDataSize = headerSize + 8 + 4*blockCount;
+
+                        for (unsigned int i = 0; i < blockCount; i++)
+                        {
+                            memcpy(compData + headerSize + 8 + 4*i, &stripeSizes[i], 4);
+                            memcpy(compData + compDataSize, stripes[i], stripeSizes[i]);
+                            compDataSize += stripeSizes[i];
+                        }
+                    }
+
+                    for (unsigned int i = 0; (stripes != NULL) && (i < blockCount); i++) RL_FREE(stripes[i]);
+                    RL_FREE(stripes);
+                    RL_FREE(stripeSizes);
+                }
+                else
+                {
+                    item->info.flags &= ~RRES_FLAG_INDEPENDENT_BLOCKS;
+
+                    int qoiSize = 0;
+                    unsigned char *qoiData = (unsigned char *)qoi_encode(baseData + headerSize, &desc, &qoiSize);
+
+                    if (qoiData != NULL)
+                    {
+                        compData = (unsigned char *)RL_MALLOC(headerSize + qoiSize);
+
+                        if (compData != NULL)
+                        {
+                            compDataSize = headerSize + qoiSize;
+                            memcpy(compData, baseData, headerSize);
+                            memcpy(compData + headerSize, qoiData, qoiSize);
+                        }
+
+                        RL_FREE(qoiData);
+                    }
+                }
+            }
+        } break;
+        default: break;
+    }
+
+    if ((compData == NULL) || (compDataSize <= 0))
     {
-        rawData = RL_CALLOC(chunk.data.props[0], 1);
-        if (rawData != NULL) memcpy(rawData, chunk.data.raw, chunk.data.props[0]);
-        *size = chunk.data.props[0];
+        result = false;
+        RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression failed or not supported\n", item->info.type[0], item->info.type[1], item->info.type[2], item->info.type[3]);
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return rawData;
-}
+    // STEP 2: Data encryption (if compression was successful)
+    //-------------------------------------------------------------------------------------
+    unsigned char *packedData = NULL;
+    unsigned int packedSize = 0;
+
+    if (result)
+    {
+        switch (item->info.cipherType)
+        {
+            case RRES_CIPHER_NONE:
+            {
+                packedSize = compDataSize;
+                packedData = (unsigned char *)RRES_MALLOC(packedSize);
+                if (packedData != NULL) memcpy(packedData, compData, packedSize);
+            } break;
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+            case RRES_CIPHER_AES:
+            {
+                uint8_t key[32] = { 0 };
+                uint8_t salt[16] = { 0 };
+
+                if (packContext->useArchiveKey)
+                {
+                    // Archive key chunk: salt is replaced by a chunk nonce, key derived from archive key
+                    DerivePackBytes(packContext, item, compData, compDataSize, 'n', salt, 16);
+                    DeriveChunkKey(packContext->archiveKey, salt, 16, key);
+                    item->info.flags |= RRES_FLAG_ARCHIVE_KEY;
+                }
+                else
+                {
+                    void *workArea = NULL;
+
+                    DerivePackBytes(packContext, item, compData, compDataSize, 's', salt, 16);
+                    DeriveCipherKey(packContext->password, salt, key, &workArea);
+                    RL_FREE(workArea);
+                }
+
+                // Packed data: encrypted data + salt[16] (or nonce[16]) + MD5[16]
+                packedSize = compDataSize + 16 + 16;
+                packedData = (unsigned char *)RRES_MALLOC(packedSize);
+
+                if (packedData != NULL)
+                {
+                    unsigned int md5[4] = { 0 };
+                    ComputeMD5(compData, compDataSize, md5);
+
+                    memcpy(packedData, compData, compDataSize);
+                    memcpy(packedData + compDataSize, salt, 16);
+                    memcpy(packedData + compDataSize + 16, md5, 16);
+
+                    // NOTE: Packing is already parallelized by chunks, data is encrypted in calling thread
+                    AesCtrXcrypt(key, packedData, compDataSize, 1);     // AES Counter mode, stream cipher
+                }
+
+                // Wipe secrets, they are no longer needed
+                crypto_wipe(salt, 16);
+                crypto_wipe(key, 32);
+            } break;
+            case RRES_CIPHER_AES_GCM:
+            {
+                uint8_t key[32] = { 0 };
+                uint8_t salt[16] = { 0 };
+                uint8_t nonce[12] = { 0 };
+                unsigned int saltSize = 16;
+
+                DerivePackBytes(packContext, item, compData, compDataSize, 'n', nonce, 12);
+
+                if (packContext->useArchiveKey)
+                {
+                    // Archive key chunk: no salt stored, key derived from archive key and nonce
+                    DeriveChunkKey(packContext->archiveKey, nonce, 12, key);
+                    item->info.flags |= RRES_FLAG_ARCHIVE_KEY;
+                    saltSize = 0;
+                }
+                else
+                {
+                    void *workArea = NULL;
+
+                    DerivePackBytes(packContext, item, compData, compDataSize, 's', salt, 16);
+                    DeriveCipherKey(packContext->password, salt, key, &workArea);
+                    RL_FREE(workArea);
+                }
+
+                // Packed data: encrypted data + salt[16] (not stored for archive key chunks) + nonce[12] + tag[16]
+                packedSize = compDataSize + saltSize + 12 + 16;
+                packedData = (unsigned char *)RRES_MALLOC(packedSize);
+
+                if (packedData != NULL)
+                {
+                    memcpy(packedData, compData, compDataSize);
+                    memcpy(packedData + compDataSize, salt, saltSize);
+                    memcpy(packedData + compDataSize + saltSize, nonce, 12);
+
+                    if (!AesGcmXcrypt(key, nonce, packedData, compDataSize, packedData + compDataSize + saltSize + 12, true))
+                    {
+                        RRES_FREE(packedData);
+                        packedData = NULL;
+                    }
+                }
+
+                // Wipe secrets, they are no longer needed
+                crypto_wipe(salt, 16);
+                crypto_wipe(key, 32);
+            } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+            case RRES_CIPHER_XCHACHA20_POLY1305:
+            {
+                uint8_t key[32] = { 0 };
+                uint8_t salt[16] = { 0 };
+                uint8_t nonce[24] = { 0 };
+                unsigned int saltSize = 16;
+
+                DerivePackBytes(packContext, item, compData, compDataSize, 'n', nonce, 24);
+
+                if (packContext->useArchiveKey)
+                {
+                    // Archive key chunk: no salt stored, key derived from archive key and nonce
+                    DeriveChunkKey(packContext->archiveKey, nonce, 24, key);
+                    item->info.flags |= RRES_FLAG_ARCHIVE_KEY;
+                    saltSize = 0;
+                }
+                else
+                {
+                    void *workArea = NULL;
+
+                    DerivePackBytes(packContext, item, compData, compDataSize, 's', salt, 16);
+                    DeriveCipherKey(packContext->password, salt, key, &workArea);
+                    RL_FREE(workArea);
+                }
+
+                // Packed data: encrypted data + salt[16] (not stored for archive key chunks) + nonce[24] + MAC[16]
+                packedSize = compDataSize + saltSize + 24 + 16;
+                packedData = (unsigned char *)RRES_MALLOC(packedSize);
+
+                if (packedData != NULL)
+                {
+                    memcpy(packedData + compDataSize, salt, saltSize);
+                    memcpy(packedData + compDataSize + saltSize, nonce, 24);
+                    crypto_aead_lock(packedData, packedData + compDataSize + saltSize + 24, key, nonce, NULL, 0, compData, compDataSize);
+                }
+
+                // Wipe secrets, they are no longer needed
+                crypto_wipe(salt, 16);
+                crypto_wipe(nonce, 24);
+                crypto_wipe(key, 32);
+            } break;
+#endif
+            default:
+            {
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", item->info.type[0], item->info.type[1], item->info.type[2], item->info.type[3]);
+            } break;
+        }
+
+        result = (packedData != NULL);
+    }
+
+    if (result)
+    {
+        item->packedData = packedData;
+        item->info.packedSize = packedSize;
+        item->info.baseSize = baseSize;
+    }
+
+    if (compData != baseData) RL_FREE(compData);
+    RL_FREE(baseData);
+
+    return result;
+}
+
+// Write archive key derivation record (KDFR) and derive archive cipher key into context
+// NOTE 1: Record salt is derived from context seed, key stretching is done once, encrypted chunks
+// packed with context afterwards only store a nonce and get RRES_FLAG_ARCHIVE_KEY flag
+// NOTE 2: Record should be written as first chunk (header chunk), before any encrypted chunk
+bool WriteArchiveCipherKey(rresWriter *writer, rresPackContext *context)
+{
+    bool result = false;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    uint8_t salt[16] = { 0 };
+    const unsigned char label = 'a';
+    void *workArea = NULL;
+
+    crypto_blake2b_keyed(salt, 16, context->seed, 32, &label, 1);
+    DeriveCipherKey(context->password, salt, context->archiveKey, &workArea);
+    RL_FREE(workArea);
+
+    rresResourceChunkInfo info = { 0 };
+    info.type[0] = 'K';
+    info.type[1] = 'D';
+    info.type[2] = 'F';
+    info.type[3] = 'R';
+
+    unsigned int props[4] = { RRES_KDF_ARGON2I, RRES_KDF_ARGON2I_BLOCKS, RRES_KDF_ARGON2I_PASSES, RRES_KDF_ARGON2I_LANES };
+    rresResourceChunkData data = { 0 };
+    data.propCount = 4;
+    data.props = props;
+    data.raw = salt;
+
+    result = rresWriteResourceChunk(writer, info, data, 16);
+
+    if (result) context->useArchiveKey = true;
+    else crypto_wipe(context->archiveKey, 32);
+#else
+    RRES_LOG("RRES: WARNING: KDFR: Archive cipher key requires encryption support\n");
+#endif
+
+    return result;
+}
+
+// Write archive compression dictionary (DICT) and keep it into context
+// NOTE 1: Dictionary is trained from samples raw data (i.e. the small resources to be packed), small LZ4 chunks
+// packed with context afterwards are compressed with it and get RRES_FLAG_DICTIONARY flag
+// NOTE 2: Dictionary should be written as a header chunk, before any chunk compressed with it
+// WARNING: Dictionary is stored not encrypted and it contains pieces of samples data,
+// do not train it with data that must be kept encrypted
+bool WriteArchiveDictionary(rresWriter *writer, rresPackContext *context, const rresPackItem *samples, unsigned int sampleCount)
+{
+    bool result = false;
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    unsigned char *dictionary = (unsigned char *)RL_MALLOC(RRES_DICTIONARY_SIZE);
+    unsigned int dictionarySize = (dictionary != NULL)? TrainDictionary(samples, sampleCount, dictionary, RRES_DICTIONARY_SIZE) : 0;
+
+    if (dictionarySize > 0)
+    {
+        rresResourceChunkInfo info = { 0 };
+        info.type[0] = 'D';
+        info.type[1] = 'I';
+        info.type[2] = 'C';
+        info.type[3] = 'T';
+
+        unsigned int props[2] = { RRES_COMP_LZ4, rresComputeCRC32(dictionary, (int)dictionarySize) };
+        rresResourceChunkData data = { 0 };
+        data.propCount = 2;
+        data.props = props;
+        data.raw = dictionary;
+
+        result = rresWriteResourceChunk(writer, info, data, dictionarySize);
+
+        if (result)
+        {
+            RL_FREE(context->dictionary);
+            context->dictionary = dictionary;
+            context->dictionarySize = dictionarySize;
+            context->dictionaryId = props[1];
+        }
+    }
+
+    if (!result) RL_FREE(dictionary);
+#else
+    RRES_LOG("RRES: WARNING: DICT: Archive compression dictionary requires LZ4 compression support\n");
+#endif
+
+    return result;
+}
+
+// Unload pack context
+// NOTE: Archive cipher key is wiped and compression dictionary is freed, password and seed are managed by the user
+void UnloadPackContext(rresPackContext *context)
+{
+    if (context != NULL)
+    {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        crypto_wipe(context->archiveKey, 32);
+#else
+        memset(context->archiveKey, 0, 32);
+#endif
+        context->useArchiveKey = false;
+
+        RL_FREE(context->dictionary);
+        context->dictionary = NULL;
+        context->dictionarySize = 0;
+        context->dictionaryId = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+// Train compression dictionary from samples raw data
+// NOTE: Simplified segments cover training: d-mers (8 bytes) are counted once per sample, samples data is split in
+// epochs and the RRES_DICTIONARY_SEGMENT_SIZE segment with more frequent d-mers is selected from every epoch,
+// selected d-mers are not considered again; if samples data fits, it's used as dictionary
+static unsigned int TrainDictionary(const rresPackItem *samples, unsigned int sampleCount, unsigned char *dictionary, unsigned int capacity)
+{
+    // Gather samples raw data, every sample is limited to dictionary chunk size
+    unsigned long long totalSize = 0;
+    for (unsigned int i = 0; i < sampleCount; i++)
+    {
+        if (samples[i].data.raw != NULL) totalSize += (samples[i].data.rawSize < RRES_DICTIONARY_CHUNK_SIZE)? samples[i].data.rawSize : RRES_DICTIONARY_CHUNK_SIZE;
+    }
+
+    if (totalSize > RRES_DICTIONARY_TRAINING_SIZE) totalSize = RRES_DICTIONARY_TRAINING_SIZE;
+    if (totalSize == 0) return 0;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC((size_t)totalSize);
+    unsigned int *sampleEnds = (unsigned int *)RL_CALLOC(sampleCount, sizeof(unsigned int));
+    unsigned int size = 0;
+    unsigned int count = 0;
+
+    if ((data == NULL) || (sampleEnds == NULL))
+    {
+        RL_FREE(data);
+        RL_FREE(sampleEnds);
+        return 0;
+    }
+
+    for (unsigned int i = 0; (i < sampleCount) && (size < totalSize); i++)
+    {
+        if (samples[i].data.raw == NULL) continue;
+
+        unsigned int sampleSize = (samples[i].data.rawSize < RRES_DICTIONARY_CHUNK_SIZE)? (unsigned int)samples[i].data.rawSize : RRES_DICTIONARY_CHUNK_SIZE;
+        if (sampleSize > (totalSize - size)) sampleSize = (unsigned int)(totalSize - size);
+
+        memcpy(data + size, samples[i].data.raw, sampleSize);
+        size += sampleSize;
+        sampleEnds[count++] = size;
+    }
+
+    // Samples data fits into dictionary, it's used as dictionary
+    if (size <= capacity)
+    {
+        memcpy(dictionary, data, size);
+        RL_FREE(data);
+        RL_FREE(sampleEnds);
+        return size;
+    }
+
+    // Count d-mers frequency, d-mers are counted once per sample
+    unsigned int *frequencies = (unsigned int *)RL_CALLOC(1 << RRES_DICTIONARY_HASH_BITS, sizeof(unsigned int));
+    unsigned int *lastSample = (unsigned int *)RL_CALLOC(1 << RRES_DICTIONARY_HASH_BITS, sizeof(unsigned int));
+    unsigned int *hashes = (unsigned int *)RL_MALLOC(size*sizeof(unsigned int));
+    unsigned int dictionarySize = 0;
+
+    if ((frequencies != NULL) && (lastSample != NULL) && (hashes != NULL))
+    {
+        unsigned int sampleStart = 0;
+
+        for (unsigned int s = 0; s < count; s++)
+        {
+            for (unsigned int i = sampleStart; i < sampleEnds[s]; i++)
+            {
+                // NOTE: D-mers crossing sample end are not counted (hash 0 is reserved, frequency is always 0)
+                hashes[i] = 0;
+
+                if ((i + RRES_DICTIONARY_DMER_SIZE) <= sampleEnds[s])
+                {
+                    unsigned long long dmer = 0;
+                    memcpy(&dmer, data + i, RRES_DICTIONARY_DMER_SIZE);
+                    unsigned int hash = (unsigned int)((dmer*0xcf1bbcdcb7a56463ULL) >> (64 - RRES_DICTIONARY_HASH_BITS));
+                    if (hash == 0) hash = 1;
+
+                    hashes[i] = hash;
+                    if (lastSample[hash] != (s + 1))
+                    {
+                        lastSample[hash] = s + 1;
+                        frequencies[hash]++;
+                    }
+                }
+            }
+
+            sampleStart = sampleEnds[s];
+        }
+
+        frequencies[0] = 0;
+
+        // Select best segment from every epoch, dictionary is filled from the end
+        // NOTE: First epochs segments are placed at dictionary end (closer offsets)
+        unsigned int segmentSize = RRES_DICTIONARY_SEGMENT_SIZE;
+        unsigned int epochCount = capacity/segmentSize;
+        unsigned int epochSize = size/epochCount;
+
+        if (epochSize < segmentSize)
+        {
+            epochSize = segmentSize;
+            epochCount = size/segmentSize;
+        }
+
+        for (unsigned int e = 0; (e < epochCount) && ((dictionarySize + segmentSize) <= capacity); e++)
+        {
+            unsigned int epochStart = e*epochSize;
+            unsigned int epochEnd = (e == (epochCount - 1))? size : (epochStart + epochSize);
+            unsigned int bestPosition = 0;
+            unsigned long long bestScore = 0;
+            unsigned long long score = 0;
+
+            // Sliding window score: d-mers frequencies starting in segment
+            for (unsigned int i = epochStart; i < epochEnd; i++)
+            {
+                score += frequencies[hashes[i]];
+                if (i >= (epochStart + segmentSize)) score -= frequencies[hashes[i - segmentSize]];
+
+                if ((i + 1 >= (epochStart + segmentSize)) && (score > bestScore))
+                {
+                    bestScore = score;
+                    bestPosition = i + 1 - segmentSize;
+                }
+            }
+
+            if (bestScore == 0) continue;
+
+            // Selected d-mers are not considered again
+            for (unsigned int i = bestPosition; i < (bestPosition + segmentSize); i++) frequencies[hashes[i]] = 0;
+
+            dictionarySize += segmentSize;
+            memcpy(dictionary + capacity - dictionarySize, data + bestPosition, segmentSize);
+        }
+
+        // Move dictionary to buffer start
+        if ((dictionarySize > 0) && (dictionarySize < capacity)) memmove(dictionary, dictionary + capacity - dictionarySize, dictionarySize);
+    }
+
+    RL_FREE(hashes);
+    RL_FREE(lastSample);
+    RL_FREE(frequencies);
+    RL_FREE(sampleEnds);
+    RL_FREE(data);
+
+    return dictionarySize;
+}
+#endif
+
+// Load data chunk: RRES_DATA_LINK
+static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+{
+    char fullFilePath[2048] = { 0 };
+    void *data = NULL;
+    *size = 0;
+
+    // Get external link filepath
+    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
+    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+
+    // Get base directory to append filepath if not provided by user
+    // NOTE: Global base directory is not modified, function could be called from multiple threads
+    strcpy(fullFilePath, (baseDir != NULL)? baseDir : GetApplicationDirectory());
+    strcat(fullFilePath, linkFilePath);
+
+    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+
+    if (FileExists(fullFilePath))
+    {
+        // Load external file as raw data
+        // NOTE: We check if file is a text file to allow automatic line-endings processing
+        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
+        {
+            data = LoadFileText(fullFilePath);
+            *size = TextLength((char *)data);
+        }
+        else data = LoadFileData(fullFilePath, (int *)size);
+
+        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    }
+    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
+
+    return data;
+}
+
+// Load data chunk: RRES_DATA_RAW
+// NOTE: This chunk can be used raw files embedding or other binary blobs
+static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
+{
+    void *rawData = NULL;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        // NOTE: Raw data size property must fit the raw data of the chunk processed
+        if ((chunk.data.propCount > 0) && (chunk.data.raw != NULL) && (chunk.data.props[0] <= chunk.data.rawSize))
+        {
+            rawData = RL_CALLOC(chunk.data.props[0], 1);
+            if (rawData != NULL) memcpy(rawData, chunk.data.raw, chunk.data.props[0]);
+            *size = chunk.data.props[0];
+        }
+        else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data size do not match expected raw data size\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return rawData;
+}
+
+// Load data chunk: RRES_DATA_TEXT
+// NOTE: This chunk can be used for shaders or other text data elements (materials?)
+static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+{
+    char *text = NULL;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        // NOTE: Text size property must fit the raw data of the chunk processed
+        if ((chunk.data.raw != NULL) && (chunk.data.props[0] <= chunk.data.rawSize))
+        {
+            text = (char *)RL_CALLOC((size_t)chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
+            if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+        }
+        else RRES_LOG("RRES: WARNING: TEXT: Chunk data size do not match expected text data size\n");
+
+        // TODO: We got some extra text properties, in case they could be useful for users:
+        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
+        *codeLang = chunk.data.props[2];
+        //chunks.props[3]:cultureCode could be useful for localized text
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return text;
+}
+
+// Load data chunk: RRES_DATA_IMAGE
+// NOTE: Many data types use images data in some way (font, material...)
+static Image LoadImageFromResourceChunk(rresResourceChunk chunk, int format)
+{
+    Image image = { 0 };
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        image.width = chunk.data.props[0];
+        image.height = chunk.data.props[1];
+        int pixelFormat = chunk.data.props[2];
+
+        // Assign equivalent pixel formats for our engine
+        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
+        switch (pixelFormat)
+        {
+            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
+            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
+            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+            default: break;
+        }
+
+        image.mipmaps = chunk.data.props[3];
+
+        // Image data size can be computed from image properties
+        // NOTE: Mipmaps are stored after base image, level size halved until 1x1
+        unsigned int size = GetPixelDataSize(image.width, image.height, image.format);
+        unsigned long long mipmapsSize = size;
+
+        for (int i = 1, mipWidth = image.width, mipHeight = image.height; i < image.mipmaps; i++)
+        {
+            mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+            mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+            mipmapsSize += GetPixelDataSize(mipWidth, mipHeight, image.format);
+        }
+
+        // NOTE: Images with mipmaps but only base image data available are loaded without mipmaps
+        if ((image.mipmaps > 1) && (mipmapsSize <= 0xffffffff) && (mipmapsSize == chunk.data.rawSize)) size = (unsigned int)mipmapsSize;
+        else if (image.mipmaps > 1) image.mipmaps = 1;
+
+        // NOTE: Computed image data must match the raw data size of the chunk processed (header and padding not included)
+        if ((chunk.data.raw != NULL) && (size == chunk.data.rawSize))
+        {
+            bool bgra = (format == RRES_IMAGE_FORMAT_B8G8R8A8);
+
+            // NOTE: Uncompressed 8 bit and 16 bit pixel formats are converted to RGBA8/BGRA8 while copied (SIMD),
+            // so image data is only written once, other conversions are done after copy with raylib ImageFormat()
+            if ((bgra || ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image.format != format))) && (image.mipmaps <= 1) &&
+                (pixelFormat >= RRES_PIXELFORMAT_UNCOMP_GRAYSCALE) && (pixelFormat <= RRES_PIXELFORMAT_UNCOMP_R8G8B8A8))
+            {
+                image.data = RL_MALLOC((size_t)image.width*image.height*4);
+                if (image.data != NULL) ConvertPixelsRGBA8((const unsigned char *)chunk.data.raw, pixelFormat, (unsigned char *)image.data, (unsigned long long)image.width*image.height, bgra);
+                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+            else
+            {
+                image.data = RL_CALLOC(size, 1);
+                if (image.data != NULL) memcpy(image.data, chunk.data.raw, size);
+                if ((image.data != NULL) && (format != 0)) ConvertImageFormat(&image, format);
+            }
+        }
+        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return image;
+}
+
+// Convert image to pixel format with raylib ImageFormat()
+// NOTE: RRES_IMAGE_FORMAT_B8G8R8A8 images are converted to RGBA8 and red and blue channels swapped in place,
+// all mipmap levels are swapped (mipmaps are stored consecutively, level size halved until 1x1)
+static void ConvertImageFormat(Image *image, int format)
+{
+    bool bgra = (format == RRES_IMAGE_FORMAT_B8G8R8A8);
+
+    if (image->format != (bgra? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : format)) ImageFormat(image, bgra? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : format);
+
+    if (bgra && (image->data != NULL) && (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        unsigned long long pixelCount = 0;
+        int mipWidth = image->width;
+        int mipHeight = image->height;
+
+        for (int i = 0; i < ((image->mipmaps > 1)? image->mipmaps : 1); i++)
+        {
+            pixelCount += (unsigned long long)GetPixelDataSize(mipWidth, mipHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)/4;
+
+            mipWidth /= 2;
+            mipHeight /= 2;
+            if (mipWidth < 1) mipWidth = 1;
+            if (mipHeight < 1) mipHeight = 1;
+        }
+
+        ConvertPixelsRGBA8((const unsigned char *)image->data, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, (unsigned char *)image->data, pixelCount, true);
+    }
+}
+
+// Load Mesh data from resource chunks
+// NOTE: Vertex data is converted to raylib expected vertex format if required (half float, normalized integers,
+// 8/32 bit indices), if adopt is requested chunks data already in expected format is adopted by mesh
+static Mesh LoadMeshFromResourceChunks(rresResourceMulti multi, bool adopt)
+{
+    Mesh mesh = { 0 };
+
+    // TODO: Support externally linked mesh resource?
+
+    // NOTE: raylib only supports vertex arrays with same vertex count,
+    // rres.chunks[0] defined vertexCount will be the reference for the following chunks
+    // The only exception to vertexCount is the mesh.indices array
+    // NOTE: Vertex count must fit raylib int vertexCount, otherwise mesh is not loaded
+    if ((multi.count > 0) && (multi.chunks[0].data.propCount > 0) && (multi.chunks[0].data.props[0] <= 0x7fffffff)) mesh.vertexCount = (int)multi.chunks[0].data.props[0];
+
+    // Mesh resource consist of (n) chunks:
+    for (unsigned int i = 0; i < multi.count; i++)
+    {
+        rresResourceChunk *chunk = &multi.chunks[i];
+
+        if ((chunk->info.compType == RRES_COMP_NONE) && (chunk->info.cipherType == RRES_CIPHER_NONE))
+        {
+            // Verify chunk type and vertex count
+            if ((rresGetDataType(chunk->info.type) == RRES_DATA_VERTEX) && (chunk->data.propCount >= 4))
+            {
+                // In case vertex count do not match we skip that resource chunk
+                if ((chunk->data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) && ((chunk->data.props[0] > 0x7fffffff) || ((int)chunk->data.props[0] != mesh.vertexCount))) continue;
+
+                // NOTE: Vertex data is converted to raylib vertex format, raylib expected components count is required
+                switch (chunk->data.props[1])    // Check rresVertexAttribute value
+                {
+                    case RRES_VERTEX_ATTRIBUTE_POSITION:
+                    {
+                        // raylib expects 3 components per vertex and float vertex format
+                        mesh.vertices = (float *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_FLOAT, 3, adopt);
+                        if (mesh.vertices == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD1:
+                    {
+                        // raylib expects 2 components per vertex and float vertex format
+                        mesh.texcoords = (float *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_FLOAT, 2, adopt);
+                        if (mesh.texcoords == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD2:
+                    {
+                        // raylib expects 2 components per vertex and float vertex format
+                        mesh.texcoords2 = (float *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_FLOAT, 2, adopt);
+                        if (mesh.texcoords2 == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD3:
+                    {
+                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord3 not supported\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TEXCOORD4:
+                    {
+                        RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord4 not supported\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_NORMAL:
+                    {
+                        // raylib expects 3 components per vertex and float vertex format
+                        mesh.normals = (float *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_FLOAT, 3, adopt);
+                        if (mesh.normals == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_TANGENT:
+                    {
+                        // raylib expects 4 components per vertex and float vertex format
+                        mesh.tangents = (float *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_FLOAT, 4, adopt);
+                        if (mesh.tangents == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_COLOR:
+                    {
+                        // raylib expects 4 components per vertex and unsigned char vertex format
+                        mesh.colors = (unsigned char *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_UBYTE, 4, adopt);
+                        if (mesh.colors == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
+
+                    } break;
+                    case RRES_VERTEX_ATTRIBUTE_INDEX:
+                    {
+                        // raylib expects 1 components per index and unsigned short vertex format
+                        // NOTE: Index count must be read before chunk data is adopted
+                        unsigned int indexCount = chunk->data.props[0];
+
+                        mesh.indices = (unsigned short *)LoadMeshAttributeFromResourceChunk(chunk, RRES_VERTEX_FORMAT_USHORT, 1, adopt);
+                        if (mesh.indices != NULL) mesh.triangleCount = indexCount/3;
+                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, componentCount/vertexFormat do not fit (or index exceeds unsigned short)\n");
+
+                    } break;
+                    default: break;
+                }
+            }
+        }
+        else RRES_LOG("RRES: WARNING: Vertex provided data must be decompressed/decrypted\n");
+    }
+
+    // Not indexed mesh, every 3 vertex define a triangle
+    if ((mesh.indices == NULL) && (mesh.vertices != NULL)) mesh.triangleCount = mesh.vertexCount/3;
+
+    return mesh;
+}
+
+// Load vertex attribute data from resource chunk: RRES_DATA_VERTEX
+// NOTE: Data is converted to provided vertex format (FLOAT, UBYTE colors or USHORT indices), if data is
+// already in that format and adopt is requested, raw data is adopted (no copy) and removed from chunk,
+// only raw data allocated on its own or at chunk data buffer start can be adopted (see rresLoadResourceChunkDataFromMemory())
+static void *LoadMeshAttributeFromResourceChunk(rresResourceChunk *chunk, int format, unsigned int componentCount, bool adopt)
+{
+    void *data = NULL;
+    unsigned long long count = (unsigned long long)chunk->data.props[0]*componentCount;    // Components count
+    int dataFormat = (int)chunk->data.props[3];
+    unsigned int dataSize = GetVertexFormatSize(dataFormat);
+
+    // Check components count and data size, raw data must fit chunk data
+    if ((chunk->data.props[2] != componentCount) || (dataSize == 0) || (chunk->data.raw == NULL) ||
+        (count == 0) || ((count*dataSize) > chunk->data.rawSize)) return NULL;
+
+    if (adopt && (dataFormat == format) && ((chunk->data.buffer == NULL) || (chunk->data.raw == chunk->data.buffer)))
+    {
+        data = chunk->data.raw;
+        chunk->data.raw = NULL;
+        chunk->data.rawSize = 0;
+
+        // NOTE: Props are placed into adopted buffer, they are removed from chunk
+        if (chunk->data.buffer != NULL)
+        {
+            chunk->data.buffer = NULL;
+            chunk->data.props = NULL;
+            chunk->data.propCount = 0;
+        }
+
+        return data;
+    }
+
+    data = RL_MALLOC((size_t)(count*GetVertexFormatSize(format)));
+
+    if (data != NULL)
+    {
+        bool converted = false;
+
+        switch (format)
+        {
+            case RRES_VERTEX_FORMAT_FLOAT: converted = ConvertVertexComponents((const unsigned char *)chunk->data.raw, dataFormat, (float *)data, count); break;
+            case RRES_VERTEX_FORMAT_UBYTE: converted = ConvertVertexColors((const unsigned char *)chunk->data.raw, dataFormat, (unsigned char *)data, count); break;
+            case RRES_VERTEX_FORMAT_USHORT: converted = ConvertVertexIndices((const unsigned char *)chunk->data.raw, dataFormat, (unsigned short *)data, count); break;
+            default: break;
+        }
+
+        if (!converted)
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+    }
+
+    return data;
+}
+
+// Get file extension from RRES_DATA_RAW properties (unsigned int)
+// NOTE: Extension is written into provided char[9] array (NULL terminated)
+static void GetExtensionFromProps(unsigned int ext01, unsigned int ext02, char *extension)
+{
+    memset(extension, 0, 9);
+
+    // Convert file extension provided as 2 unsigned int properties, to a char[] array 
+    // NOTE: Extension is defined as 2 unsigned int big-endian values (4 bytes each), 
+    // starting with a dot, i.e 0x2e706e67 => ".png"
+    extension[0] = (unsigned char)((ext01 & 0xff000000) >> 24);
+    extension[1] = (unsigned char)((ext01 & 0x00ff0000) >> 16);
+    extension[2] = (unsigned char)((ext01 & 0x0000ff00) >> 8);
+    extension[3] = (unsigned char)(ext01 & 0x000000ff);
+
+    extension[4] = (unsigned char)((ext02 & 0xff000000) >> 24);
+    extension[5] = (unsigned char)((ext02 & 0x00ff0000) >> 16);
+    extension[6] = (unsigned char)((ext02 & 0x0000ff00) >> 8);
+    extension[7] = (unsigned char)(ext02 & 0x000000ff);
+}
+
+// Get built-in decompressor for compression type
+static rresCodec GetBuiltInDecompressor(int compType)
+{
+    rresCodec codec = { 0 };
+
+    switch (compType)
+    {
+        case RRES_COMP_DEFLATE: codec.name = "DEFLATE"; codec.decode = DecompressDEFLATE; break;
+        case RRES_COMP_RLE: codec.name = "RLE"; codec.decode = DecompressRLE; break;
+        case RRES_COMP_QOI: codec.name = "QOI"; codec.decode = DecompressQOI; break;
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+        case RRES_COMP_LZ4: codec.name = "LZ4"; codec.decode = DecompressLZ4; codec.capabilities = RRES_CODEC_STREAMING | RRES_CODEC_PARTIAL; break;
+#endif
+        default: break;
+    }
+
+    return codec;
+}
+
+// Get built-in decryptor for encryption type
+// NOTE: Built-in decryptors decrypt data in place, authentication is verified before data is provided
+static rresCodec GetBuiltInDecryptor(int cipherType)
+{
+    rresCodec codec = { 0 };
+
+    switch (cipherType)
+    {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        case RRES_CIPHER_AES: codec.name = "AES"; codec.decode = DecryptAES; break;
+        case RRES_CIPHER_AES_GCM: codec.name = "AES-GCM"; codec.decode = DecryptAESGCM; break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        case RRES_CIPHER_XCHACHA20_POLY1305: codec.name = "XChaCha20"; codec.decode = DecryptXChaCha20; break;
+#endif
+        default: break;
+    }
+
+    if (codec.decode != NULL) codec.capabilities = RRES_CODEC_IN_PLACE | RRES_CODEC_STREAMING;
+
+    return codec;
+}
+
+// Decompress data: DEFLATE
+// NOTE: Decompressed data buffer becomes the unpacked data buffer (raylib allocates it)
+static int DecompressDEFLATE(rresCodecData *data)
+{
+    int uncompDataSize = 0;
+
+    // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
+    unsigned char *uncompData = DecompressData(data->input, (int)data->inputSize, &uncompDataSize);
+
+    if ((uncompData == NULL) || (uncompDataSize <= 0))
+    {
+        RL_FREE(uncompData);
+        return 4;    // Decompression process failed
+    }
+
+    data->outputBuffer = uncompData;
+    data->output = uncompData;
+    data->outputSize = uncompDataSize;
+
+    return 0;
+}
+
+// Decompress data: QOI
+// NOTE: QOI packed data keeps chunk data header uncompressed: propCount + props[] (+ padding),
+// followed by QOI encoded pixel data (or stripes with a block table, RRES_FLAG_INDEPENDENT_BLOCKS),
+// pixels are decoded straight into unpacked data (aligned)
+static int DecompressQOI(rresCodecData *data)
+{
+    unsigned int headerSize = rresGetDataHeaderSize(data->input, data->inputSize, data->info.flags);
+    unsigned int header[4] = { 0 };     // propCount + props[0..2]: width, height, format
+
+    if (headerSize >= sizeof(header)) memcpy(header, data->input, sizeof(header));
+
+    // NOTE: Only RGB/RGBA images can be QOI encoded, up to 400 million pixels (QOI limit)
+    unsigned int width = header[1];
+    unsigned int height = header[2];
+    unsigned int channels = (header[3] == RRES_PIXELFORMAT_UNCOMP_R8G8B8)? 3 : (header[3] == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)? 4 : 0;
+    unsigned long long pixelsSize = (unsigned long long)width*height*channels;
+
+    if ((header[0] < 3) || (pixelsSize == 0) || (((unsigned long long)width*height) > 400000000)) return 4;
+
+    data->output = (unsigned char *)rresAllocUnpackedData(headerSize + pixelsSize, headerSize, data->info.flags, &data->outputBuffer);
+
+    if (data->output == NULL) return 4;
+
+    memcpy(data->output, data->input, headerSize);
+
+    bool decoded = false;
+
+    if ((data->info.flags & RRES_FLAG_INDEPENDENT_BLOCKS) == 0) decoded = DecodeQOIData(data->input + headerSize, data->inputSize - headerSize, data->output + headerSize, width, height, channels);
+    else
+    {
+        // Independent stripes: block table (stripe pixel data size, stripes count, stripes size) + stripes,
+        // stripes are decoded in parallel (context->threadCount) straight into their rows
+        unsigned int blockSize = 0;
+        unsigned int blockCount = 0;
+        unsigned long long *stripeOffsets = LoadBlockOffsets(data->input + headerSize, data->inputSize - headerSize, pixelsSize, &blockSize, &blockCount);
+
+        if ((stripeOffsets != NULL) && ((blockSize%(width*channels)) == 0))
+        {
+            rresQOIStripeJobs jobs = { 0 };
+            jobs.data = data->input + headerSize;
+            jobs.stripeOffsets = stripeOffsets;
+            jobs.stripeHeight = blockSize/(width*channels);
+            jobs.width = width;
+            jobs.height = height;
+            jobs.channels = channels;
+            jobs.pixels = data->output + headerSize;
+            jobs.failed = (bool *)RL_CALLOC(blockCount, sizeof(bool));
+
+            if (jobs.failed != NULL)
+            {
+                rresParallelFor(QOIStripeJob, &jobs, blockCount, data->context->threadCount);
+
+                decoded = true;
+                for (unsigned int i = 0; i < blockCount; i++) if (jobs.failed[i]) decoded = false;
+
+                RL_FREE(jobs.failed);
+            }
+        }
+
+        RL_FREE(stripeOffsets);
+    }
+
+    if (!decoded) return 4;
+
+    data->outputSize = headerSize + pixelsSize;
+
+    return 0;
+}
+
+// Decode QOI data into provided pixels buffer (width*height*channels bytes)
+// NOTE: QOI header must match expected image size and channels, pixels are decoded straight
+// into output (no intermediate buffer), data must contain all pixels (corrupted data fails)
+static bool DecodeQOIData(const unsigned char *data, unsigned long long size, unsigned char *pixels, unsigned int width, unsigned int height, unsigned int channels)
+{
+    // QOI header: magic ("qoif") + width (4 bytes, big-endian) + height (4 bytes, big-endian) + channels + colorspace,
+    // followed by QOI operations and end marker (8 bytes)
+    if ((size < (14 + 8)) || (memcmp(data, "qoif", 4) != 0) || ((channels != 3) && (channels != 4))) return false;
+
+    unsigned int qoiWidth = ((unsigned int)data[4] << 24) | ((unsigned int)data[5] << 16) | ((unsigned int)data[6] << 8) | data[7];
+    unsigned int qoiHeight = ((unsigned int)data[8] << 24) | ((unsigned int)data[9] << 16) | ((unsigned int)data[10] << 8) | data[11];
+
+    if ((qoiWidth != width) || (qoiHeight != height) || (data[12] != channels)) return false;
+
+    unsigned char index[64][4] = { 0 };         // Previously seen pixels, indexed by hash
+    unsigned char px[4] = { 0, 0, 0, 255 };     // Current pixel
+    unsigned long long pixelsSize = (unsigned long long)width*height*channels;
+    unsigned long long position = 14;
+    unsigned long long end = size - 8;          // End marker is not decoded
+
+    for (unsigned long long offset = 0; offset < pixelsSize; )
+    {
+        if (position >= end) return false;
+
+        unsigned int op = data[position++];
+        unsigned int run = 1;
+
+        if (op == 0xfe)                         // QOI_OP_RGB
+        {
+            if ((end - position) < 3) return false;
+            memcpy(px, data + position, 3);
+            position += 3;
+        }
+        else if (op == 0xff)                    // QOI_OP_RGBA
+        {
+            if ((end - position) < 4) return false;
+            memcpy(px, data + position, 4);
+            position += 4;
+        }
+        else if ((op & 0xc0) == 0x00) memcpy(px, index[op], 4);   // QOI_OP_INDEX
+        else if ((op & 0xc0) == 0x40)           // QOI_OP_DIFF
+        {
+            px[0] = (unsigned char)(px[0] + ((op >> 4) & 0x03) - 2);
+            px[1] = (unsigned char)(px[1] + ((op >> 2) & 0x03) - 2);
+            px[2] = (unsigned char)(px[2] + (op & 0x03) - 2);
+        }
+        else if ((op & 0xc0) == 0x80)           // QOI_OP_LUMA
+        {
+            if (position >= end) return false;
+
+            unsigned int diff = data[position++];
+            int vg = (int)(op & 0x3f) - 32;
+
+            px[0] = (unsigned char)(px[0] + vg - 8 + ((diff >> 4) & 0x0f));
+            px[1] = (unsigned char)(px[1] + vg);
+            px[2] = (unsigned char)(px[2] + vg - 8 + (diff & 0x0f));
+        }
+        else run = (op & 0x3f) + 1;             // QOI_OP_RUN
+
+        memcpy(index[(px[0]*3 + px[1]*5 + px[2]*7 + px[3]*11)%64], px, 4);
+
+        if ((unsigned long long)run*channels > (pixelsSize - offset)) return false;
+
+        if (channels == 4) for (; run > 0; run--, offset += 4) memcpy(pixels + offset, px, 4);
+        else for (; run > 0; run--, offset += 3) memcpy(pixels + offset, px, 3);
+    }
+
+    return true;
+}
+
+// QOI image stripes job: decode one stripe
+// NOTE: Every stripe is a QOI image of stripeHeight rows (last one could be smaller), decoded straight into its rows
+static void QOIStripeJob(void *jobs, unsigned int index)
+{
+    rresQOIStripeJobs *stripes = (rresQOIStripeJobs *)jobs;
+
+    unsigned int firstRow = index*stripes->stripeHeight;
+    unsigned int rows = ((stripes->height - firstRow) < stripes->stripeHeight)? (stripes->height - firstRow) : stripes->stripeHeight;
+    unsigned long long rowSize = (unsigned long long)stripes->width*stripes->channels;
+
+    if (!DecodeQOIData(stripes->data + stripes->stripeOffsets[index], stripes->stripeOffsets[index + 1] - stripes->stripeOffsets[index],
+        stripes->pixels + firstRow*rowSize, stripes->width, rows, stripes->channels)) stripes->failed[index] = true;
+}
+
+// Decompress data: RLE
+// NOTE: RLE packed data keeps chunk data header uncompressed: propCount + props[] (+ padding),
+// followed by RLE encoded raw data, raw data is decoded straight into unpacked data (aligned)
+static int DecompressRLE(rresCodecData *data)
+{
+    unsigned int headerSize = rresGetDataHeaderSize(data->input, data->inputSize, data->info.flags);
+
+    if ((headerSize == 0) || (data->info.baseSize < headerSize)) return 4;
+
+    data->output = (unsigned char *)rresAllocUnpackedData(data->info.baseSize, headerSize, data->info.flags, &data->outputBuffer);
+
+    if (data->output == NULL) return 4;
+
+    memcpy(data->output, data->input, headerSize);
+    if (!DecompressRLEData(data->input + headerSize, data->inputSize - headerSize, data->output + headerSize, data->info.baseSize - headerSize)) return 4;
+
+    data->outputSize = data->info.baseSize;
+
+    return 0;
+}
+
+// Compress data with RLE
+// NOTE: RLE data: stride (1 byte) + tokens + tail bytes (size%stride bytes, not encoded)
+// Token: header (varint: ((count - 1) << 1) | run) followed by one element (run) or count elements (literal)
+static unsigned long long CompressRLEData(const unsigned char *data, unsigned long long size, unsigned int stride, unsigned char *output, unsigned long long capacity)
+{
+    unsigned long long elementCount = size/stride;
+    unsigned long long literalStart = 0;        // First element not encoded yet
+    unsigned long long position = 0;
+    unsigned int minRun = (stride == 1)? 3 : 2; // Shorter runs are encoded as literals (no size gain)
+
+    if ((stride == 0) || (stride > RRES_RLE_MAX_STRIDE) || (capacity < 1)) return 0;
+
+    output[position++] = (unsigned char)stride;
+
+    for (unsigned long long i = 0; i <= elementCount; )
+    {
+        unsigned long long run = 0;
+
+        if (i < elementCount)
+        {
+            run = 1;
+            while (((i + run) < elementCount) && (memcmp(data + (i + run)*stride, data + i*stride, stride) == 0)) run++;
+        }
+
+        // Pending literal elements are encoded before a run (or at the end of data)
+        if (((run >= minRun) || (i == elementCount)) && (i > literalStart))
+        {
+            unsigned long long header = (i - literalStart - 1) << 1;
+            do
+            {
+                if (position >= capacity) return 0;
+                output[position++] = (unsigned char)((header & 0x7f) | ((header > 0x7f)? 0x80 : 0));
+                header >>= 7;
+            } while (header > 0);
+
+            if ((i - literalStart)*stride > (capacity - position)) return 0;
+            memcpy(output + position, data + literalStart*stride, (size_t)((i - literalStart)*stride));
+            position += (i - literalStart)*stride;
+        }
+
+        if (i == elementCount) break;
+
+        if (run >= minRun)
+        {
+            unsigned long long header = ((run - 1) << 1) | 1;
+            do
+            {
+                if (position >= capacity) return 0;
+                output[position++] = (unsigned char)((header & 0x7f) | ((header > 0x7f)? 0x80 : 0));
+                header >>= 7;
+            } while (header > 0);
+
+            if (stride > (capacity - position)) return 0;
+            memcpy(output + position, data + i*stride, stride);
+            position += stride;
+            literalStart = i + run;
+        }
+
+        i += run;
+    }
+
+    // Tail bytes, not enough data for an element
+    if ((size - elementCount*stride) > (capacity - position)) return 0;
+    memcpy(output + position, data + elementCount*stride, (size_t)(size - elementCount*stride));
+    position += (size - elementCount*stride);
+
+    return position;
+}
+
+// Decompress RLE data
+// NOTE: Tokens are validated against provided data and output sizes, runs are expanded with SIMD stores,
+// short tokens are copied with fixed size copies that can overwrite following output (written by next tokens)
+static bool DecompressRLEData(const unsigned char *data, unsigned long long size, unsigned char *output, unsigned long long outputSize)
+{
+    if (size < 1) return false;
+
+    unsigned int stride = data[0];
+    if ((stride == 0) || (stride > RRES_RLE_MAX_STRIDE)) return false;
+
+    unsigned long long elementCount = outputSize/stride;    // Elements not decoded yet
+    unsigned long long position = 1;
+    unsigned long long written = 0;
+
+    while (elementCount > 0)
+    {
+        // Token header: varint, 7 bits per byte (little-endian)
+        unsigned long long header = 0;
+
+        if ((position < size) && (data[position] < 0x80)) header = data[position++];
+        else
+        {
+            unsigned int shift = 0;
+            unsigned char byte = 0x80;
+
+            while (((byte & 0x80) != 0) && (position < size) && (shift < 64))
+            {
+                byte = data[position++];
+                header |= (unsigned long long)(byte & 0x7f) << shift;
+                shift += 7;
+            }
+
+            if ((byte & 0x80) != 0) return false;
+        }
+
+        unsigned long long count = (header >> 1) + 1;
+        if (count > elementCount) return false;
+
+        unsigned long long tokenSize = count*stride;
+
+        if ((header & 1) != 0)
+        {
+            if (stride > (size - position)) return false;
+            ExpandRunRLE(output + written, outputSize - written, data + position, stride, count);
+            position += stride;
+        }
+        else
+        {
+            if (tokenSize > (size - position)) return false;
+
+            if ((tokenSize <= 16) && ((size - position) >= 16) && ((outputSize - written) >= 16)) memcpy(output + written, data + position, 16);
+            else memcpy(output + written, data + position, (size_t)tokenSize);
+
+            position += tokenSize;
+        }
+
+        written += tokenSize;
+        elementCount -= count;
+    }
+
+    // Tail bytes, not encoded
+    if ((outputSize - written) != (size - position)) return false;
+    memcpy(output + written, data + position, (size_t)(outputSize - written));
+
+    return true;
+}
+
+// Expand RLE run: element (stride bytes) repeated count times
+// NOTE: Element is repeated into a pattern of lcm(stride, 16) bytes, so pattern is stored with
+// 16 bytes SIMD stores (SSE2/NEON) keeping element phase, memcpy() is used if SIMD is not available;
+// strides dividing 16 are broadcast into a register and last store can overwrite output after the run
+// (up to capacity bytes from output start), following tokens write that data
+static void ExpandRunRLE(unsigned char *output, unsigned long long capacity, const unsigned char *element, unsigned int stride, unsigned long long count)
+{
+    unsigned long long size = count*stride;
+    unsigned long long position = 0;
+    unsigned char pattern[16*RRES_RLE_MAX_STRIDE];
+
+#if defined(RRES_SIMD_SSE2)
+    if ((16%stride) == 0)
+    {
+        __m128i value;
+        int value32 = 0;
+        short value16 = 0;
+
+        switch (stride)
+        {
+            case 1: value = _mm_set1_epi8((char)element[0]); break;
+            case 2: memcpy(&value16, element, 2); value = _mm_set1_epi16(value16); break;
+            case 4: memcpy(&value32, element, 4); value = _mm_set1_epi32(value32); break;
+            case 8: value = _mm_loadl_epi64((const __m128i *)element); value = _mm_unpacklo_epi64(value, value); break;
+            default: value = _mm_loadu_si128((const __m128i *)element); break;
+        }
+
+        // Enough capacity: whole 64 bytes blocks are stored (fewer branches for short runs)
+        if ((size + 63) <= capacity)
+        {
+            for (; position < size; position += 64)
+            {
+                _mm_storeu_si128((__m128i *)(output + position), value);
+                _mm_storeu_si128((__m128i *)(output + position + 16), value);
+                _mm_storeu_si128((__m128i *)(output + position + 32), value);
+                _mm_storeu_si128((__m128i *)(output + position + 48), value);
+            }
+
+            return;
+        }
+
+        for (; (position + 64) <= size; position += 64)
+        {
+            _mm_storeu_si128((__m128i *)(output + position), value);
+            _mm_storeu_si128((__m128i *)(output + position + 16), value);
+            _mm_storeu_si128((__m128i *)(output + position + 32), value);
+            _mm_storeu_si128((__m128i *)(output + position + 48), value);
+        }
+
+        for (; (position + 16) <= size; position += 16) _mm_storeu_si128((__m128i *)(output + position), value);
+
+        if ((position < size) && ((position + 16) <= capacity)) _mm_storeu_si128((__m128i *)(output + position), value);
+        else if (position < size)
+        {
+            _mm_storeu_si128((__m128i *)pattern, value);
+            memcpy(output + position, pattern, (size_t)(size - position));
+        }
+
+        return;
+    }
+#elif defined(RRES_SIMD_NEON)
+    if ((16%stride) == 0)
+    {
+        uint8x16_t value;
+        unsigned long long value64 = 0;
+        unsigned int value32 = 0;
+        unsigned short value16 = 0;
+
+        switch (stride)
+        {
+            case 1: value = vdupq_n_u8(element[0]); break;
+            case 2: memcpy(&value16, element, 2); value = vreinterpretq_u8_u16(vdupq_n_u16(value16)); break;
+            case 4: memcpy(&value32, element, 4); value = vreinterpretq_u8_u32(vdupq_n_u32(value32)); break;
+            case 8: memcpy(&value64, element, 8); value = vreinterpretq_u8_u64(vdupq_n_u64(value64)); break;
+            default: value = vld1q_u8(element); break;
+        }
+
+        // Enough capacity: whole 64 bytes blocks are stored (fewer branches for short runs)
+        if ((size + 63) <= capacity)
+        {
+            for (; position < size; position += 64)
+            {
+                vst1q_u8(output + position, value);
+                vst1q_u8(output + position + 16, value);
+                vst1q_u8(output + position + 32, value);
+                vst1q_u8(output + position + 48, value);
+            }
+
+            return;
+        }
+
+        for (; (position + 64) <= size; position += 64)
+        {
+            vst1q_u8(output + position, value);
+            vst1q_u8(output + position + 16, value);
+            vst1q_u8(output + position + 32, value);
+            vst1q_u8(output + position + 48, value);
+        }
+
+        for (; (position + 16) <= size; position += 16) vst1q_u8(output + position, value);
+
+        if ((position < size) && ((position + 16) <= capacity)) vst1q_u8(output + position, value);
+        else if (position < size)
+        {
+            vst1q_u8(pattern, value);
+            memcpy(output + position, pattern, (size_t)(size - position));
+        }
+
+        return;
+    }
+#endif
+
+    // Pattern size is lcm(stride, 16) = stride*2^n, so element is doubled into pattern
+    unsigned int patternSize = stride;
+    while ((patternSize%16) != 0) patternSize *= 2;
+
+    memcpy(pattern, element, stride);
+    for (unsigned int filled = stride; filled < patternSize; filled *= 2) memcpy(pattern + filled, pattern, filled);
+
+#if defined(RRES_SIMD_SSE2)
+    __m128i values[RRES_RLE_MAX_STRIDE];
+    for (unsigned int i = 0; i < patternSize/16; i++) values[i] = _mm_loadu_si128((const __m128i *)(pattern + 16*i));
+
+    for (; (position + patternSize) <= size; position += patternSize)
+    {
+        for (unsigned int i = 0; i < patternSize/16; i++) _mm_storeu_si128((__m128i *)(output + position + 16*i), values[i]);
+    }
+#elif defined(RRES_SIMD_NEON)
+    uint8x16_t values[RRES_RLE_MAX_STRIDE];
+    for (unsigned int i = 0; i < patternSize/16; i++) values[i] = vld1q_u8(pattern + 16*i);
+
+    for (; (position + patternSize) <= size; position += patternSize)
+    {
+        for (unsigned int i = 0; i < patternSize/16; i++) vst1q_u8(output + position + 16*i, values[i]);
+    }
+#endif
+
+    // Remaining data, position is always a multiple of pattern size
+    for (; (position + patternSize) <= size; position += patternSize) memcpy(output + position, pattern, patternSize);
+    if (position < size) memcpy(output + position, pattern, (size_t)(size - position));
+}
+
+// Get uncompressed pixel format size in bytes
+static unsigned int GetPixelSize(int format)
+{
+    unsigned int size = 0;
+
+    switch (format)
+    {
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: size = 1; break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: size = 2; break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8: size = 3; break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
+        case RRES_PIXELFORMAT_UNCOMP_R32: size = 4; break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32: size = 12; break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: size = 16; break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Get uncompressed pixel as RGBA8
+// NOTE: Only 8 bit per channel and 16 bit packed formats are supported, channels are expanded by bits replication
+static void GetPixelRGBA8(const unsigned char *pixels, int format, unsigned long long index, unsigned char *rgba)
+{
+    unsigned short value = 0;
+
+    switch (format)
+    {
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
+        {
+            rgba[0] = rgba[1] = rgba[2] = pixels[index];
+            rgba[3] = 255;
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
+        {
+            rgba[0] = rgba[1] = rgba[2] = pixels[2*index];
+            rgba[3] = pixels[2*index + 1];
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
+        {
+            memcpy(&value, pixels + 2*index, 2);
+            rgba[0] = (unsigned char)(((value >> 11) << 3) | (value >> 13));
+            rgba[1] = (unsigned char)((((value >> 5) & 0x3f) << 2) | ((value >> 9) & 0x03));
+            rgba[2] = (unsigned char)(((value & 0x1f) << 3) | ((value >> 2) & 0x07));
+            rgba[3] = 255;
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
+        {
+            memcpy(&value, pixels + 2*index, 2);
+            rgba[0] = (unsigned char)(((value >> 11) << 3) | (value >> 13));
+            rgba[1] = (unsigned char)((((value >> 6) & 0x1f) << 3) | ((value >> 8) & 0x07));
+            rgba[2] = (unsigned char)((((value >> 1) & 0x1f) << 3) | ((value >> 3) & 0x07));
+            rgba[3] = (value & 0x01)? 255 : 0;
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
+        {
+            memcpy(&value, pixels + 2*index, 2);
+            rgba[0] = (unsigned char)((value >> 12)*17);
+            rgba[1] = (unsigned char)(((value >> 8) & 0x0f)*17);
+            rgba[2] = (unsigned char)(((value >> 4) & 0x0f)*17);
+            rgba[3] = (unsigned char)((value & 0x0f)*17);
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
+        {
+            memcpy(rgba, pixels + 3*index, 3);
+            rgba[3] = 255;
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: memcpy(rgba, pixels + 4*index, 4); break;
+        default: memset(rgba, 0, 4); break;
+    }
+}
+
+// Convert uncompressed pixels to RGBA8 (or BGRA8)
+// NOTE: Pixels are converted with SIMD kernels (SSE2/SSSE3/NEON) while copied into output, remaining pixels
+// (or all pixels if SIMD is not available) are converted one by one, output can be pixels data (RGBA8 swizzle)
+static void ConvertPixelsRGBA8(const unsigned char *pixels, int format, unsigned char *output, unsigned long long count, bool bgra)
+{
+    unsigned long long i = 0;
+
+    if ((format == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8) && !bgra)
+    {
+        if (output != pixels) memcpy(output, pixels, (size_t)(count*4));
+        return;
+    }
+
+#if defined(RRES_SIMD_SSE2)
+    switch (format)
+    {
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
+        {
+            __m128i alpha = _mm_set1_epi8((char)0xff);
+
+            for (; (i + 16) <= count; i += 16)
+            {
+                __m128i gray = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i grayLo = _mm_unpacklo_epi8(gray, gray);     // Pairs: gray, gray
+                __m128i grayHi = _mm_unpackhi_epi8(gray, gray);
+                __m128i alphaLo = _mm_unpacklo_epi8(gray, alpha);   // Pairs: gray, alpha
+                __m128i alphaHi = _mm_unpackhi_epi8(gray, alpha);
+
+                _mm_storeu_si128((__m128i *)(output + 4*i), _mm_unpacklo_epi16(grayLo, alphaLo));
+                _mm_storeu_si128((__m128i *)(output + 4*i + 16), _mm_unpackhi_epi16(grayLo, alphaLo));
+                _mm_storeu_si128((__m128i *)(output + 4*i + 32), _mm_unpacklo_epi16(grayHi, alphaHi));
+                _mm_storeu_si128((__m128i *)(output + 4*i + 48), _mm_unpackhi_epi16(grayHi, alphaHi));
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
+        {
+            __m128i mask = _mm_set1_epi16(0x00ff);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i grayAlpha = _mm_loadu_si128((const __m128i *)(pixels + 2*i));
+                __m128i gray = _mm_and_si128(grayAlpha, mask);
+                gray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+                _mm_storeu_si128((__m128i *)(output + 4*i), _mm_unpacklo_epi16(gray, grayAlpha));
+                _mm_storeu_si128((__m128i *)(output + 4*i + 16), _mm_unpackhi_epi16(gray, grayAlpha));
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
+        {
+            // NOTE: Channels are computed on 16 bit lanes (8 pixels), then interleaved as RGBA bytes
+            __m128i mask4 = _mm_set1_epi16(0x0f);
+            __m128i mask5 = _mm_set1_epi16(0x1f);
+            __m128i mask6 = _mm_set1_epi16(0x3f);
+            __m128i opaque = _mm_set1_epi16(0xff);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i value = _mm_loadu_si128((const __m128i *)(pixels + 2*i));
+                __m128i r, g, b, a;
+
+                if (format == RRES_PIXELFORMAT_UNCOMP_R5G6B5)
+                {
+                    r = _mm_srli_epi16(value, 11);
+                    g = _mm_and_si128(_mm_srli_epi16(value, 5), mask6);
+                    b = _mm_and_si128(value, mask5);
+                    r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+                    g = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+                    b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+                    a = opaque;
+                }
+                else if (format == RRES_PIXELFORMAT_UNCOMP_R5G5B5A1)
+                {
+                    r = _mm_srli_epi16(value, 11);
+                    g = _mm_and_si128(_mm_srli_epi16(value, 6), mask5);
+                    b = _mm_and_si128(_mm_srli_epi16(value, 1), mask5);
+                    r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+                    g = _mm_or_si128(_mm_slli_epi16(g, 3), _mm_srli_epi16(g, 2));
+                    b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+                    a = _mm_mullo_epi16(_mm_and_si128(value, _mm_set1_epi16(0x01)), opaque);
+                }
+                else
+                {
+                    r = _mm_srli_epi16(value, 12);
+                    g = _mm_and_si128(_mm_srli_epi16(value, 8), mask4);
+                    b = _mm_and_si128(_mm_srli_epi16(value, 4), mask4);
+                    a = _mm_and_si128(value, mask4);
+                    r = _mm_or_si128(r, _mm_slli_epi16(r, 4));
+                    g = _mm_or_si128(g, _mm_slli_epi16(g, 4));
+                    b = _mm_or_si128(b, _mm_slli_epi16(b, 4));
+                    a = _mm_or_si128(a, _mm_slli_epi16(a, 4));
+                }
+
+                __m128i redGreen = _mm_or_si128(bgra? b : r, _mm_slli_epi16(g, 8));
+                __m128i blueAlpha = _mm_or_si128(bgra? r : b, _mm_slli_epi16(a, 8));
+
+                _mm_storeu_si128((__m128i *)(output + 4*i), _mm_unpacklo_epi16(redGreen, blueAlpha));
+                _mm_storeu_si128((__m128i *)(output + 4*i + 16), _mm_unpackhi_epi16(redGreen, blueAlpha));
+            }
+        } break;
+    #if defined(RRES_SIMD_SSSE3)
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
+        {
+            // NOTE: Every 16 bytes load (12 bytes used) is shuffled into 4 pixels, last load reads 4 bytes ahead
+            __m128i shuffle = bgra? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1) : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+            for (; (i + 18) <= count; i += 16)
+            {
+                for (int k = 0; k < 4; k++)
+                {
+                    __m128i rgb = _mm_loadu_si128((const __m128i *)(pixels + 3*i + 12*k));
+                    _mm_storeu_si128((__m128i *)(output + 4*i + 16*k), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+                }
+            }
+        } break;
+    #endif
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
+        {
+            // Swap red and blue channels (bgra)
+            __m128i maskGreenAlpha = _mm_set1_epi32((int)0xff00ff00);
+            __m128i maskRedBlue = _mm_set1_epi32(0x00ff00ff);
+
+            for (; (i + 4) <= count; i += 4)
+            {
+                __m128i rgba = _mm_loadu_si128((const __m128i *)(pixels + 4*i));
+                __m128i redBlue = _mm_and_si128(rgba, maskRedBlue);
+                redBlue = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+
+                _mm_storeu_si128((__m128i *)(output + 4*i), _mm_or_si128(_mm_and_si128(rgba, maskGreenAlpha), redBlue));
+            }
+        } break;
+        default: break;
+    }
+#elif defined(RRES_SIMD_NEON)
+    switch (format)
+    {
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
+        {
+            uint8x16x4_t rgba;
+            rgba.val[3] = vdupq_n_u8(255);
+
+            for (; (i + 16) <= count; i += 16)
+            {
+                rgba.val[0] = rgba.val[1] = rgba.val[2] = vld1q_u8(pixels + i);
+                vst4q_u8(output + 4*i, rgba);
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
+        {
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x2_t grayAlpha = vld2q_u8(pixels + 2*i);
+                uint8x16x4_t rgba = { { grayAlpha.val[0], grayAlpha.val[0], grayAlpha.val[0], grayAlpha.val[1] } };
+                vst4q_u8(output + 4*i, rgba);
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
+        {
+            // NOTE: Channels are computed on 16 bit lanes (8 pixels), then narrowed and interleaved as RGBA bytes
+            uint16x8_t mask4 = vdupq_n_u16(0x0f);
+            uint16x8_t mask5 = vdupq_n_u16(0x1f);
+            uint16x8_t mask6 = vdupq_n_u16(0x3f);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint16x8_t value = vreinterpretq_u16_u8(vld1q_u8(pixels + 2*i));
+                uint16x8_t r, g, b, a;
+
+                if (format == RRES_PIXELFORMAT_UNCOMP_R5G6B5)
+                {
+                    r = vshrq_n_u16(value, 11);
+                    g = vandq_u16(vshrq_n_u16(value, 5), mask6);
+                    b = vandq_u16(value, mask5);
+                    r = vorrq_u16(vshlq_n_u16(r, 3), vshrq_n_u16(r, 2));
+                    g = vorrq_u16(vshlq_n_u16(g, 2), vshrq_n_u16(g, 4));
+                    b = vorrq_u16(vshlq_n_u16(b, 3), vshrq_n_u16(b, 2));
+                    a = vdupq_n_u16(0xff);
+                }
+                else if (format == RRES_PIXELFORMAT_UNCOMP_R5G5B5A1)
+                {
+                    r = vshrq_n_u16(value, 11);
+                    g = vandq_u16(vshrq_n_u16(value, 6), mask5);
+                    b = vandq_u16(vshrq_n_u16(value, 1), mask5);
+                    r = vorrq_u16(vshlq_n_u16(r, 3), vshrq_n_u16(r, 2));
+                    g = vorrq_u16(vshlq_n_u16(g, 3), vshrq_n_u16(g, 2));
+                    b = vorrq_u16(vshlq_n_u16(b, 3), vshrq_n_u16(b, 2));
+                    a = vmulq_n_u16(vandq_u16(value, vdupq_n_u16(0x01)), 0xff);
+                }
+                else
+                {
+                    r = vshrq_n_u16(value, 12);
+                    g = vandq_u16(vshrq_n_u16(value, 8), mask4);
+                    b = vandq_u16(vshrq_n_u16(value, 4), mask4);
+                    a = vandq_u16(value, mask4);
+                    r = vorrq_u16(r, vshlq_n_u16(r, 4));
+                    g = vorrq_u16(g, vshlq_n_u16(g, 4));
+                    b = vorrq_u16(b, vshlq_n_u16(b, 4));
+                    a = vorrq_u16(a, vshlq_n_u16(a, 4));
+                }
+
+                uint8x8x4_t rgba = { { vmovn_u16(bgra? b : r), vmovn_u16(g), vmovn_u16(bgra? r : b), vmovn_u16(a) } };
+                vst4_u8(output + 4*i, rgba);
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
+        {
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x3_t rgb = vld3q_u8(pixels + 3*i);
+                uint8x16x4_t rgba = { { rgb.val[bgra? 2 : 0], rgb.val[1], rgb.val[bgra? 0 : 2], vdupq_n_u8(255) } };
+                vst4q_u8(output + 4*i, rgba);
+            }
+        } break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
+        {
+            // Swap red and blue channels (bgra)
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x4_t rgba = vld4q_u8(pixels + 4*i);
+                uint8x16_t red = rgba.val[0];
+                rgba.val[0] = rgba.val[2];
+                rgba.val[2] = red;
+                vst4q_u8(output + 4*i, rgba);
+            }
+        } break;
+        default: break;
+    }
+#endif
+
+    // Remaining pixels, converted one by one
+    for (; i < count; i++)
+    {
+        unsigned char rgba[4] = { 0 };
+        GetPixelRGBA8(pixels, format, i, rgba);
+
+        output[4*i] = rgba[bgra? 2 : 0];
+        output[4*i + 1] = rgba[1];
+        output[4*i + 2] = rgba[bgra? 0 : 2];
+        output[4*i + 3] = rgba[3];
+    }
+}
+
+// Get vertex format size in bytes
+static unsigned int GetVertexFormatSize(int format)
+{
+    unsigned int size = 0;
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE: size = 1; break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        case RRES_VERTEX_FORMAT_SHORT:
+        case RRES_VERTEX_FORMAT_HFLOAT: size = 2; break;
+        case RRES_VERTEX_FORMAT_UINT:
+        case RRES_VERTEX_FORMAT_INT:
+        case RRES_VERTEX_FORMAT_FLOAT: size = 4; break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Convert half float (16 bit) to float
+// NOTE: Exponent is rebiased on integer bits, denormals are normalized with a float subtraction,
+// infinity and NaN are kept, no hardware half float support required
+static float HalfToFloat(unsigned short half)
+{
+    unsigned int bits = (unsigned int)(half & 0x7fff) << 13;    // Exponent and mantissa, float aligned
+    unsigned int exponent = bits & 0x0f800000;
+    float value = 0.0f;
+
+    bits += (127 - 15) << 23;                       // Exponent rebias
+    if (exponent == 0x0f800000) bits += (128 - 16) << 23;  // Infinity/NaN: max exponent
+    else if (exponent == 0)                         // Zero/denormal: 2^-14*(1 + mantissa) - 2^-14
+    {
+        bits += 1 << 23;
+        memcpy(&value, &bits, sizeof(float));
+        value -= 6.103515625e-05f;
+        memcpy(&bits, &value, sizeof(float));
+    }
+
+    bits |= (unsigned int)(half & 0x8000) << 16;    // Sign
+    memcpy(&value, &bits, sizeof(float));
+
+    return value;
+}
+
+// Convert vertex components to float
+// NOTE: Integer formats are normalized: unsigned to [0.0f..1.0f], signed to [-1.0f..1.0f] (minimum value clamped),
+// components are converted with SIMD kernels (SSE2/NEON), remaining components (or all components if SIMD is
+// not available) are converted one by one, returns false if format is not supported
+static bool ConvertVertexComponents(const unsigned char *data, int format, float *output, unsigned long long count)
+{
+    unsigned long long i = 0;
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_FLOAT: memcpy(output, data, (size_t)(count*sizeof(float))); return true;
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE:
+        case RRES_VERTEX_FORMAT_USHORT:
+        case RRES_VERTEX_FORMAT_SHORT:
+        case RRES_VERTEX_FORMAT_HFLOAT: break;
+        default: return false;
+    }
+
+#if defined(RRES_SIMD_SSE2)
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE:
+        {
+            bool snorm = (format == RRES_VERTEX_FORMAT_BYTE);
+            __m128 scale = _mm_set1_ps(snorm? 1.0f/127.0f : 1.0f/255.0f);
+            __m128 minimum = _mm_set1_ps(snorm? -1.0f : 0.0f);
+            __m128i zero = _mm_setzero_si128();
+
+            for (; (i + 16) <= count; i += 16)
+            {
+                __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+                __m128i lo, hi;
+
+                // Expand to 16 bit lanes (sign extended for snorm)
+                if (snorm)
+                {
+                    lo = _mm_srai_epi16(_mm_unpacklo_epi8(value, value), 8);
+                    hi = _mm_srai_epi16(_mm_unpackhi_epi8(value, value), 8);
+                }
+                else
+                {
+                    lo = _mm_unpacklo_epi8(value, zero);
+                    hi = _mm_unpackhi_epi8(value, zero);
+                }
+
+                // Expand to 32 bit lanes (sign extended), converted and scaled
+                __m128i lanes[4] = {
+                    _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16), _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16),
+                    _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16), _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16)
+                };
+
+                for (int k = 0; k < 4; k++) _mm_storeu_ps(output + i + 4*k, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(lanes[k]), scale), minimum));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        case RRES_VERTEX_FORMAT_SHORT:
+        {
+            bool snorm = (format == RRES_VERTEX_FORMAT_SHORT);
+            __m128 scale = _mm_set1_ps(snorm? 1.0f/32767.0f : 1.0f/65535.0f);
+            __m128 minimum = _mm_set1_ps(snorm? -1.0f : 0.0f);
+            __m128i zero = _mm_setzero_si128();
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i value = _mm_loadu_si128((const __m128i *)(data + 2*i));
+                __m128i lo = snorm? _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16) : _mm_unpacklo_epi16(value, zero);
+                __m128i hi = snorm? _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16) : _mm_unpackhi_epi16(value, zero);
+
+                _mm_storeu_ps(output + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale), minimum));
+                _mm_storeu_ps(output + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale), minimum));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_HFLOAT:
+        {
+            // NOTE: Same conversion as HalfToFloat(), special cases are selected with lane masks
+            __m128i zero = _mm_setzero_si128();
+            __m128i maskSign = _mm_set1_epi32(0x8000);
+            __m128i maskValue = _mm_set1_epi32(0x7fff);
+            __m128i maskExponent = _mm_set1_epi32(0x0f800000);
+            __m128i rebias = _mm_set1_epi32((127 - 15) << 23);
+            __m128i rebiasInf = _mm_set1_epi32((128 - 16) << 23);
+            __m128i denormalOne = _mm_set1_epi32(1 << 23);
+            __m128 denormalBase = _mm_set1_ps(6.103515625e-05f);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i value = _mm_loadu_si128((const __m128i *)(data + 2*i));
+                __m128i halves[2] = { _mm_unpacklo_epi16(value, zero), _mm_unpackhi_epi16(value, zero) };
+
+                for (int k = 0; k < 2; k++)
+                {
+                    __m128i bits = _mm_slli_epi32(_mm_and_si128(halves[k], maskValue), 13);
+                    __m128i exponent = _mm_and_si128(bits, maskExponent);
+                    __m128i infNaN = _mm_cmpeq_epi32(exponent, maskExponent);
+                    __m128i denormal = _mm_cmpeq_epi32(exponent, zero);
+
+                    bits = _mm_add_epi32(bits, rebias);
+                    bits = _mm_add_epi32(bits, _mm_and_si128(infNaN, rebiasInf));
+
+                    __m128i normalized = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, denormalOne)), denormalBase));
+                    bits = _mm_or_si128(_mm_andnot_si128(denormal, bits), _mm_and_si128(denormal, normalized));
+                    bits = _mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(halves[k], maskSign), 16));
+
+                    _mm_storeu_ps(output + i + 4*k, _mm_castsi128_ps(bits));
+                }
+            }
+        } break;
+        default: break;
+    }
+#elif defined(RRES_SIMD_NEON)
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE:
+        {
+            bool snorm = (format == RRES_VERTEX_FORMAT_BYTE);
+            float scale = snorm? 1.0f/127.0f : 1.0f/255.0f;
+            float32x4_t minimum = vdupq_n_f32(snorm? -1.0f : 0.0f);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                int16x8_t value = snorm? vmovl_s8(vld1_s8((const int8_t *)(data + i))) : vreinterpretq_s16_u16(vmovl_u8(vld1_u8(data + i)));
+
+                vst1q_f32(output + i, vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), scale), minimum));
+                vst1q_f32(output + i + 4, vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), scale), minimum));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        {
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint16x8_t value = vld1q_u16((const uint16_t *)(data + 2*i));
+
+                vst1q_f32(output + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(value))), 1.0f/65535.0f));
+                vst1q_f32(output + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), 1.0f/65535.0f));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_SHORT:
+        {
+            float32x4_t minimum = vdupq_n_f32(-1.0f);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                int16x8_t value = vld1q_s16((const int16_t *)(data + 2*i));
+
+                vst1q_f32(output + i, vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), 1.0f/32767.0f), minimum));
+                vst1q_f32(output + i + 4, vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), 1.0f/32767.0f), minimum));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_HFLOAT:
+        {
+            // NOTE: Same conversion as HalfToFloat(), special cases are selected with lane masks
+            uint32x4_t maskExponent = vdupq_n_u32(0x0f800000);
+            float32x4_t denormalBase = vdupq_n_f32(6.103515625e-05f);
+
+            for (; (i + 4) <= count; i += 4)
+            {
+                uint32x4_t half = vmovl_u16(vld1_u16((const uint16_t *)(data + 2*i)));
+                uint32x4_t bits = vshlq_n_u32(vandq_u32(half, vdupq_n_u32(0x7fff)), 13);
+                uint32x4_t exponent = vandq_u32(bits, maskExponent);
+                uint32x4_t infNaN = vceqq_u32(exponent, maskExponent);
+                uint32x4_t denormal = vceqq_u32(exponent, vdupq_n_u32(0));
+
+                bits = vaddq_u32(bits, vdupq_n_u32((127 - 15) << 23));
+                bits = vaddq_u32(bits, vandq_u32(infNaN, vdupq_n_u32((128 - 16) << 23)));
+
+                uint32x4_t normalized = vreinterpretq_u32_f32(vsubq_f32(vreinterpretq_f32_u32(vaddq_u32(bits, vdupq_n_u32(1 << 23))), denormalBase));
+                bits = vbslq_u32(denormal, normalized, bits);
+                bits = vorrq_u32(bits, vshlq_n_u32(vandq_u32(half, vdupq_n_u32(0x8000)), 16));
+
+                vst1q_f32(output + i, vreinterpretq_f32_u32(bits));
+            }
+        } break;
+        default: break;
+    }
+#endif
+
+    // Remaining components, converted one by one
+    for (; i < count; i++)
+    {
+        switch (format)
+        {
+            case RRES_VERTEX_FORMAT_UBYTE: output[i] = (float)data[i]*(1.0f/255.0f); break;
+            case RRES_VERTEX_FORMAT_BYTE:
+            {
+                float value = (float)((signed char)data[i])*(1.0f/127.0f);
+                output[i] = (value < -1.0f)? -1.0f : value;
+            } break;
+            case RRES_VERTEX_FORMAT_USHORT:
+            {
+                unsigned short value = 0;
+                memcpy(&value, data + 2*i, sizeof(unsigned short));
+                output[i] = (float)value*(1.0f/65535.0f);
+            } break;
+            case RRES_VERTEX_FORMAT_SHORT:
+            {
+                short component = 0;
+                memcpy(&component, data + 2*i, sizeof(short));
+                float value = (float)component*(1.0f/32767.0f);
+                output[i] = (value < -1.0f)? -1.0f : value;
+            } break;
+            case RRES_VERTEX_FORMAT_HFLOAT:
+            {
+                unsigned short value = 0;
+                memcpy(&value, data + 2*i, sizeof(unsigned short));
+                output[i] = HalfToFloat(value);
+            } break;
+            default: break;
+        }
+    }
+
+    return true;
+}
+
+// Convert vertex colors components to unsigned char
+// NOTE: USHORT components are rounded to 8 bit, float components are clamped to [0.0f..1.0f],
+// returns false if format is not supported
+static bool ConvertVertexColors(const unsigned char *data, int format, unsigned char *output, unsigned long long count)
+{
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE: memcpy(output, data, (size_t)count); break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        {
+            for (unsigned long long i = 0; i < count; i++)
+            {
+                unsigned short value = 0;
+                memcpy(&value, data + 2*i, sizeof(unsigned short));
+                output[i] = (unsigned char)(((unsigned int)value*255 + 32895) >> 16);
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_HFLOAT:
+        case RRES_VERTEX_FORMAT_FLOAT:
+        {
+            for (unsigned long long i = 0; i < count; i++)
+            {
+                float value = 0.0f;
+
+                if (format == RRES_VERTEX_FORMAT_FLOAT) memcpy(&value, data + 4*i, sizeof(float));
+                else
+                {
+                    unsigned short half = 0;
+                    memcpy(&half, data + 2*i, sizeof(unsigned short));
+                    value = HalfToFloat(half);
+                }
+
+                // NOTE: NaN is converted to 0
+                output[i] = (value >= 1.0f)? 255 : ((value > 0.0f)? (unsigned char)(value*255.0f + 0.5f) : 0);
+            }
+        } break;
+        default: return false;
+    }
+
+    return true;
+}
+
+// Convert vertex indices to unsigned short (raylib Mesh indices)
+// NOTE: 32 bit indices are narrowed with SIMD kernels (SSE2/NEON), returns false if
+// format is not supported or any index does not fit unsigned short
+static bool ConvertVertexIndices(const unsigned char *data, int format, unsigned short *output, unsigned long long count)
+{
+    unsigned long long i = 0;
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        {
+            for (; i < count; i++) output[i] = data[i];
+        } break;
+        case RRES_VERTEX_FORMAT_USHORT: memcpy(output, data, (size_t)(count*sizeof(unsigned short))); break;
+        case RRES_VERTEX_FORMAT_UINT:
+        case RRES_VERTEX_FORMAT_INT:
+        {
+            unsigned int overflow = 0;      // Indices high bits, accumulated (negative INT indices overflow)
+
+#if defined(RRES_SIMD_SSE2)
+            // NOTE: Indices are biased to signed range, so signed saturation pack keeps them
+            __m128i highBits = _mm_setzero_si128();
+            __m128i bias = _mm_set1_epi32(0x8000);
+            __m128i unbias = _mm_set1_epi16((short)0x8000);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i lo = _mm_loadu_si128((const __m128i *)(data + 4*i));
+                __m128i hi = _mm_loadu_si128((const __m128i *)(data + 4*i + 16));
+
+                highBits = _mm_or_si128(highBits, _mm_or_si128(_mm_srli_epi32(lo, 16), _mm_srli_epi32(hi, 16)));
+
+                __m128i packed = _mm_packs_epi32(_mm_sub_epi32(lo, bias), _mm_sub_epi32(hi, bias));
+                _mm_storeu_si128((__m128i *)(output + i), _mm_xor_si128(packed, unbias));
+            }
+
+            unsigned int lanes[4] = { 0 };
+            _mm_storeu_si128((__m128i *)lanes, highBits);
+            overflow = lanes[0] | lanes[1] | lanes[2] | lanes[3];
+#elif defined(RRES_SIMD_NEON)
+            uint32x4_t highBits = vdupq_n_u32(0);
+
+            for (; (i + 8) <= count; i += 8)
+            {
+                uint32x4_t lo = vld1q_u32((const uint32_t *)(data + 4*i));
+                uint32x4_t hi = vld1q_u32((const uint32_t *)(data + 4*i + 16));
+
+                highBits = vorrq_u32(highBits, vorrq_u32(vshrq_n_u32(lo, 16), vshrq_n_u32(hi, 16)));
+                vst1q_u16(output + i, vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+            }
+
+            overflow = vgetq_lane_u32(highBits, 0) | vgetq_lane_u32(highBits, 1) | vgetq_lane_u32(highBits, 2) | vgetq_lane_u32(highBits, 3);
+#endif
+            // Remaining indices, converted one by one
+            for (; i < count; i++)
+            {
+                unsigned int index = 0;
+                memcpy(&index, data + 4*i, sizeof(unsigned int));
+
+                overflow |= (index >> 16);
+                output[i] = (unsigned short)index;
+            }
+
+            if (overflow != 0) return false;
+        } break;
+        default: return false;
+    }
+
+    return true;
+}
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+// Decompress data: LZ4
+// NOTE: Data is decompressed straight into unpacked data, allocated with raw data aligned
+static int DecompressLZ4(rresCodecData *data)
+{
+    int uncompDataSize = 0;
+    const unsigned char *input = data->input;
+    unsigned long long baseSize = data->info.baseSize;
+    unsigned short flags = data->info.flags;
+
+    // NOTE: Linked blocks (RRES_FLAG_STREAM_BLOCKS) store compressed size (4 bytes) + block, header is in first block
+    bool linkedBlocks = ((flags & RRES_FLAG_STREAM_BLOCKS) != 0);
+    const unsigned char *firstBlock = linkedBlocks? (input + 4) : input;
+    unsigned int firstBlockSize = linkedBlocks? 0 : (unsigned int)data->inputSize;
+
+    if (linkedBlocks && (data->inputSize >= 4))
+    {
+        memcpy(&firstBlockSize, input, 4);
+        if (firstBlockSize > (data->inputSize - 4)) firstBlockSize = 0;
+    }
+
+    // NOTE: Independent blocks (RRES_FLAG_INDEPENDENT_BLOCKS) store a block table first, blocks are decompressed in parallel
+    bool independentBlocks = !linkedBlocks && ((flags & RRES_FLAG_INDEPENDENT_BLOCKS) != 0);
+    unsigned int blockSize = 0;
+    unsigned int blockCount = 0;
+    unsigned long long *blockOffsets = independentBlocks? LoadBlockOffsets(input, data->inputSize, baseSize, &blockSize, &blockCount) : NULL;
+
+    if (independentBlocks)
+    {
+        firstBlock = (blockOffsets != NULL)? (input + blockOffsets[0]) : input;
+        firstBlockSize = (blockOffsets != NULL)? (unsigned int)(blockOffsets[1] - blockOffsets[0]) : 0;
+    }
+
+    // NOTE: Dictionary chunks (RRES_FLAG_DICTIONARY) store dictionaryId (4 bytes) + data header (not compressed) + raw data
+    // compressed with archive dictionary, data header is directly available so unpacked data is allocated with raw data aligned
+    if (!linkedBlocks && !independentBlocks && ((flags & RRES_FLAG_DICTIONARY) != 0))
+    {
+        rresDictionary *dictionary = (rresDictionary *)data->context->dictionary;
+        unsigned int dictionaryId = 0;
+        if (data->inputSize >= 4) memcpy(&dictionaryId, input, 4);
+
+        if ((dictionary == NULL) || (dictionary->id != dictionaryId)) return 8;    // Archive compression dictionary not available
+
+        unsigned int headerSize = rresGetDataHeaderSize(input + 4, data->inputSize - 4, flags);
+        data->output = (headerSize > 0)? (unsigned char *)rresAllocUnpackedData(baseSize, headerSize, flags, &data->outputBuffer) : NULL;
+
+        if (data->output != NULL)
+        {
+            memcpy(data->output, input + 4, headerSize);
+            int rawDataSize = LZ4_decompress_safe_usingDict((const char *)input + 4 + headerSize, (char *)data->output + headerSize, (int)(data->inputSize - 4 - headerSize),
+                (int)(baseSize - headerSize), (const char *)dictionary->data, (int)dictionary->size);
+            if (rawDataSize >= 0) uncompDataSize = (int)headerSize + rawDataSize;
+        }
+
+        data->outputSize = (uncompDataSize > 0)? uncompDataSize : 0;
+
+        return (data->outputSize > 0)? 0 : 4;
+    }
+
+    // Decompress data header first, so data is decompressed with raw data aligned
+    // NOTE: Partial decompression stops as soon as header bytes are available,
+    // bigger headers are not aligned and raw data is copied on chunk data loading
+    unsigned char header[256] = { 0 };
+    int headerBytes = LZ4_decompress_safe_partial((const char *)firstBlock, (char *)header, firstBlockSize, (baseSize < 256)? (int)baseSize : 256, 256);
+    unsigned int headerSize = (headerBytes > 0)? rresGetDataHeaderSize(header, headerBytes, flags) : 0;
+
+    unsigned char *output = (unsigned char *)rresAllocUnpackedData(baseSize, headerSize, flags, &data->outputBuffer);
+    data->output = output;
+
+    if ((output != NULL) && linkedBlocks) uncompDataSize = DecompressLZ4Blocks(input, data->inputSize, output, (int)baseSize);
+    else if ((output != NULL) && independentBlocks)
+    {
+        // NOTE: Big chunks blocks are decompressed in parallel (context->threadCount)
+        rresLZ4BlockJobs jobs = { 0 };
+        jobs.data = input;
+        jobs.blockOffsets = blockOffsets;
+        jobs.blockSize = blockSize;
+        jobs.baseSize = baseSize;
+        jobs.output = output;
+
+        if ((blockOffsets != NULL) && DecompressLZ4BlockJobs(&jobs, blockCount, data->context->threadCount)) uncompDataSize = (int)baseSize;
+    }
+    else if (output != NULL) uncompDataSize = LZ4_decompress_safe((const char *)input, (char *)output, (int)data->inputSize, (int)baseSize);
+
+    RL_FREE(blockOffsets);
+
+    data->outputSize = (uncompDataSize > 0)? uncompDataSize : 0;
+
+    return (data->outputSize > 0)? 0 : 4;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// Decrypt data in place: AES-256 CTR
+// WARNING: Implementation dependant!
+// rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
+// NOTE: Archive key chunks (RRES_FLAG_ARCHIVE_KEY) store a nonce instead of salt: nonce[16] + MD5[16]
+static int DecryptAES(rresCodecData *data)
+{
+    int result = 0;
+
+    if (data->inputSize < (16 + 16)) return 2;
+
+    unsigned long long dataSize = data->inputSize - 16 - 16;
+
+    // Required variables for key stretching
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t salt[16] = { 0 };                   // Key stretching salt (or chunk nonce)
+
+    // Retrieve salt from chunk packed data
+    // salt is stored at the end of packed data, before MD5: salt[16] + MD5[16]
+    memcpy(salt, data->input + dataSize, 16);
+
+    if ((data->info.flags & RRES_FLAG_ARCHIVE_KEY) != 0)
+    {
+        // Chunk key is derived from archive key and chunk nonce, no key stretching required
+        if (!GetArchiveChunkKey(data->context, salt, 16, key)) result = 5;    // Archive cipher key not available
+    }
+    else
+    {
+        // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+        // NOTE: Derived keys are cached by context, chunks sharing salt derive the key once
+        GetCipherKey(data->context, salt, key);
+    }
+
+    // Wipe key generation secrets, they are no longer needed
+    crypto_wipe(salt, 16);
+
+    if (result == 0)
+    {
+        // Required variables for decryption and message authentication
+        unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
+
+        // Retrieve MD5 from chunk packed data
+        // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
+        memcpy(md5, data->input + dataSize + 16, 4*sizeof(unsigned int));
+
+        // Message decryption, requires key
+        // NOTE: Big chunks are decrypted in parallel (context->threadCount), hardware accelerated if supported
+        AesCtrXcrypt(key, data->input, dataSize, data->context->threadCount);   // AES Counter mode, stream cipher
+
+        // Verify MD5 to check if data decryption worked
+        unsigned int decryptMD5[4] = { 0 };
+        ComputeMD5(data->input, dataSize, decryptMD5);
+
+        if (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0) data->outputSize = dataSize;  // Decrypted successfully!
+        else
+        {
+            // NOTE: Data was decrypted in place, it is encrypted again to keep chunk data unchanged
+            AesCtrXcrypt(key, data->input, dataSize, data->context->threadCount);
+            result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
+        }
+    }
+
+    // Wipe secrets if they are no longer needed
+    crypto_wipe(key, 32);
+
+    return result;
+}
+
+// Decrypt data in place: AES-256 GCM
+// WARNING: Implementation dependant!
+// rrespacker tool appends (salt[16] + nonce[12] + tag[16]) to encrypted data for convenience,
+// NOTE: Archive key chunks (RRES_FLAG_ARCHIVE_KEY) do not store salt: nonce[12] + tag[16]
+static int DecryptAESGCM(rresCodecData *data)
+{
+    int result = 0;
+    bool archiveKey = ((data->info.flags & RRES_FLAG_ARCHIVE_KEY) != 0);
+    unsigned int extraSize = archiveKey? (12 + 16) : (16 + 12 + 16);
+
+    if (data->inputSize < extraSize) return 2;
+
+    unsigned long long dataSize = data->inputSize - extraSize;
+
+    // Required variables for decryption and message authentication
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t nonce[12] = { 0 };                  // nonce used on encryption
+    uint8_t tag[16] = { 0 };                    // Authentication tag generated on encryption
+    uint8_t decryptTag[16] = { 0 };             // Authentication tag computed on decryption
+
+    // Retrieve nonce and tag from chunk packed data
+    // nonce and tag are stored at the end of packed data, after salt: salt[16] + nonce[12] + tag[16]
+    memcpy(nonce, data->input + (data->inputSize - 16 - 12), 12);
+    memcpy(tag, data->input + (data->inputSize - 16), 16);
+
+    if (archiveKey)
+    {
+        // Chunk key is derived from archive key and chunk nonce, no key stretching required
+        if (!GetArchiveChunkKey(data->context, nonce, 12, key)) result = 5;    // Archive cipher key not available
+    }
+    else
+    {
+        // Required variables for key stretching
+        uint8_t salt[16] = { 0 };               // Key stretching salt
+
+        // Retrieve salt from chunk packed data
+        // salt is stored at the end of packed data, before nonce and tag: salt[16] + nonce[12] + tag[16]
+        memcpy(salt, data->input + dataSize, 16);
+
+        // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+        // NOTE: Derived keys are cached by context, chunks sharing salt derive the key once
+        GetCipherKey(data->context, salt, key);
+
+        // Wipe key generation secrets, they are no longer needed
+        crypto_wipe(salt, 16);
+    }
+
+    if (result == 0)
+    {
+        // Message authentication and decryption in a single pass over data (in place)
+        bool decrypted = AesGcmXcrypt(key, nonce, data->input, dataSize, decryptTag, false);
+
+        if (decrypted && (crypto_verify16(tag, decryptTag) == 0)) data->outputSize = dataSize;    // Decrypted successfully!
+        else
+        {
+            // NOTE: Data was decrypted in place, it is encrypted again to keep chunk data unchanged
+            if (decrypted) AesGcmXcrypt(key, nonce, data->input, dataSize, decryptTag, true);
+            result = 2;    // Data was not authenticated, wrong password or message corrupted
+        }
+    }
+
+    // Wipe secrets if they are no longer needed
+    crypto_wipe(nonce, 12);
+    crypto_wipe(key, 32);
+    crypto_wipe(decryptTag, 16);
+
+    return result;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+// Decrypt data in place: XChaCha20-Poly1305
+// WARNING: Implementation dependant!
+// rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
+// NOTE: Archive key chunks (RRES_FLAG_ARCHIVE_KEY) do not store salt: nonce[24] + MAC[16]
+static int DecryptXChaCha20(rresCodecData *data)
+{
+    int result = 0;
+    bool archiveKey = ((data->info.flags & RRES_FLAG_ARCHIVE_KEY) != 0);
+    unsigned int extraSize = archiveKey? (24 + 16) : (16 + 24 + 16);
+
+    if (data->inputSize < extraSize) return 2;
+
+    unsigned long long dataSize = data->inputSize - extraSize;
+
+    // Required variables for decryption and message authentication
+    uint8_t key[32] = { 0 };                    // Encryption key
+    uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
+    uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+
+    // Retrieve nonce and MAC from chunk packed data
+    // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
+    memcpy(nonce, data->input + (data->inputSize - 16 - 24), 24);
+    memcpy(mac, data->input + (data->inputSize - 16), 16);
+
+    if (archiveKey)
+    {
+        // Chunk key is derived from archive key and chunk nonce, no key stretching required
+        if (!GetArchiveChunkKey(data->context, nonce, 24, key)) result = 5;    // Archive cipher key not available
+    }
+    else
+    {
+        // Required variables for key stretching
+        uint8_t salt[16] = { 0 };               // Key stretching salt
+
+        // Retrieve salt from chunk packed data
+        // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
+        memcpy(salt, data->input + dataSize, 16);
+
+        // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+        // NOTE: Derived keys are cached by context, chunks sharing salt derive the key once
+        GetCipherKey(data->context, salt, key);
+
+        // Wipe key generation secrets, they are no longer needed
+        crypto_wipe(salt, 16);
+    }
+
+    // Message decryption requires key, nonce and MAC
+    // NOTE: MAC is verified before decryption, data is only decrypted (in place) if authenticated
+    if ((result == 0) && (crypto_aead_unlock(data->input, mac, key, nonce, NULL, 0, data->input, (size_t)dataSize) == 0)) data->outputSize = dataSize;
+    else if (result == 0) result = 2;   // Wrong password or message corrupted
+
+    // Wipe secrets if they are no longer needed
+    crypto_wipe(nonce, 24);
+    crypto_wipe(key, 32);
+
+    return result;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+// Derive cipher key from password and salt
+// NOTE: Key stretching work area is allocated if not provided (*workArea == NULL), it's wiped after use
+static void DeriveCipherKey(const char *password, const unsigned char *salt, unsigned char *key, void **workArea)
+{
+    // Key stretching configuration
+    crypto_argon2_config config = {
+        .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
+        .nb_blocks = RRES_KDF_ARGON2I_BLOCKS,   // Blocks: 16 MB
+        .nb_passes = RRES_KDF_ARGON2I_PASSES,   // Iterations
+        .nb_lanes  = RRES_KDF_ARGON2I_LANES     // Single-threaded
+    };
+    crypto_argon2_inputs inputs = {
+        .pass = (const uint8_t *)password,      // User password
+        .pass_size = (uint32_t)strlen(password),    // Password length
+        .salt = salt,                           // Salt for the password
+        .salt_size = 16
+    };
+    crypto_argon2_extras extras = { 0 };        // Extra parameters unused
+
+    if (*workArea == NULL) *workArea = RL_MALLOC(config.nb_blocks*1024);
+
+    // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+    crypto_argon2(key, 32, *workArea, config, inputs, extras);
+
+    crypto_wipe(*workArea, config.nb_blocks*1024);
+}
+
+// Get cipher key for context password and salt
+// NOTE: Key is derived (Argon2i) only if not available in context keys cache,
+// cache is allocated in locked memory on first use, if allocation fails the key is just derived
+static void GetCipherKey(rresUnpackContext *context, const unsigned char *salt, unsigned char *key)
+{
+    rresCipherKeyCache *cache = (rresCipherKeyCache *)context->keyCache;
+    unsigned char passHash[32] = { 0 };
+
+    crypto_blake2b(passHash, 32, (const uint8_t *)context->password, strlen(context->password));
+
+    if (cache == NULL)
+    {
+        cache = (rresCipherKeyCache *)RL_CALLOC(1, sizeof(rresCipherKeyCache));
+
+        if (cache != NULL)
+        {
+#if defined(_WIN32)
+            cache->locked = (VirtualLock(cache, sizeof(rresCipherKeyCache)) != 0);
+#else
+            cache->locked = (mlock(cache, sizeof(rresCipherKeyCache)) == 0);
+#endif
+            if (!cache->locked) RRES_LOG("RRES: WARNING: Cipher keys cache memory could not be locked\n");
+        }
+
+        context->keyCache = cache;
+    }
+
+    bool found = false;
+
+    for (unsigned int i = 0; (cache != NULL) && (i < cache->count); i++)
+    {
+        if ((crypto_verify32(cache->keys[i].passHash, passHash) == 0) && (crypto_verify16(cache->keys[i].salt, salt) == 0))
+        {
+            memcpy(key, cache->keys[i].key, 32);
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        DeriveCipherKey(context->password, salt, key, &context->workArea);
+
+        if (cache != NULL)
+        {
+            rresCipherKey *cached = &cache->keys[cache->next];
+
+            memcpy(cached->passHash, passHash, 32);
+            memcpy(cached->salt, salt, 16);
+            memcpy(cached->key, key, 32);
+
+            if (cache->count < RRES_CIPHER_KEY_CACHE_SIZE) cache->count++;
+            cache->next = (cache->next + 1)%RRES_CIPHER_KEY_CACHE_SIZE;
+        }
+    }
+
+    crypto_wipe(passHash, 32);
+}
+
+// Get chunk cipher key from context archive key and chunk nonce
+// NOTE: Archive key must be previously loaded with LoadArchiveCipherKey()
+static bool GetArchiveChunkKey(rresUnpackContext *context, const unsigned char *nonce, unsigned int nonceSize, unsigned char *key)
+{
+    rresCipherKeyCache *cache = (rresCipherKeyCache *)context->keyCache;
+
+    if ((cache == NULL) || !cache->archiveKeyLoaded) return false;
+
+    DeriveChunkKey(cache->archiveKey, nonce, nonceSize, key);
+
+    return true;
+}
+
+// Derive chunk cipher key from archive key and nonce
+// NOTE: BLAKE2b keyed with archive key over (label, nonce), cheap compared to key stretching
+static void DeriveChunkKey(const unsigned char *archiveKey, const unsigned char *nonce, unsigned int nonceSize, unsigned char *key)
+{
+    const unsigned char label = 'k';
+
+    crypto_blake2b_ctx ctx = { 0 };
+    crypto_blake2b_keyed_init(&ctx, 32, archiveKey, 32);
+    crypto_blake2b_update(&ctx, &label, 1);
+    crypto_blake2b_update(&ctx, nonce, nonceSize);
+    crypto_blake2b_final(&ctx, key);
+}
+
+// Derive deterministic bytes from pack seed and chunk data
+// NOTE: BLAKE2b keyed with seed over (label, type, data), different chunks data get different salt/nonce,
+// resource id is not considered so identical chunks data get identical packed data (deduplicated by writer)
+static void DerivePackBytes(const rresPackContext *context, const rresPackItem *item, const unsigned char *data, unsigned int size, unsigned char label, unsigned char *bytes, unsigned int count)
+{
+    crypto_blake2b_ctx ctx = { 0 };
+    crypto_blake2b_keyed_init(&ctx, count, context->seed, 32);
+    crypto_blake2b_update(&ctx, &label, 1);
+    crypto_blake2b_update(&ctx, item->info.type, 4);
+    crypto_blake2b_update(&ctx, data, size);
+    crypto_blake2b_final(&ctx, bytes);
+}
+#endif
+
+// Unload derived cipher keys cache
+// NOTE: Keys are wiped before memory is unlocked and freed
+static void UnloadCipherKeyCache(void *keyCache)
+{
+    rresCipherKeyCache *cache = (rresCipherKeyCache *)keyCache;
+
+    if (cache != NULL)
+    {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        bool locked = cache->locked;
+        crypto_wipe(cache, sizeof(rresCipherKeyCache));
+    #if defined(_WIN32)
+        if (locked) VirtualUnlock(cache, sizeof(rresCipherKeyCache));
+    #else
+        if (locked) munlock(cache, sizeof(rresCipherKeyCache));
+    #endif
+#endif
+        RL_FREE(cache);
+    }
+}
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// AES-256 CTR encryption/decryption
+// NOTE 1: Counter block is a 128bit big-endian integer starting at 0 (same as aes.h with zero IV),
+// data bigger than RRES_AES_JOB_SIZE is split on counter block boundaries and processed in parallel
+// NOTE 2: Expanded round keys are wiped after use
+static void AesCtrXcrypt(const unsigned char *key, unsigned char *data, unsigned long long size, unsigned int threadCount)
+{
+    struct AES_ctx ctx = { 0 };
+    AES_init_ctx(&ctx, key);
+
+    unsigned int jobCount = (unsigned int)((size + RRES_AES_JOB_SIZE - 1)/RRES_AES_JOB_SIZE);
+
+    if ((threadCount > 1) && (jobCount > 1))
+    {
+        rresAesCtrJobs jobs = { &ctx, data, size };
+        rresParallelFor(AesCtrJob, &jobs, jobCount, threadCount);
+    }
+    else AesCtrXcryptBlocks(&ctx, data, size, NULL, 0);
+
+    crypto_wipe(&ctx, sizeof(struct AES_ctx));
+}
+
+// AES-256 CTR encryption/decryption starting at provided counter block
+// NOTE 1: Counter block is nonce[8] (zeros if NULL) followed by the 64bit big-endian counter
+// NOTE 2: Backend is selected on runtime: AES-NI, ARMv8 Crypto Extensions or aes.h (software)
+static void AesCtrXcryptBlocks(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter)
+{
+#if defined(RRES_AES_NI)
+    if ((GetAesCpuFeatures() & 1) != 0)
+    {
+        AesCtrXcryptNI(ctx, data, size, nonce, counter);
+        return;
+    }
+#elif defined(RRES_AES_ARMV8)
+    AesCtrXcryptARMv8(ctx, data, size, nonce, counter);
+    return;
+#endif
+
+    // Software fallback (aes.h), one byte at a time
+    struct AES_ctx blockCtx = *ctx;
+    for (int i = 0; i < 8; i++) blockCtx.Iv[15 - i] = (uint8_t)(counter >> (8*i));
+    if (nonce != NULL) memcpy(blockCtx.Iv, nonce, 8);
+    else memset(blockCtx.Iv, 0, 8);
+
+    AES_CTR_xcrypt_buffer(&blockCtx, data, (size_t)size);
+
+    crypto_wipe(&blockCtx, sizeof(struct AES_ctx));
+}
+
+// AES-256 GCM encryption/decryption
+// NOTE 1: Data is processed in segments (RRES_AES_GCM_SEGMENT_SIZE): every segment is authenticated (GHASH over
+// ciphertext) and encrypted/decrypted while it's in cache, so data is only read once from memory
+// NOTE 2: Data is always encrypted/decrypted in place, on decryption it's up to the caller to verify the tag
+// and to encrypt the data again if verification fails, no additional authenticated data is used
+static bool AesGcmXcrypt(const unsigned char *key, const unsigned char *nonce, unsigned char *data, unsigned long long size, unsigned char *tag, bool encrypt)
+{
+    // GCM limit: 2^32 - 2 counter blocks per message
+    if (size > 0xfffffffeULL*16) return false;
+
+    struct AES_ctx ctx = { 0 };
+    AES_init_ctx(&ctx, key);
+
+    rresGhash ghash = { 0 };
+    unsigned char tagMask[16] = { 0 };
+
+    // NOTE: Counter block: nonce[12] + 32bit big-endian counter, it's processed as
+    // nonce[8] + 64bit counter (nonce[8..11] in upper 32bit), counter 1 masks the tag, data starts at 2
+    unsigned long long counter = ((unsigned long long)nonce[8] << 56) | ((unsigned long long)nonce[9] << 48) |
+                                 ((unsigned long long)nonce[10] << 40) | ((unsigned long long)nonce[11] << 32);
+
+    AesCtrXcryptBlocks(&ctx, ghash.h, 16, NULL, 0);             // H = AES(key, 0^128)
+    AesCtrXcryptBlocks(&ctx, tagMask, 16, nonce, counter | 1);  // AES(key, J0)
+
+    for (unsigned long long offset = 0; offset < size; offset += RRES_AES_GCM_SEGMENT_SIZE)
+    {
+        unsigned long long segmentSize = size - offset;
+        if (segmentSize > RRES_AES_GCM_SEGMENT_SIZE) segmentSize = RRES_AES_GCM_SEGMENT_SIZE;
+
+        if (!encrypt) GhashUpdate(&ghash, data + offset, segmentSize);
+        AesCtrXcryptBlocks(&ctx, data + offset, segmentSize, nonce, (counter | 2) + offset/16);
+        if (encrypt) GhashUpdate(&ghash, data + offset, segmentSize);
+    }
+
+    // Lengths block: additional data bits (0) + ciphertext bits, 64bit big-endian
+    unsigned char lengths[16] = { 0 };
+    for (int i = 0; i < 8; i++) lengths[15 - i] = (unsigned char)((size*8) >> (8*i));
+    GhashUpdate(&ghash, lengths, 16);
+
+    for (int i = 0; i < 16; i++) tag[i] = ghash.x[i]^tagMask[i];
+
+    crypto_wipe(&ctx, sizeof(struct AES_ctx));
+    crypto_wipe(&ghash, sizeof(rresGhash));
+    crypto_wipe(tagMask, 16);
+
+    return true;
+}
+
+// GHASH data, last block is zero padded
+// NOTE: Backend is selected on runtime: PCLMULQDQ or software
+static void GhashUpdate(rresGhash *ghash, const unsigned char *data, unsigned long long size)
+{
+#if defined(RRES_AES_NI)
+    if ((GetAesCpuFeatures() & 2) != 0)
+    {
+        GhashUpdateCLMUL(ghash, data, size);
+        return;
+    }
+#endif
+
+    for (unsigned long long offset = 0; offset < size; offset += 16)
+    {
+        unsigned int blockSize = ((size - offset) < 16)? (unsigned int)(size - offset) : 16;
+
+        for (unsigned int i = 0; i < blockSize; i++) ghash->x[i] ^= data[offset + i];
+        GhashMultiply(ghash->x, ghash->h);
+    }
+}
+
+// GHASH multiply in GF(2^128): x = x*h
+// NOTE: Bit by bit multiplication (GCM bit order), constant time, used when PCLMULQDQ is not available
+static void GhashMultiply(unsigned char *x, const unsigned char *h)
+{
+    unsigned long long xh = 0, xl = 0, vh = 0, vl = 0, zh = 0, zl = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        xh = (xh << 8) | x[i];
+        xl = (xl << 8) | x[8 + i];
+        vh = (vh << 8) | h[i];
+        vl = (vl << 8) | h[8 + i];
+    }
+
+    for (int i = 0; i < 128; i++)
+    {
+        unsigned long long bit = (i < 64)? ((xh >> (63 - i)) & 1) : ((xl >> (127 - i)) & 1);
+        unsigned long long mask = 0ULL - bit;
+
+        zh ^= (vh & mask);
+        zl ^= (vl & mask);
+
+        unsigned long long reduce = 0ULL - (vl & 1);
+        vl = (vl >> 1) | (vh << 63);
+        vh = (vh >> 1)^(0xe100000000000000ULL & reduce);
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        x[i] = (unsigned char)(zh >> (56 - 8*i));
+        x[8 + i] = (unsigned char)(zl >> (56 - 8*i));
+    }
+}
+
+#if defined(RRES_AES_NI)
+// Get x86 AES CPU features: AES-NI (1), PCLMULQDQ + SSSE3 (2)
+// NOTE: Multiple threads could check it at the same time, all of them compute the same result,
+// features are accessed atomically so concurrent unpacking threads do not race on it
+static int GetAesCpuFeatures(void)
+{
+    long features = RRES_ATOMIC_LOAD(&aesCpuFeatures);
+
+    if (features < 0)
+    {
+        unsigned int ecx = 0;
+    #if defined(_MSC_VER)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        ecx = (unsigned int)info[2];
+    #else
+        unsigned int eax = 0, ebx = 0, edx = 0;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) ecx = 0;
+    #endif
+        // CPUID.1:ECX: AES[bit 25], PCLMULQDQ[bit 1], SSSE3[bit 9]
+        features = (((ecx & (1u << 25)) != 0)? 1 : 0) | ((((ecx & (1u << 1)) != 0) && ((ecx & (1u << 9)) != 0))? 2 : 0);
+        RRES_ATOMIC_STORE(&aesCpuFeatures, features);
+    }
+
+    return (int)features;
+}
+#endif
+
+// AES CTR job: encrypt/decrypt one data part
+static void AesCtrJob(void *jobs, unsigned int index)
+{
+    rresAesCtrJobs *aesJobs = (rresAesCtrJobs *)jobs;
+    unsigned long long offset = (unsigned long long)index*RRES_AES_JOB_SIZE;
+    unsigned long long size = aesJobs->size - offset;
+
+    if (size > RRES_AES_JOB_SIZE) size = RRES_AES_JOB_SIZE;
+
+    AesCtrXcryptBlocks(aesJobs->ctx, aesJobs->data + offset, size, NULL, offset/AES_BLOCKLEN);
+}
+
+#if defined(RRES_AES_NI)
+// AES CTR: x86 AES-NI backend
+// NOTE: 8 counter blocks are processed at once to hide aesenc latency, round keys come from aes.h key expansion
+RRES_AES_NI_TARGET static void AesCtrXcryptNI(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter)
+{
+    __m128i roundKeys[15];
+    for (int r = 0; r < 15; r++) roundKeys[r] = _mm_loadu_si128((const __m128i *)(ctx->RoundKey + 16*r));
+
+    long long prefix = 0;
+    if (nonce != NULL) memcpy(&prefix, nonce, 8);
+
+    // Counter block from nonce[8] and 64bit counter (big-endian)
+    // NOTE: Byte swap is written with shifts, compilers reduce it to a single instruction
+    #define RRES_AES_NI_COUNTER(n) _mm_set_epi64x((long long)( \
+        (((n) & 0xffULL) << 56) | (((n) & 0xff00ULL) << 40) | (((n) & 0xff0000ULL) << 24) | (((n) & 0xff000000ULL) << 8) | \
+        (((n) >> 8) & 0xff000000ULL) | (((n) >> 24) & 0xff0000ULL) | (((n) >> 40) & 0xff00ULL) | ((n) >> 56)), prefix)
+
+    // NOTE: Rounds are written unrolled for the 8 blocks, so they are kept in registers
+    #define RRES_AES_NI_ROUND8(op, roundKey) \
+        b0 = op(b0, roundKey); b1 = op(b1, roundKey); b2 = op(b2, roundKey); b3 = op(b3, roundKey); \
+        b4 = op(b4, roundKey); b5 = op(b5, roundKey); b6 = op(b6, roundKey); b7 = op(b7, roundKey)
+
+    while (size >= 8*16)
+    {
+        __m128i b0 = RRES_AES_NI_COUNTER(counter), b1 = RRES_AES_NI_COUNTER(counter + 1);
+        __m128i b2 = RRES_AES_NI_COUNTER(counter + 2), b3 = RRES_AES_NI_COUNTER(counter + 3);
+        __m128i b4 = RRES_AES_NI_COUNTER(counter + 4), b5 = RRES_AES_NI_COUNTER(counter + 5);
+        __m128i b6 = RRES_AES_NI_COUNTER(counter + 6), b7 = RRES_AES_NI_COUNTER(counter + 7);
+
+        RRES_AES_NI_ROUND8(_mm_xor_si128, roundKeys[0]);
+        for (int r = 1; r < 14; r++) { RRES_AES_NI_ROUND8(_mm_aesenc_si128, roundKeys[r]); }
+        RRES_AES_NI_ROUND8(_mm_aesenclast_si128, roundKeys[14]);
+
+        _mm_storeu_si128((__m128i *)(data + 0*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 0*16)), b0));
+        _mm_storeu_si128((__m128i *)(data + 1*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 1*16)), b1));
+        _mm_storeu_si128((__m128i *)(data + 2*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 2*16)), b2));
+        _mm_storeu_si128((__m128i *)(data + 3*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 3*16)), b3));
+        _mm_storeu_si128((__m128i *)(data + 4*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 4*16)), b4));
+        _mm_storeu_si128((__m128i *)(data + 5*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 5*16)), b5));
+        _mm_storeu_si128((__m128i *)(data + 6*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 6*16)), b6));
+        _mm_storeu_si128((__m128i *)(data + 7*16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 7*16)), b7));
+
+        counter += 8;
+        data += 8*16;
+        size -= 8*16;
+    }
+
+    while (size > 0)
+    {
+        __m128i block = _mm_xor_si128(RRES_AES_NI_COUNTER(counter), roundKeys[0]);
+        for (int r = 1; r < 14; r++) block = _mm_aesenc_si128(block, roundKeys[r]);
+        block = _mm_aesenclast_si128(block, roundKeys[14]);
+
+        if (size >= 16)
+        {
+            _mm_storeu_si128((__m128i *)data, _mm_xor_si128(_mm_loadu_si128((const __m128i *)data), block));
+            data += 16;
+            size -= 16;
+        }
+        else
+        {
+            // Last partial block
+            unsigned char keyStream[16];
+            _mm_storeu_si128((__m128i *)keyStream, block);
+            for (unsigned int i = 0; i < size; i++) data[i] ^= keyStream[i];
+            crypto_wipe(keyStream, 16);
+            size = 0;
+        }
+
+        counter++;
+    }
+
+    #undef RRES_AES_NI_ROUND8
+    #undef RRES_AES_NI_COUNTER
+
+    crypto_wipe(roundKeys, sizeof(roundKeys));
+}
+
+// GHASH: x86 PCLMULQDQ backend
+// NOTE: Carry-less multiplication and reduction on byte reflected values (Intel CLMUL white paper),
+// 4 blocks are aggregated with powers of H (H^4, H^3, H^2, H) so only one reduction is required
+RRES_PCLMUL_TARGET static void GhashUpdateCLMUL(rresGhash *ghash, const unsigned char *data, unsigned long long size)
+{
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ghash->x), reverse);
+    __m128i h[4] = { 0 };       // Powers of H: h[i] = H^(i + 1)
+    __m128i lo, hi, mid;
+
+    // Carry-less multiplication, 256bit product accumulated into (lo, hi)
+    #define RRES_GHASH_CLMUL(a, b) \
+        lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(a, b, 0x00)); \
+        hi = _mm_xor_si128(hi, _mm_clmulepi64_si128(a, b, 0x11)); \
+        mid = _mm_xor_si128(mid, _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01)))
+
+    // Reduction of 256bit product (lo, hi) modulo x^128 + x^7 + x^2 + x + 1 into result
+    #define RRES_GHASH_REDUCE(result) { \
+        lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8)); \
+        hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8)); \
+        __m128i carryLo = _mm_srli_epi32(lo, 31); \
+        __m128i carryHi = _mm_srli_epi32(hi, 31); \
+        lo = _mm_slli_epi32(lo, 1); \
+        hi = _mm_slli_epi32(hi, 1); \
+        hi = _mm_or_si128(hi, _mm_or_si128(_mm_slli_si128(carryHi, 4), _mm_srli_si128(carryLo, 12))); \
+        lo = _mm_or_si128(lo, _mm_slli_si128(carryLo, 4)); \
+        __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25)); \
+        __m128i tHi = _mm_srli_si128(t, 4); \
+        lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12)); \
+        __m128i r = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7)); \
+        result = _mm_xor_si128(hi, _mm_xor_si128(lo, _mm_xor_si128(r, tHi))); }
+
+    h[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ghash->h), reverse);
+
+    for (int i = 1; i < 4; i++)
+    {
+        lo = hi = mid = _mm_setzero_si128();
+        RRES_GHASH_CLMUL(h[i - 1], h[0]);
+        RRES_GHASH_REDUCE(h[i]);
+    }
+
+    unsigned long long offset = 0;
+
+    for (; (size - offset) >= 4*16; offset += 4*16)
+    {
+        __m128i b0 = _mm_xor_si128(x, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + offset)), reverse));
+        __m128i b1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + offset + 16)), reverse);
+        __m128i b2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + offset + 32)), reverse);
+        __m128i b3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + offset + 48)), reverse);
+
+        lo = hi = mid = _mm_setzero_si128();
+        RRES_GHASH_CLMUL(b0, h[3]);
+        RRES_GHASH_CLMUL(b1, h[2]);
+        RRES_GHASH_CLMUL(b2, h[1]);
+        RRES_GHASH_CLMUL(b3, h[0]);
+        RRES_GHASH_REDUCE(x);
+    }
+
+    for (; offset < size; offset += 16)
+    {
+        __m128i block;
+
+        if ((size - offset) >= 16) block = _mm_loadu_si128((const __m128i *)(data + offset));
+        else
+        {
+            unsigned char padded[16] = { 0 };
+            memcpy(padded, data + offset, (size_t)(size - offset));
+            block = _mm_loadu_si128((const __m128i *)padded);
+        }
+
+        x = _mm_xor_si128(x, _mm_shuffle_epi8(block, reverse));
+
+        lo = hi = mid = _mm_setzero_si128();
+        RRES_GHASH_CLMUL(x, h[0]);
+        RRES_GHASH_REDUCE(x);
+    }
+
+    #undef RRES_GHASH_CLMUL
+    #undef RRES_GHASH_REDUCE
+
+    _mm_storeu_si128((__m128i *)ghash->x, _mm_shuffle_epi8(x, reverse));
+    crypto_wipe(h, sizeof(h));
+}
+#endif
 
-// Load data chunk: RRES_DATA_TEXT
-// NOTE: This chunk can be used for shaders or other text data elements (materials?)
-static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+#if defined(RRES_AES_ARMV8)
+// AES CTR: ARMv8 Crypto Extensions backend
+// NOTE: AESE includes AddRoundKey, last round key is added separately, round keys come from aes.h key expansion
+static void AesCtrXcryptARMv8(const struct AES_ctx *ctx, unsigned char *data, unsigned long long size, const unsigned char *nonce, unsigned long long counter)
 {
-    char *text = NULL;
+    uint8x16_t roundKeys[15];
+    for (int r = 0; r < 15; r++) roundKeys[r] = vld1q_u8(ctx->RoundKey + 16*r);
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    unsigned char counterBlock[16] = { 0 };
+    if (nonce != NULL) memcpy(counterBlock, nonce, 8);
+
+    while (size > 0)
     {
-        text = (char *)RL_CALLOC(chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
-        if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+        // Counter block from nonce[8] and 64bit counter (big-endian)
+        for (int i = 0; i < 8; i++) counterBlock[15 - i] = (unsigned char)(counter >> (8*i));
 
-        // TODO: We got some extra text properties, in case they could be useful for users:
-        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
-        *codeLang = chunk.data.props[2];
-        //chunks.props[3]:cultureCode could be useful for localized text
+        uint8x16_t block = vld1q_u8(counterBlock);
+        for (int r = 0; r < 13; r++) block = vaesmcq_u8(vaeseq_u8(block, roundKeys[r]));
+        block = veorq_u8(vaeseq_u8(block, roundKeys[13]), roundKeys[14]);
+
+        if (size >= 16)
+        {
+            vst1q_u8(data, veorq_u8(vld1q_u8(data), block));
+            data += 16;
+            size -= 16;
+        }
+        else
+        {
+            // Last partial block
+            unsigned char keyStream[16];
+            vst1q_u8(keyStream, block);
+            for (unsigned int i = 0; i < size; i++) data[i] ^= keyStream[i];
+            crypto_wipe(keyStream, 16);
+            size = 0;
+        }
+
+        counter++;
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return text;
+    crypto_wipe(roundKeys, sizeof(roundKeys));
 }
+#endif
+#endif
 
-// Load data chunk: RRES_DATA_IMAGE
-// NOTE: Many data types use images data in some way (font, material...)
-static Image LoadImageFromResourceChunk(rresResourceChunk chunk)
+// Compute MD5 hash code
+// NOTE: Hash is written into provided unsigned int[4] array
+static void ComputeMD5(const unsigned char *data, unsigned long long size, unsigned int *hash)
 {
-    Image image = { 0 };
+    rresMD5 md5 = { 0 };
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
-    {
-        image.width = chunk.data.props[0];
-        image.height = chunk.data.props[1];
-        int format = chunk.data.props[2];
+    MD5Init(&md5);
+    MD5Update(&md5, data, size);
+    MD5Final(&md5, hash);
+}
 
-        // Assign equivalent pixel formats for our engine
-        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
-        switch (format)
-        {
-            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
-            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
-            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
-            default: break;
-        }
+// Init MD5 hash state
+static void MD5Init(rresMD5 *md5)
+{
+    md5->hash[0] = 0x67452301;
+    md5->hash[1] = 0xefcdab89;
+    md5->hash[2] = 0x98badcfe;
+    md5->hash[3] = 0x10325476;
+    md5->size = 0;
+}
 
-        image.mipmaps = chunk.data.props[3];
+// Update MD5 hash with provided data
+// NOTE: Data is processed in 64 bytes blocks, remaining bytes are kept in state until next update
+static void MD5Update(rresMD5 *md5, const unsigned char *data, unsigned long long size)
+{
+    unsigned int pending = (unsigned int)(md5->size%64);
+    md5->size += size;
 
-        // Image data size can be computed from image properties
-        unsigned int size = GetPixelDataSize(image.width, image.height, image.format);
+    // Complete pending block first
+    if (pending > 0)
+    {
+        unsigned int count = ((64 - pending) < size)? (64 - pending) : (unsigned int)size;
+        memcpy(md5->block + pending, data, count);
+        data += count;
+        size -= count;
 
-        // NOTE: Computed image data must match the data size of the chunk processed (minus propCount + props[4] size)
-        if (size == (chunk.info.baseSize - 20))
-        {
-            image.data = RL_CALLOC(size, 1);
-            if (image.data != NULL) memcpy(image.data, chunk.data.raw, size);
-        }
-        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
+        if ((pending + count) < 64) return;
+        MD5ProcessBlock(md5->hash, md5->block);
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return image;
+    for (; size >= 64; data += 64, size -= 64) MD5ProcessBlock(md5->hash, data);
+
+    if (size > 0) memcpy(md5->block, data, (size_t)size);
 }
 
-// Get file extension from RRES_DATA_RAW properties (unsigned int) 
-static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02)
+// Finish MD5 hash
+// NOTE: Message is padded with a '1' bit and '0' bits until length in bits is 448 (mod 512), then length is appended,
+// WARNING: Length is appended as 32bit (64bit field upper bytes are 0), same as previous implementation
+static void MD5Final(rresMD5 *md5, unsigned int *hash)
 {
-    static char extension[8] = { 0 };
-    memset(extension, 0, 8);
+    unsigned char padding[72] = { 0 };
+    unsigned int pending = (unsigned int)(md5->size%64);
+    unsigned int paddingSize = (pending < 56)? (56 - pending) : (120 - pending);
+    unsigned int bitsLen = (unsigned int)(8*md5->size);
 
-    // Convert file extension provided as 2 unsigned int properties, to a char[] array 
-    // NOTE: Extension is defined as 2 unsigned int big-endian values (4 bytes each), 
-    // starting with a dot, i.e 0x2e706e67 => ".png"
-    extension[0] = (unsigned char)((ext01 & 0xff000000) >> 24);
-    extension[1] = (unsigned char)((ext01 & 0x00ff0000) >> 16);
-    extension[2] = (unsigned char)((ext01 & 0x0000ff00) >> 8);
-    extension[3] = (unsigned char)(ext01 & 0x000000ff);
+    padding[0] = 128;                           // Write the "1" bit
+    memcpy(padding + paddingSize, &bitsLen, 4);  // We append the len in bits at the end of the buffer
 
-    extension[4] = (unsigned char)((ext02 & 0xff000000) >> 24);
-    extension[5] = (unsigned char)((ext02 & 0x00ff0000) >> 16);
-    extension[6] = (unsigned char)((ext02 & 0x0000ff00) >> 8);
-    extension[7] = (unsigned char)(ext02 & 0x000000ff);
+    unsigned long long size = md5->size;
+    MD5Update(md5, padding, paddingSize + 8);
+    md5->size = size;
 
-    return extension;
+    memcpy(hash, md5->hash, 4*sizeof(unsigned int));
 }
 
-// Compute MD5 hash code, returns 4 integers array (static)
-static unsigned int *ComputeMD5(unsigned char *data, int size)
+// Process MD5 64 bytes block
+static void MD5ProcessBlock(unsigned int *hash, const unsigned char *block)
 {
 #define LEFTROTATE(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
 
-    static unsigned int hash[4] = { 0 };
-
     // NOTE: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
 
     // r specifies the per-round shift amounts
-    unsigned int r[] = {
+    static const unsigned int r[] = {
         7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
         5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
         4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
         6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
     };
 
-    // Use binary integer part of the sines of integers (in radians) as constants// Initialize variables:
-    unsigned int k[] = {
+    // Use binary integer part of the sines of integers (in radians) as constants
+    static const unsigned int k[] = {
         0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
         0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
         0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
@@ -1012,83 +4867,460 @@ static unsigned int *ComputeMD5(unsigned char *data, int size)
         0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
     };
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+    // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
+    unsigned int w[16] = { 0 };
+    memcpy(w, block, 64);
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+    // Initialize hash value for this chunk
+    unsigned int a = hash[0];
+    unsigned int b = hash[1];
+    unsigned int c = hash[2];
+    unsigned int d = hash[3];
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+    for (int i = 0; i < 64; i++)
+    {
+        unsigned int f, g;
+
+        if (i < 16)
+        {
+            f = (b & c) | ((~b) & d);
+            g = i;
+        }
+        else if (i < 32)
+        {
+            f = (d & b) | ((~d) & c);
+            g = (5*i + 1)%16;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3*i + 5)%16;
+        }
+        else
+        {
+            f = c ^ (b | (~d));
+            g = (7*i)%16;
+        }
 
-    int newDataSize = ((((size + 8)/64) + 1)*64) - 8;
+        unsigned int temp = d;
+        d = c;
+        c = b;
+        b = b + LEFTROTATE((a + f + k[i] + w[g]), r[i]);
+        a = temp;
+    }
 
-    unsigned char *msg = (unsigned char *)RL_CALLOC(newDataSize + 64, 1);   // Also appends "0" bits (we alloc also 64 extra bytes...)
-    memcpy(msg, data, size);
-    msg[size] = 128;                 // Write the "1" bit
+    // Add chunk's hash to result so far
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
 
-    unsigned int bitsLen = 8*size;
-    memcpy(msg + newDataSize, &bitsLen, 4);  // We append the len in bits at the end of the buffer
+#undef LEFTROTATE
+}
 
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+// Open unpack stream
+// NOTE: Additional cipher data (salt, nonce, MAC...) is read first from the end of packed data,
+// cipher key is derived and cipher/authentication state initialized, no encrypted data is read
+static int OpenUnpackStream(rresUnpackStream *stream, rresChunkReader *reader, rresResourceChunkInfo info, rresUnpackContext *context)
+{
+    int result = 0;
+    unsigned int nonceSize = 0;     // AES: salt[16] (or nonce[16]), AES GCM: nonce[12], XChaCha20-Poly1305: nonce[24]
+    unsigned int saltSize = 0;      // Key stretching salt[16], not stored for AES (nonce is the salt) or archive key chunks
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+    stream->reader = reader;
+    stream->cipherType = info.cipherType;
 
-        for (int i = 0; i < 64; i++)
+    switch (info.cipherType)
+    {
+        case RRES_CIPHER_NONE: break;
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        case RRES_CIPHER_AES: nonceSize = 16; break;
+        case RRES_CIPHER_AES_GCM: nonceSize = 12; saltSize = ((info.flags & RRES_FLAG_ARCHIVE_KEY) != 0)? 0 : 16; break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        case RRES_CIPHER_XCHACHA20_POLY1305: nonceSize = 24; saltSize = ((info.flags & RRES_FLAG_ARCHIVE_KEY) != 0)? 0 : 16; break;
+#endif
+        default:
         {
-            unsigned int f, g;
+            result = 1;    // Decryption algorithm not supported
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+        } break;
+    }
+
+    if (result != 0) return result;
+
+    // Packed data: encrypted data + salt[16] + nonce + MAC[16] (MD5 or tag)
+    stream->extraSize = (info.cipherType == RRES_CIPHER_NONE)? 0 : (saltSize + nonceSize + 16);
+    stream->dataSize = (info.packedSize >= stream->extraSize)? (info.packedSize - stream->extraSize) : 0;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    if (info.cipherType != RRES_CIPHER_NONE)
+    {
+        uint8_t extra[56] = { 0 };      // Additional cipher data: salt[16] + nonce[24] + MAC[16] (biggest)
+        uint8_t key[32] = { 0 };        // Encryption key
+        const uint8_t *nonce = extra + saltSize;
+
+        if ((info.packedSize < stream->extraSize) || !rresReadChunkDataAt(reader, stream->dataSize, extra, stream->extraSize)) return 6;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        // GCM limit: 2^32 - 2 counter blocks per message
+        // NOTE: Checked before cipher key setup, no cipher state to be wiped on failure
+        if ((info.cipherType == RRES_CIPHER_AES_GCM) && (stream->dataSize > 0xfffffffeULL*16)) return 6;
+#endif
+
+        memcpy(stream->mac, extra + saltSize + nonceSize, 16);
 
-            if (i < 16)
+        if ((info.flags & RRES_FLAG_ARCHIVE_KEY) != 0)
+        {
+            // Chunk key is derived from archive key and chunk nonce, no key stretching required
+            if (!GetArchiveChunkKey(context, nonce, nonceSize, key))
             {
-                f = (b & c) | ((~b) & d);
-                g = i;
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Archive cipher key not loaded\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+                return 5;
             }
-            else if (i < 32)
+        }
+        else GetCipherKey(context, extra, key);     // NOTE: Salt is always stored first
+
+        switch (info.cipherType)
+        {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+            case RRES_CIPHER_AES:
             {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
+                AES_init_ctx(&stream->aes, key);
+                MD5Init(&stream->md5);
+                stream->counter = 0;
+            } break;
+            case RRES_CIPHER_AES_GCM:
+            {
+                // NOTE: Counter block: nonce[12] + 32bit big-endian counter, data starts at 2 (see AesGcmXcrypt())
+                AES_init_ctx(&stream->aes, key);
+                memcpy(stream->nonce, nonce, 12);
+                stream->counter = ((unsigned long long)nonce[8] << 56) | ((unsigned long long)nonce[9] << 48) |
+                                  ((unsigned long long)nonce[10] << 40) | ((unsigned long long)nonce[11] << 32);
+
+                AesCtrXcryptBlocks(&stream->aes, stream->ghash.h, 16, NULL, 0);                           // H = AES(key, 0^128)
+                AesCtrXcryptBlocks(&stream->aes, stream->tagMask, 16, stream->nonce, stream->counter | 1);  // AES(key, J0)
+                stream->counter |= 2;
+            } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+            case RRES_CIPHER_XCHACHA20_POLY1305:
+            {
+                // NOTE: Same construction as crypto_aead_lock(): first block is the Poly1305 key, data starts at block 1
+                uint8_t authKey[64] = { 0 };
+
+                crypto_aead_init_x(&stream->chacha, key, nonce);
+                crypto_chacha20_djb(authKey, NULL, 64, stream->chacha.key, stream->chacha.nonce, 0);
+                crypto_poly1305_init(&stream->poly, authKey);
+                crypto_wipe(authKey, 64);
+                stream->counter = 1;
+            } break;
+#endif
+            default: break;
+        }
+
+        // Wipe secrets, they are no longer needed
+        crypto_wipe(extra, 56);
+        crypto_wipe(key, 32);
+    }
+#endif
+
+    // NOTE: Window is only required for small reads, big reads are decrypted straight into provided buffer
+    stream->windowCapacity = (stream->dataSize < RRES_UNPACK_WINDOW_SIZE)? (unsigned int)stream->dataSize : RRES_UNPACK_WINDOW_SIZE;
+    stream->window = (unsigned char *)RL_MALLOC((stream->windowCapacity > 0)? stream->windowCapacity : 1);
+
+    if (stream->window == NULL)
+    {
+        // NOTE: Stream is not closed on open failure, cipher state must be wiped here
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        crypto_wipe(stream, sizeof(rresUnpackStream));
+#endif
+        result = 6;
+    }
+
+    return result;
+}
+
+// Read decrypted data from unpack stream
+// NOTE: Packed data is read in pieces of RRES_UNPACK_WINDOW_SIZE, pieces fitting in requested data are
+// decrypted straight into provided buffer, otherwise they are decrypted into window
+static bool ReadUnpackStream(rresUnpackStream *stream, void *buffer, unsigned long long size)
+{
+    unsigned char *output = (unsigned char *)buffer;
+
+    // Check requested data is available
+    if (size > ((stream->dataSize - stream->readSize) + (stream->windowSize - stream->windowPosition))) return false;
+
+    while (size > 0)
+    {
+        if (stream->windowPosition < stream->windowSize)
+        {
+            // Provide data already decrypted into window
+            unsigned int count = ((stream->windowSize - stream->windowPosition) < size)? (stream->windowSize - stream->windowPosition) : (unsigned int)size;
+
+            memcpy(output, stream->window + stream->windowPosition, count);
+            stream->windowPosition += count;
+            output += count;
+            size -= count;
+        }
+        else
+        {
+            // Read and decrypt next packed data piece
+            // NOTE: Pieces are RRES_UNPACK_WINDOW_SIZE (multiple of cipher block size) except last one
+            unsigned int pieceSize = ((stream->dataSize - stream->readSize) < stream->windowCapacity)? (unsigned int)(stream->dataSize - stream->readSize) : stream->windowCapacity;
+            unsigned char *target = (size >= pieceSize)? output : stream->window;
+
+            if (rresReadChunkData(stream->reader, target, pieceSize) != pieceSize) return false;
+
+            stream->readSize += pieceSize;
+            DecryptUnpackStream(stream, target, pieceSize);
+
+            if (target == output)
             {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
+                output += pieceSize;
+                size -= pieceSize;
             }
             else
             {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
+                stream->windowPosition = 0;
+                stream->windowSize = pieceSize;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Decrypt unpack stream data piece (in place)
+// NOTE: Piece size must be a multiple of cipher block size (64 bytes) except for last piece
+static void DecryptUnpackStream(rresUnpackStream *stream, unsigned char *data, unsigned int size)
+{
+    switch (stream->cipherType)
+    {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        case RRES_CIPHER_AES:
+        {
+            // NOTE: MD5 is computed over decrypted data
+            AesCtrXcryptBlocks(&stream->aes, data, size, NULL, stream->counter);
+            MD5Update(&stream->md5, data, size);
+            stream->counter += size/16;
+        } break;
+        case RRES_CIPHER_AES_GCM:
+        {
+            // NOTE: Every segment is authenticated (GHASH over ciphertext) and decrypted while it's in cache
+            for (unsigned int offset = 0; offset < size; offset += RRES_AES_GCM_SEGMENT_SIZE)
+            {
+                unsigned int segmentSize = ((size - offset) < RRES_AES_GCM_SEGMENT_SIZE)? (size - offset) : RRES_AES_GCM_SEGMENT_SIZE;
+
+                GhashUpdate(&stream->ghash, data + offset, segmentSize);
+                AesCtrXcryptBlocks(&stream->aes, data + offset, segmentSize, stream->nonce, stream->counter + offset/16);
             }
 
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + LEFTROTATE((a + f + k[i] + w[g]), r[i]);
-            a = temp;
+            stream->counter += size/16;
+        } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        case RRES_CIPHER_XCHACHA20_POLY1305:
+        {
+            // NOTE: MAC is computed over encrypted data
+            crypto_poly1305_update(&stream->poly, data, size);
+            stream->counter = crypto_chacha20_djb(data, data, size, stream->chacha.key, stream->chacha.nonce, stream->counter);
+        } break;
+#endif
+        default: break;
+    }
+}
+
+// Close unpack stream
+// NOTE: Remaining encrypted data is read and authenticated, additional cipher data is read again (required for
+// chunk CRC32 verification), returns true if decrypted data is authenticated, cipher state is wiped
+static bool CloseUnpackStream(rresUnpackStream *stream)
+{
+    bool result = true;
+    unsigned char extra[56] = { 0 };
+
+    while (result && (stream->readSize < stream->dataSize))
+    {
+        unsigned int pieceSize = ((stream->dataSize - stream->readSize) < stream->windowCapacity)? (unsigned int)(stream->dataSize - stream->readSize) : stream->windowCapacity;
+
+        result = (rresReadChunkData(stream->reader, stream->window, pieceSize) == pieceSize);
+        stream->readSize += pieceSize;
+
+        if (result) DecryptUnpackStream(stream, stream->window, pieceSize);
+    }
+
+    if (result) result = (rresReadChunkData(stream->reader, extra, stream->extraSize) == stream->extraSize);
+
+    switch (stream->cipherType)
+    {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        case RRES_CIPHER_AES:
+        {
+            unsigned int md5[4] = { 0 };
+            MD5Final(&stream->md5, md5);
+
+            if (memcmp(md5, stream->mac, 16) != 0) result = false;
+        } break;
+        case RRES_CIPHER_AES_GCM:
+        {
+            // Lengths block: additional data bits (0) + ciphertext bits, 64bit big-endian
+            unsigned char lengths[16] = { 0 };
+            unsigned char tag[16] = { 0 };
+
+            for (int i = 0; i < 8; i++) lengths[15 - i] = (unsigned char)((stream->dataSize*8) >> (8*i));
+            GhashUpdate(&stream->ghash, lengths, 16);
+
+            for (int i = 0; i < 16; i++) tag[i] = stream->ghash.x[i]^stream->tagMask[i];
+
+            if (crypto_verify16(tag, stream->mac) != 0) result = false;
+            crypto_wipe(tag, 16);
+        } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        case RRES_CIPHER_XCHACHA20_POLY1305:
+        {
+            // Poly1305 over ciphertext padded to 16 bytes + sizes: additional data size (0) + ciphertext size, 64bit little-endian
+            unsigned char sizes[16] = { 0 };
+            unsigned char mac[16] = { 0 };
+
+            crypto_poly1305_update(&stream->poly, sizes, (16 - (unsigned int)(stream->dataSize%16))%16);     // Zero padding
+
+            for (int i = 0; i < 8; i++) sizes[8 + i] = (unsigned char)(stream->dataSize >> (8*i));
+            crypto_poly1305_update(&stream->poly, sizes, 16);
+            crypto_poly1305_final(&stream->poly, mac);
+
+            if (crypto_verify16(mac, stream->mac) != 0) result = false;
+            crypto_wipe(mac, 16);
+        } break;
+#endif
+        default: break;
+    }
+
+    RL_FREE(stream->window);
+    stream->window = NULL;
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    crypto_wipe(stream, sizeof(rresUnpackStream));
+#endif
+
+    return result;
+}
+
+// Load independent blocks offsets from block table (RRES_FLAG_INDEPENDENT_BLOCKS)
+// NOTE: Block table: blockSize (4 bytes) + blockCount (4 bytes) + blocks compressed size (4 bytes per block),
+// followed by compressed blocks (LZ4 blocks or QOI stripes); table must be available (8 + 4*blockCount bytes), returns blockCount + 1 offsets
+// (relative to packed data start, last one is packed data size) or NULL if block table is not valid
+static unsigned long long *LoadBlockOffsets(const unsigned char *table, unsigned long long packedSize, unsigned long long baseSize, unsigned int *blockSize, unsigned int *blockCount)
+{
+    unsigned long long *offsets = NULL;
+
+    if ((table == NULL) || (packedSize < 8)) return NULL;
+
+    memcpy(blockSize, table, 4);
+    memcpy(blockCount, table + 4, 4);
+
+    // Validate block table, blocks must cover uncompressed data
+    if ((*blockSize == 0) || (*blockSize > 0x7fffffff) || (*blockCount == 0) ||
+        (*blockCount != (baseSize + *blockSize - 1)/(*blockSize)) || ((8 + 4ULL*(*blockCount)) > packedSize)) return NULL;
+
+    offsets = (unsigned long long *)RL_MALLOC((*blockCount + 1ULL)*sizeof(unsigned long long));
+
+    if (offsets != NULL)
+    {
+        bool valid = true;
+        offsets[0] = 8 + 4ULL*(*blockCount);
+
+        for (unsigned int i = 0; valid && (i < *blockCount); i++)
+        {
+            unsigned int compSize = 0;
+            memcpy(&compSize, table + 8 + 4ULL*i, 4);
+
+            offsets[i + 1] = offsets[i] + compSize;
+
+            if ((compSize == 0) || (compSize > 0x7fffffff) || (offsets[i + 1] > packedSize)) valid = false;
+        }
+
+        if (!valid || (offsets[*blockCount] != packedSize))
+        {
+            RL_FREE(offsets);
+            offsets = NULL;
         }
+    }
+
+    return offsets;
+}
+
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+// Decompress LZ4 linked blocks (RRES_FLAG_STREAM_BLOCKS): compressed size (4 bytes) + block
+// NOTE: Blocks are decompressed one after the other into output, previous output is the dictionary,
+// returns decompressed data size or -1 on failure
+static int DecompressLZ4Blocks(const unsigned char *data, unsigned long long size, unsigned char *output, int outputSize)
+{
+    LZ4_streamDecode_t lz4Stream = { 0 };
+    LZ4_setStreamDecode(&lz4Stream, NULL, 0);
+
+    unsigned long long offset = 0;
+    int outputPosition = 0;
+
+    while ((offset < size) && (outputPosition < outputSize))
+    {
+        unsigned int blockSize = 0;
+
+        if ((size - offset) < 4) return -1;
+        memcpy(&blockSize, data + offset, 4);
+        offset += 4;
+
+        if ((blockSize == 0) || (blockSize > (size - offset))) return -1;
+
+        int blockDataSize = LZ4_decompress_safe_continue(&lz4Stream, (const char *)data + offset, (char *)output + outputPosition, blockSize, outputSize - outputPosition);
+
+        if (blockDataSize <= 0) return -1;
+
+        offset += blockSize;
+        outputPosition += blockDataSize;
+    }
+
+    return (offset == size)? outputPosition : -1;
+}
+
+// Decompress LZ4 independent blocks in parallel
+// NOTE: Every block is decompressed straight into its place on output, blocks are distributed between
+// threadCount threads (rresParallelFor()), returns true if all blocks were decompressed with expected size
+static bool DecompressLZ4BlockJobs(rresLZ4BlockJobs *jobs, unsigned int blockCount, unsigned int threadCount)
+{
+    bool result = false;
+
+    jobs->failed = (bool *)RL_CALLOC(blockCount, sizeof(bool));
+
+    if (jobs->failed != NULL)
+    {
+        rresParallelFor(LZ4BlockJob, jobs, blockCount, threadCount);
 
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
+        result = true;
+        for (unsigned int i = 0; i < blockCount; i++) if (jobs->failed[i]) result = false;
+
+        RL_FREE(jobs->failed);
+        jobs->failed = NULL;
     }
 
-    RL_FREE(msg);
+    return result;
+}
+
+// LZ4 independent blocks job: decompress one block
+static void LZ4BlockJob(void *jobs, unsigned int index)
+{
+    rresLZ4BlockJobs *blockJobs = (rresLZ4BlockJobs *)jobs;
+    unsigned int block = blockJobs->firstBlock + index;
+
+    unsigned long long position = (unsigned long long)block*blockJobs->blockSize;
+    int size = ((blockJobs->baseSize - position) < blockJobs->blockSize)? (int)(blockJobs->baseSize - position) : (int)blockJobs->blockSize;
+    int compSize = (int)(blockJobs->blockOffsets[block + 1] - blockJobs->blockOffsets[block]);
 
-    return hash;
+    int blockDataSize = LZ4_decompress_safe((const char *)blockJobs->data + (blockJobs->blockOffsets[block] - blockJobs->dataOffset),
+        (char *)blockJobs->output + (unsigned long long)index*blockJobs->blockSize, compSize, size);
+
+    blockJobs->failed[index] = (blockDataSize != size);
 }
+#endif
 
 #endif // RRES_RAYLIB_IMPLEMENTATION
@@ -1,6 +1,6 @@
 /**********************************************************************************************
 *
-*   rres v1.0 - A simple and easy-to-use file-format to package resources
+*   rres v1.1 - A simple and easy-to-use file-format to package resources
 *
 *   CONFIGURATION:
 *
@@ -9,6 +9,15 @@
 *       If not defined, the library is in header only mode and can be included in other headers
 *       or source files without problems. But only ONE file should hold the implementation.
 *
+*   #define RRES_SUPPORT_THREADS
+*       Make the shared loading state (i.e. archive buffer pool) safe to be used from multiple threads
+*       and enable worker threads for parallel jobs (i.e. resource chunks packing),
+*       it requires pthreads on POSIX platforms, Win32 API is used on Windows
+*
+*   #define RRES_DATA_ALIGNMENT
+*       Minimum alignment (bytes, power of two) of loaded chunks raw data, default: 16.
+*       Chunks packed with a bigger alignment (rresResourceChunkInfo.flags) are loaded with that alignment
+*
 *   FEATURES:
 *
 *     - Multi-resource files: Some files could end-up generating multiple connected resources in
@@ -39,6 +48,36 @@
 *       CD Offset                 (4 bytes)     // Central Directory offset (if available)
 *       Reserved                  (4 bytes)     // <reserved>
 *
+*   NOTE: Large archive files (version 101) use 64bit offsets/sizes and 32bit resource count,
+*   file structure is the same but rresFileHeader, rresResourceChunkInfo and rresDirEntry layouts change:
+*
+*   rresFileHeader (v101)        (24 bytes)
+*       Signature Id              (4 bytes)     // File signature id: 'rres'
+*       Version                   (2 bytes)     // Format version: 101
+*       Reserved                  (2 bytes)     // <reserved>
+*       Resource Count            (4 bytes)     // Number of resource chunks contained
+*       Reserved                  (4 bytes)     // <reserved>
+*       CD Offset                 (8 bytes)     // Central Directory offset (if available)
+*
+*   rresResourceChunkInfo (v101) (48 bytes)
+*       Type                      (4 bytes)     // Resource type (FourCC)
+*       Id                        (4 bytes)     // Resource identifier (CRC32 filename hash or custom)
+*       Compressor                (1 byte)      // Data compression algorithm
+*       Cipher                    (1 byte)      // Data encryption algorithm
+*       Flags                     (2 bytes)     // Data flags (if required)
+*       CRC32                     (4 bytes)     // Resource Data Chunk CRC32
+*       Data Packed Size          (8 bytes)     // Data packed size (compressed/encrypted + custom data appended)
+*       Data Base Size            (8 bytes)     // Data base size (uncompressed/unencrypted)
+*       Next Offset               (8 bytes)     // Next resource chunk offset (if required)
+*       Reserved                  (8 bytes)     // <reserved>
+*
+*   rresDirEntry (v101)
+*       Id                        (4 bytes)     // Resource id
+*       reserved                  (4 bytes)     // <reserved>
+*       Offset                    (8 bytes)     // Resource global offset in file
+*       FileName Size             (4 bytes)     // Resource fileName size (NULL terminator and 4-bytes align padding considered)
+*       FileName                  (m bytes)     // Resource original fileName (NULL terminated and padded to 4-byte alignment)
+*
 *   rresResourceChunk[]
 *   {
 *       rresResourceChunkInfo   (32 bytes)
@@ -56,6 +95,8 @@
 *       rresResourceChunkData     (n bytes)     // Packed data
 *           Property Count        (4 bytes)     // Number of properties contained
 *           Properties[]          (4*i bytes)   // Resource data required properties, depend on Type
+*           Padding Size          (4 bytes)     // Padding bytes before data, only if aligned (Flags)
+*           Padding               (p bytes)     // Padding to align data start, only if aligned (Flags)
 *           Data                  (m bytes)     // Resource data
 *   }
 *
@@ -77,9 +118,37 @@
 *
 *   DESIGN DECISIONS / LIMITATIONS:
 *
-*     - rres file maximum chunks: 65535 (16bit chunk count in rresFileHeader)
-*     - rres file maximum size: 4GB (chunk offset and Central Directory Offset is 32bit, so it can not address more than 4GB
+*     - rres file maximum chunks: 65535 (16bit chunk count in rresFileHeader), 4294967295 for large archive files (version 101)
+*     - rres file maximum size: 4GB (chunk offset and Central Directory Offset is 32bit, so it can not address more than 4GB,
+*       large archive files (version 101) use 64bit offsets and sizes; loading them requires 64bit file offsets support
+*       (Windows or LP64 platforms) and a chunk data can not exceed the addressable memory
+*     - Readers support both file layouts transparently, data is exposed with the same in-memory structures
+*       WARNING: API change (rres 1.1), in-memory structures are wider than v100 file layout: rresFileHeader.chunkCount is
+*       32bit, rresFileHeader.cdOffset, rresResourceChunkInfo packedSize/baseSize/nextOffset and rresDirEntry.offset are 64bit,
+*       code reading/writing those structures straight from/to files or storing those fields in 32bit variables must be updated
+*     - Chunk data can be aligned by the packer (rresResourceChunkInfo.flags: RRES_FLAG_ALIGNMENT_MASK), a padding is recorded
+*       after properties. For not compressed/encrypted chunks data is aligned to file offset (direct file/mapped access),
+*       for compressed/encrypted chunks data is aligned to the start of the unpacked chunk data
+*     - Files can be updated in place (rresOpenWriterAppend()): new chunks are appended, replaced/removed chunks are marked
+*       with RRES_FLAG_DEAD (skipped by readers) and a new Central Directory is written, rresCompactFile() reclaims dead chunks space
 *     - Chunk search by ID is done one by one, starting at first chunk and accessed with fread() function
+*       Mounted archives (rresMountArchive()) build a merged index on mount, loads read the indexed chunk directly
+*     - Identical chunks data can be stored once (rresSetWriterDeduplication()): duplicates are written as alias chunks
+*       (RRES_FLAG_ALIAS) containing the global offset of the chunk with the data, Central Directory entries point to it
+*     - Chunks are stored in packer order, an access trace can be recorded from loaders (rresSetAccessTrace()) and used to
+*       rewrite the file with chunks in first access order (rresReorderFile()), so resources loading is mostly sequential
+*     - Delta patches between file versions can be created (rresCreatePatch()): only changed chunks (id + CRC32) are stored,
+*       along with a patch index (PTCH) used to rebuild the target file from the base file (rresApplyPatch())
+*     - Encrypted archives can define a single key derivation record (KDFR, salt and key stretching parameters) as a header chunk,
+*       chunks with RRES_FLAG_ARCHIVE_KEY only store a nonce and derive their key from the archive key (one key stretching per archive)
+*     - Chunks packed data can be read progressively (rresOpenChunkReader()), so user libraries can decrypt/decompress it while
+*       it's read; compressed data can be split in linked blocks (RRES_FLAG_STREAM_BLOCKS) to be decompressed progressively
+*     - Big chunks compressed data can be split in independent blocks (RRES_FLAG_INDEPENDENT_BLOCKS): a block table (block size,
+*       block count and compressed size of every block) is stored first, so blocks can be decompressed in parallel, straight into
+*       their place on unpacked data, and a data range can be decompressed without decompressing the full chunk;
+*       QOI images use the same block table for horizontal stripes (every stripe is a QOI image of some rows)
+*     - Archives of many small resources can define a compression dictionary (DICT) as a header chunk, chunks compressed
+*       with it (RRES_FLAG_DICTIONARY) store the dictionary id first, so a wrong or missing dictionary is detected on loading
 *     - Endianness: rres does not care about endianness, data is stored as desired by the host platform (most probably Little Endian)
 *       Endianness won't affect chunk data but it will affect rresFileHeader and rresResourceChunkInfo
 *     - CRC32 hash is used to to generate the rres file identifier from filename
@@ -102,9 +171,30 @@
 *                 NOTE: Allocators can be redefined with macros RRES_MALLOC, RRES_CALLOC, RRES_FREE
 *     - stdio.h:  Required for file access functionality: FILE, fopen(), fseek(), fread(), fclose()
 *     - string.h: Required for memory data management: memcpy(), memcmp()
+*     - pthread.h: Required for mutex and threads, only if RRES_SUPPORT_THREADS is defined (not used on Windows)
+*     - windows.h: Required for mutex and threads on Windows, only if RRES_SUPPORT_THREADS is defined (GDI and USER APIs excluded)
 *
 *   VERSION HISTORY:
 *
+*     - 1.1 (19-Oct-2026): Large archive files support (version 101): 64bit offsets/sizes and 32bit chunk count
+*                          API CHANGE: rresFileHeader, rresResourceChunkInfo and rresDirEntry offsets/sizes/count fields widened
+*                          API CHANGE: Chunk data props and raw could share one allocation, free them only with rresUnloadResourceChunkData()
+*                          Incremental file update (append/replace/remove resource chunks) and file compaction
+*                          Access trace recording and profile-guided file chunks reordering
+*                          Chunks data deduplication (alias chunks)
+*                          Binary delta patches between file versions
+*                          Layered archives mounting with merged resources index
+*                          Archive cipher key derivation record (KDFR)
+*                          Resource chunk packed data progressive reading (streaming)
+*                          Resource chunk compressed data independent blocks (parallel/partial decompression)
+*                          QOI images independent stripes (parallel decoding)
+*                          Archive compression dictionary (DICT)
+*                          Packed data buffer pool for repeated chunk loads (rresSetArchiveBufferPool())
+*                          Resource chunks cache with memory budget, least recently used chunks evicted (rresLoadResourceCache())
+*                          Thread-safe loading state (RRES_SUPPORT_THREADS) and parallel jobs (rresParallelFor())
+*                          Chunk raw data alignment (RRES_FLAG_ALIGNMENT_MASK) and chunk data raw size (rresResourceChunkData.rawSize)
+*                          Resource chunks writer (rresOpenWriter()), chunks written progressively with bounded memory
+*                          Resource chunks parallel packing with ordered output (rresPackResourceChunks())
 *     - 1.0 (12-May-2022): Implementation review for better alignment with rres specs
 *     - 0.9 (28-Apr-2022): Initial implementation of rres specs
 *
@@ -178,6 +268,16 @@
     #define RRES_LOG(...)
 #endif
 
+// rres file format versions
+// NOTE: Large archive format is only required for files bigger than 4GB or with more than 65535 chunks
+#define RRES_FILE_VERSION               100     // rres file version 1.0: 32bit offsets/sizes, 16bit chunk count
+#define RRES_FILE_VERSION_LARGE         101     // rres file version 1.1: 64bit offsets/sizes, 32bit chunk count
+
+// Minimum alignment of loaded chunks raw data (must be a power of two)
+#ifndef RRES_DATA_ALIGNMENT
+    #define RRES_DATA_ALIGNMENT         16
+#endif
+
 // On Windows, MAX_PATH is limited to 256 by default,
 // on Linux, it could go up to 4096
 #define RRES_MAX_FILENAME_SIZE      1024
@@ -185,34 +285,52 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// rres file header (16 bytes)
+// Boolean type
+#if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    #include <stdbool.h>
+#elif !defined(__cplusplus) && !defined(bool)
+    typedef enum bool { false = 0, true = !false } bool;
+    #define RL_BOOL_TYPE
+#endif
+
+// rres file header
+// NOTE: In-memory structure, file layout depends on version: 16 bytes (v100) or 24 bytes (v101)
+// WARNING: chunkCount (32bit) and cdOffset (64bit) are wider than v100 file fields (API change in rres 1.1)
 typedef struct rresFileHeader {
     unsigned char id[4];            // File identifier: rres
-    unsigned short version;         // File version: 100 for version 1.0
-    unsigned short chunkCount;      // Number of resource chunks in the file (MAX: 65535)
-    unsigned int cdOffset;          // Central Directory offset in file (0 if not available)
+    unsigned short version;         // File version: 100 for version 1.0, 101 for version 1.1 (large archive)
+    unsigned int chunkCount;        // Number of resource chunks in the file (MAX: 65535 for version 100)
+    unsigned long long cdOffset;    // Central Directory offset in file (0 if not available)
     unsigned int reserved;          // <reserved>
 } rresFileHeader;
 
-// rres resource chunk info header (32 bytes)
+// rres resource chunk info header
+// NOTE: In-memory structure, file layout depends on version: 32 bytes (v100) or 48 bytes (v101)
+// WARNING: packedSize, baseSize and nextOffset (64bit) are wider than v100 file fields (API change in rres 1.1)
 typedef struct rresResourceChunkInfo {
     unsigned char type[4];          // Resource chunk type (FourCC)
     unsigned int id;                // Resource chunk identifier (generated from filename CRC32 hash)
     unsigned char compType;         // Data compression algorithm
     unsigned char cipherType;       // Data encription algorithm
     unsigned short flags;           // Data flags (if required)
-    unsigned int packedSize;        // Data chunk size (compressed/encrypted + custom data appended)
-    unsigned int baseSize;          // Data base size (uncompressed/unencrypted)
-    unsigned int nextOffset;        // Next resource chunk global offset (if resource has multiple chunks)
+    unsigned long long packedSize;  // Data chunk size (compressed/encrypted + custom data appended)
+    unsigned long long baseSize;    // Data base size (uncompressed/unencrypted)
+    unsigned long long nextOffset;  // Next resource chunk global offset (if resource has multiple chunks)
     unsigned int reserved;          // <reserved>
     unsigned int crc32;             // Data chunk CRC32 (propCount + props[] + data)
 } rresResourceChunkInfo;
 
 // rres resource chunk data
+// NOTE: Unpacked data is allocated into buffer, props and raw point into it (NULL if props and raw are directly allocated),
+// raw data size does not include header (propCount + props[] + padding), it can not be computed from chunk info for aligned chunks
+// WARNING: API change (rres 1.1), props and raw could be part of one allocation depending on the load path (i.e. packed data
+// is loaded with buffer NULL, unpacked data into buffer), they must not be freed by user, only rresUnloadResourceChunkData()
 typedef struct rresResourceChunkData {
     unsigned int propCount;         // Resource chunk properties count
     unsigned int *props;            // Resource chunk properties
     void *raw;                      // Resource chunk raw data
+    void *buffer;                   // Resource chunk data allocation (if required)
+    unsigned long long rawSize;     // Resource chunk raw data size (packed data size if data is still packed)
 } rresResourceChunkData;
 
 // rres resource chunk
@@ -228,12 +346,82 @@ typedef struct rresResourceMulti {
     rresResourceChunk *chunks;      // Resource chunks
 } rresResourceMulti;
 
+// rres buffer pool stats
+// NOTE: Useful to tune the pool retained size, hit rate = hitCount/requestCount
+typedef struct rresBufferPoolStats {
+    unsigned int requestCount;      // Buffer requests received
+    unsigned int hitCount;          // Buffer requests served with a retained buffer
+    unsigned int retainedCount;     // Buffers currently retained by the pool
+    unsigned int retainedSize;      // Bytes currently retained by the pool
+} rresBufferPoolStats;
+
+// rres buffer pool (opaque type)
+// NOTE: Packed data buffers are grouped by power-of-two size classes and reused between loads
+typedef struct rresBufferPool rresBufferPool;
+
+// rres archive
+// NOTE: Archive keeps the file name and the state shared between loads,
+// file is opened on every load, so multiple threads can load from the same archive
+typedef struct rresArchive {
+    char fileName[RRES_MAX_FILENAME_SIZE];  // Archive file name
+    rresFileHeader header;          // Archive file header
+    rresBufferPool *pool;           // Packed data buffer pool (optional, NULL if not used)
+} rresArchive;
+
+// rres mount set (opaque type)
+// NOTE: Archives stacked by priority with a merged resources index (id -> archive, chunk offset),
+// resources available in multiple archives are provided by the archive with highest priority
+typedef struct rresMountSet rresMountSet;
+
+// rres resource cache stats
+typedef struct rresResourceCacheStats {
+    unsigned int hitCount;          // Requests served from cache
+    unsigned int missCount;         // Requests not available in cache
+    unsigned int evictionCount;     // Entries evicted to fit the cache memory budget
+    unsigned int entryCount;        // Entries currently in cache
+    unsigned long long usedSize;    // Bytes currently used by cached chunks (props + raw data)
+} rresResourceCacheStats;
+
+// rres resource cache (opaque type)
+// NOTE: Resource chunks are cached by (archive, id, unpacked state) and shared by reference count,
+// least recently used entries not referenced and not pinned are evicted to fit the memory budget
+typedef struct rresResourceCache rresResourceCache;
+
+// rres file writer (opaque type)
+// NOTE: Resource chunks are appended to file as they are produced, file header and
+// central directory are written on writer close
+typedef struct rresWriter rresWriter;
+
+// rres resource chunk reader (opaque type)
+// NOTE: Resource chunk packed data is read progressively from file, CRC32 is verified once all data is read
+typedef struct rresChunkReader rresChunkReader;
+
+// rres access trace (opaque type)
+// NOTE: Sequence of resource ids requested by loaders, used to reorder file chunks in first access order
+typedef struct rresAccessTrace rresAccessTrace;
+
+// rres resource chunk pack item
+// NOTE: Input chunk (info + data) is packed by the pack callback into packedData,
+// packed chunks are written in items order, result is independent of the number of threads
+typedef struct rresPackItem {
+    rresResourceChunkInfo info;     // Resource chunk info: type, id, compType, cipherType, flags (sizes and CRC32 filled on packing)
+    rresResourceChunkData data;     // Resource chunk data to pack: propCount, props[], raw, rawSize
+    const char *fileName;           // Central directory entry fileName (NULL if not required)
+    void *packedData;               // Packed data, allocated by pack callback (RRES_MALLOC), freed once written
+} rresPackItem;
+
+// Callbacks to process resource chunks data
+// NOTE: Callbacks can be called from multiple threads at the same time
+typedef void (*rresJobCallback)(void *userData, unsigned int index);            // Parallel job callback
+typedef bool (*rresPackCallback)(rresPackItem *item, void *userData);          // Pack callback: fill item packedData, info.packedSize and info.baseSize
+
 // Useful data types for specific chunk types
 //----------------------------------------------------------------------
 // CDIR: rres central directory entry
+// WARNING: offset (64bit) is wider than v100 file field (API change in rres 1.1)
 typedef struct rresDirEntry {
     unsigned int id;                // Resource id
-    unsigned int offset;            // Resource global offset in file
+    unsigned long long offset;      // Resource global offset in file
     unsigned int reserved;          // reserved
     unsigned int fileNameSize;      // Resource fileName size (NULL terminator and 4-byte alignment padding considered)
     char fileName[RRES_MAX_FILENAME_SIZE];  // Resource original fileName (NULL terminated and padded to 4-byte alignment)
@@ -317,6 +505,22 @@ typedef enum rresResourceDataType {
     RRES_DATA_DIRECTORY    = 100,           // FourCC: CDIR - Central directory for input files
                                             //    props[0]:entryCount, 1 property
                                             //    data: rresDirEntry[0..entryCount]
+    RRES_DATA_PATCH        = 101,           // FourCC: PTCH - Patch index to rebuild a target file from a base file, 4 properties
+                                            //    props[0]:entryCount
+                                            //    props[1]:version (target file version)
+                                            //    props[2]:baseChecksum (CRC32 of base file resource chunks ids and CRC32)
+                                            //    props[3]:flags (1: target file deduplicated)
+                                            //    data: entries[0..entryCount]: id (4 bytes), source (4 bytes, 0: base file, 1: patch file), offset (8 bytes)
+    RRES_DATA_KEY_DERIVATION = 102,         // FourCC: KDFR - Archive cipher key derivation record, 4 properties
+                                            //    props[0]:algorithm (user library defined, i.e. rres-raylib: 1: Argon2i)
+                                            //    props[1]:memory (KB)
+                                            //    props[2]:passes
+                                            //    props[3]:lanes
+                                            //    data: salt
+    RRES_DATA_DICTIONARY   = 103,           // FourCC: DICT - Archive compression dictionary, 2 properties
+                                            //    props[0]:compType (rresCompressionType, dictionary algorithm)
+                                            //    props[1]:dictionaryId (CRC32 of dictionary data)
+                                            //    data: dictionary
 
     // TODO: 2.0: Support resource package types (muti-resource)
     // NOTE: They contains multiple rresResourceChunk in rresResourceData.raw
@@ -369,6 +573,20 @@ typedef enum rresEncryptionType {
     // TODO: Add additional encryption algorithm if required
 } rresEncryptionType;
 
+// Resource chunk flags
+// NOTE: Stored in rresResourceChunkInfo.flags
+typedef enum rresChunkFlags {
+    RRES_FLAG_NONE              = 0,        // No flags
+    RRES_FLAG_ALIGNMENT_MASK    = 0x000f,   // Data alignment, stored as log2 (0: not aligned, 4: 16 bytes, 12: 4096 bytes)
+    RRES_FLAG_DEAD              = 0x0010,   // Resource chunk replaced or removed, ignored by readers (space reclaimed on compaction)
+    RRES_FLAG_ALIAS             = 0x0020,   // Resource chunk data is the global offset (8 bytes) of a resource chunk with identical data (deduplicated)
+    RRES_FLAG_ARCHIVE_KEY       = 0x0040,   // Resource chunk cipher key is derived from archive key (KDFR), only a per-chunk nonce is stored
+    RRES_FLAG_STREAM_BLOCKS     = 0x0080,   // Resource chunk compressed data is split in linked blocks (compressed size (4 bytes) + block), decompressed progressively
+    RRES_FLAG_INDEPENDENT_BLOCKS = 0x0100,  // Resource chunk compressed data is split in independent blocks with a block table, decompressed in parallel or partially
+    RRES_FLAG_DICTIONARY        = 0x0200,   // Resource chunk data is compressed with archive dictionary (DICT), dictionary id (4 bytes) is stored first
+                                            // NOTE: If aligned, a padding size and padding are stored before data
+} rresChunkFlags;
+
 // TODO: rres error codes (not used at this moment)
 // NOTE: Error codes when processing rres files
 typedef enum rresErrorType {
@@ -494,21 +712,125 @@ RRESAPI void rresUnloadResourceChunk(rresResourceChunk chunk);
 RRESAPI rresResourceMulti rresLoadResourceMulti(const char *fileName, int rresId);  // Load resource for provided id (multiple resource chunks)
 RRESAPI void rresUnloadResourceMulti(rresResourceMulti multi);                      // Unload resource from memory (multiple resource chunks)
 
+// Load resource chunks from an opened archive
+// NOTE: Archive state (i.e. buffer pool) is reused between loads
+RRESAPI rresArchive *rresOpenArchive(const char *fileName);                         // Open rres archive, file header is validated
+RRESAPI void rresCloseArchive(rresArchive *archive);                                // Close rres archive, buffer pool is freed (if used)
+RRESAPI rresResourceChunk rresLoadArchiveResourceChunk(rresArchive *archive, int rresId);   // Load one resource chunk for provided id from archive
+RRESAPI rresResourceMulti rresLoadArchiveResourceMulti(rresArchive *archive, int rresId);   // Load resource for provided id from archive (multiple resource chunks)
+
+// Manage archive packed data buffer pool
+// NOTE: Pool retains up to maxRetainedSize bytes of packed data buffers, reused on next loads
+// WARNING: Pooled buffers are only used to read packed data, chunk data is still copied from them
+// (rresLoadResourceChunkData()), so pool saves the packed data allocation but not the copy
+RRESAPI void rresSetArchiveBufferPool(rresArchive *archive, unsigned int maxRetainedSize);   // Set archive buffer pool (0 to disable it)
+RRESAPI rresBufferPoolStats rresGetArchiveBufferPoolStats(rresArchive *archive);            // Get archive buffer pool stats
+
+// Read resource chunk packed data progressively from an opened archive (streaming)
+// NOTE: Packed data is read in pieces of the desired size, so it can be processed (decrypted/decompressed) while it's read,
+// without loading the full packed data, it's up to the user to discard the processed data if CRC32 does not match on close
+RRESAPI rresChunkReader *rresOpenChunkReader(rresArchive *archive, int rresId, rresResourceChunkInfo *info); // Open resource chunk reader for provided id, chunk info is provided (aliases resolved)
+RRESAPI unsigned long long rresReadChunkData(rresChunkReader *reader, void *buffer, unsigned long long size); // Read next packed data piece, CRC32 is updated, returns bytes read
+RRESAPI bool rresReadChunkDataAt(rresChunkReader *reader, unsigned long long offset, void *buffer, unsigned long long size); // Read packed data at offset, read position is not changed (i.e. appended cipher data)
+RRESAPI bool rresCloseChunkReader(rresChunkReader *reader);                          // Close resource chunk reader, returns true if all packed data was read and CRC32 matches
+
+// Load resource chunks from mounted archives (i.e. base + DLC + patch archives)
+// NOTE: Merged index is built on mount, loads do not scan archives
+RRESAPI rresMountSet *rresLoadMountSet(void);                                        // Load mount set, no archives mounted
+RRESAPI void rresUnloadMountSet(rresMountSet *set);                                  // Unload mount set, mounted archives are not closed
+RRESAPI bool rresMountArchive(rresMountSet *set, rresArchive *archive, int priority); // Mount archive, resources override lower priority archives ones
+RRESAPI bool rresUnmountArchive(rresMountSet *set, rresArchive *archive);            // Unmount archive, merged index is rebuilt
+RRESAPI rresArchive *rresGetMountedArchive(rresMountSet *set, int rresId);           // Get archive providing resource id, NULL if not available
+RRESAPI rresResourceChunk rresLoadMountedResourceChunk(rresMountSet *set, int rresId);  // Load one resource chunk for provided id from mounted archives
+RRESAPI rresResourceMulti rresLoadMountedResourceMulti(rresMountSet *set, int rresId);  // Load resource for provided id from mounted archives (multiple resource chunks)
+
+// Manage resource chunks cache
+// NOTE: Cached chunks are shared, they must not be modified and they must be released (not unloaded) when no longer required
+RRESAPI rresResourceCache *rresLoadResourceCache(unsigned int maxSize);             // Load resource cache with a memory budget (bytes)
+RRESAPI void rresUnloadResourceCache(rresResourceCache *cache);                     // Unload resource cache, all cached chunks are unloaded
+RRESAPI const rresResourceChunk *rresLoadCachedResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId); // Load resource chunk through cache (packed state)
+RRESAPI const rresResourceChunk *rresGetCachedResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked); // Get resource chunk from cache, NULL if not cached
+RRESAPI const rresResourceChunk *rresCacheResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked, rresResourceChunk chunk); // Add resource chunk to cache (ownership is transferred)
+RRESAPI void rresReleaseCachedResourceChunk(rresResourceCache *cache, const rresResourceChunk *chunk);   // Release cached resource chunk reference
+RRESAPI void rresPinCachedResourceChunk(rresResourceCache *cache, const rresResourceChunk *chunk, bool pinned); // Pin/unpin cached resource chunk (pinned chunks are never evicted)
+RRESAPI void rresFlushResourceCache(rresResourceCache *cache, rresArchive *archive);  // Unload not referenced cached chunks from archive (NULL for all archives)
+RRESAPI rresResourceCacheStats rresGetResourceCacheStats(rresResourceCache *cache); // Get resource cache stats
+
+// Write rres file, resource chunks are streamed to file (data is not buffered)
+// NOTE: Consecutive chunks with the same id are linked as a multi-chunk resource (nextOffset)
+// Chunk data can be written in several pieces between rresBeginResourceChunk() and rresEndResourceChunk(),
+// for compressed/encrypted chunks, props are not written (they are part of packed data) and info.baseSize must be provided
+RRESAPI rresWriter *rresOpenWriter(const char *fileName, unsigned short version);   // Open rres file for writing (RRES_FILE_VERSION or RRES_FILE_VERSION_LARGE)
+RRESAPI rresWriter *rresOpenWriterAppend(const char *fileName);                     // Open existing rres file for appending, written chunks replace existing ones with same id
+RRESAPI bool rresCloseWriter(rresWriter *writer);                                   // Close rres file writer: central directory and file header are written
+RRESAPI bool rresBeginResourceChunk(rresWriter *writer, rresResourceChunkInfo info, unsigned int propCount, const unsigned int *props); // Begin resource chunk, info type, id, compType, cipherType and flags are used
+RRESAPI bool rresWriteResourceChunkData(rresWriter *writer, const void *data, unsigned long long size);  // Write resource chunk data (raw or packed data)
+RRESAPI bool rresEndResourceChunk(rresWriter *writer);                              // End resource chunk: sizes and CRC32 are written
+RRESAPI bool rresWriteResourceChunk(rresWriter *writer, rresResourceChunkInfo info, rresResourceChunkData data, unsigned long long rawSize); // Write full resource chunk (begin + data + end)
+RRESAPI bool rresAddCentralDirEntry(rresWriter *writer, unsigned int id, const char *fileName); // Add central directory entry, written on writer close (replaced if fileName exists)
+RRESAPI bool rresRemoveResource(rresWriter *writer, unsigned int id);               // Remove resource chunks and central directory entries for provided id
+RRESAPI bool rresWritePackedResourceChunk(rresWriter *writer, rresResourceChunkInfo info, const void *packedData); // Write packed resource chunk, info.packedSize and info.crc32 must be provided
+RRESAPI void rresSetWriterDeduplication(rresWriter *writer, bool enabled);          // Set writer data deduplication: identical chunks data is stored once (disabled by default)
+
+// Pack resource chunks in parallel and write them in order
+// NOTE: Chunks compressed/encrypted are processed by pack callback, CRC32 is also computed by worker threads,
+// not compressed/encrypted chunks are directly written (pack callback not called)
+RRESAPI bool rresPackResourceChunks(rresWriter *writer, rresPackItem *items, unsigned int itemCount, rresPackCallback pack, void *userData, unsigned int threadCount);
+RRESAPI void rresParallelFor(rresJobCallback job, void *userData, unsigned int jobCount, unsigned int threadCount); // Run jobs on worker threads (serial if RRES_SUPPORT_THREADS not defined)
+
+// Rewrite rres file into a new file, resource chunks are copied packed (not unpacked)
+// NOTE: Replaced/removed resource chunks are discarded and central directory is written again
+RRESAPI bool rresCompactFile(const char *fileName, const char *outputFileName);     // Compact rres file, resource chunks keep file order
+RRESAPI bool rresReorderFile(const char *fileName, const char *outputFileName, rresAccessTrace **traces, unsigned int traceCount); // Reorder rres file resource chunks in first access order (traces in priority order)
+
+// Create/apply delta patches between rres file versions
+// NOTE: Patch is a rres file containing changed resource chunks, a patch index (PTCH) and target central directory
+RRESAPI bool rresCreatePatch(const char *baseFileName, const char *targetFileName, const char *patchFileName); // Create patch with resource chunks changed from base to target file
+RRESAPI bool rresApplyPatch(const char *baseFileName, const char *patchFileName, const char *outputFileName);  // Apply patch to base file, target file is rebuilt (data copied in blocks)
+
+// Record resource access trace (profile-guided file reordering)
+// NOTE: Ids requested to loaders are recorded into current access trace (if set), file and archive loads are recorded
+RRESAPI rresAccessTrace *rresLoadAccessTrace(const char *fileName);                 // Load access trace from file (text file, one id per line), NULL fileName for an empty trace
+RRESAPI void rresUnloadAccessTrace(rresAccessTrace *trace);                         // Unload access trace
+RRESAPI bool rresSaveAccessTrace(rresAccessTrace *trace, const char *fileName);     // Save access trace to file (text file, one id per line)
+RRESAPI void rresSetAccessTrace(rresAccessTrace *trace);                            // Set access trace to record loaders requests (NULL to stop recording)
+
 // Load resource(s) chunk info from file
 RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, int rresId);  // Load resource chunk info for provided id
 RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName, unsigned int *chunkCount); // Load all resource chunks info
 
 RRESAPI rresCentralDir rresLoadCentralDirectory(const char *fileName);              // Load central directory resource chunk from file
 RRESAPI void rresUnloadCentralDirectory(rresCentralDir dir);                        // Unload central directory resource chunk
+RRESAPI rresResourceChunk rresLoadKeyDerivationChunk(const char *fileName);         // Load archive cipher key derivation record chunk (KDFR) from file
+RRESAPI rresResourceChunk rresLoadDictionaryChunk(const char *fileName);            // Load archive compression dictionary chunk (DICT) from file
 
 RRESAPI unsigned int rresGetDataType(const unsigned char *fourCC);                  // Get rresResourceDataType from FourCC code
 RRESAPI int rresGetResourceId(rresCentralDir dir, const char *fileName);            // Get resource id for a provided filename
                                                                                     // NOTE: It requires CDIR available in the file (it's optinal by design)
 RRESAPI unsigned int rresComputeCRC32(unsigned char *data, int len);                // Compute CRC32 for provided data
 
+// Manage resource chunk data alignment
+// NOTE: Packed data offset is the chunk data file offset for not compressed/encrypted chunks, 0 otherwise
+RRESAPI unsigned int rresGetDataAlignment(unsigned short flags);                    // Get chunk data alignment (bytes) from flags, 1 if not aligned
+RRESAPI unsigned short rresSetDataAlignment(unsigned short flags, unsigned int alignment); // Set chunk data alignment (bytes, power of two) into flags
+RRESAPI unsigned int rresGetDataPaddingSize(unsigned long long dataOffset, unsigned int propCount, unsigned short flags); // Get padding size required to align data
+RRESAPI rresResourceChunkData rresLoadResourceChunkDataFromMemory(const void *data, unsigned long long size, unsigned short flags); // Load chunk data from unpacked data (propCount + props[] + padding + data)
+RRESAPI rresResourceChunkData rresLoadResourceChunkDataInPlace(void *buffer, void *data, unsigned long long size, unsigned short flags); // Load chunk data pointing into unpacked data (no copy), buffer ownership is transferred
+RRESAPI unsigned int rresGetDataHeaderSize(const void *data, unsigned long long size, unsigned short flags); // Get unpacked data header size: propCount + props[] (+ padding size + padding), 0 if not available
+RRESAPI void *rresAllocUnpackedData(unsigned long long size, unsigned int headerSize, unsigned short flags, void **buffer); // Allocate memory for unpacked data, raw data (after header) is aligned
+RRESAPI void rresUnloadResourceChunkData(rresResourceChunkData data);               // Unload chunk data (props and raw data)
+
+// Serialize rres structures into file layout (as defined by version)
+// NOTE: Buffer must be big enough to store the structure, 48 bytes is enough for any version
+RRESAPI unsigned int rresGetFileHeaderSize(unsigned short version);                 // Get file header size in file for provided version
+RRESAPI unsigned int rresGetResourceChunkInfoSize(unsigned short version);          // Get resource chunk info size in file for provided version
+RRESAPI unsigned int rresSerializeFileHeader(rresFileHeader header, unsigned char *buffer);  // Serialize file header (header.version layout), returns bytes written
+RRESAPI unsigned int rresSerializeResourceChunkInfo(rresResourceChunkInfo info, unsigned short version, unsigned char *buffer); // Serialize resource chunk info, returns bytes written
+
 // Manage password for data encryption/decryption
 // NOTE: The cipher password is kept as an internal pointer to provided string, it's up to the user to manage that sensible data properly
 // Password should be to allocate and set before loading an encrypted resource and it should be cleaned/wiped after the encrypted resource has been loaded
+// WARNING: Global password is not thread-safe, engine-library should provide a per-thread context with the password (i.e. rres-raylib rresUnpackContext)
 // TODO: Move this functionality to engine-library, after all rres.h does not manage data decryption
 RRESAPI void rresSetCipherPassword(const char *pass);                 // Set password to be used on data decryption
 RRESAPI const char *rresGetCipherPassword(void);                      // Get password to be used on data decryption
@@ -528,32 +850,251 @@ RRESAPI const char *rresGetCipherPassword(void);                      // Get pas
 
 #if defined(RRES_IMPLEMENTATION)
 
-// Boolean type
-#if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
-    #include <stdbool.h>
-#elif !defined(__cplusplus) && !defined(bool)
-    typedef enum bool { false = 0, true = !false } bool;
-    #define RL_BOOL_TYPE
+// Large files support on 32bit POSIX platforms: 64bit off_t for fseeko()/ftello()
+// NOTE: Only effective if no system header has been included before in the translation unit,
+// otherwise it should be defined by the build system: -D_FILE_OFFSET_BITS=64
+#if !defined(_WIN32) && !defined(_FILE_OFFSET_BITS)
+    #define _FILE_OFFSET_BITS 64
 #endif
 
 #include <stdlib.h>                 // Required for: malloc(), free()
-#include <stdio.h>                  // Required for: FILE, fopen(), fseek(), fread(), fclose()
+#include <stdio.h>                  // Required for: FILE, fopen(), fseek(), fseeko(), fread(), fclose()
 #include <string.h>                 // Required for: memcpy(), memcmp()
+#include <stdint.h>                 // Required for: uintptr_t
+
+#if defined(RRES_SUPPORT_THREADS)
+    #if defined(_WIN32)
+        // NOTE: GDI and USER APIs are excluded, they conflict with some raylib symbols (Rectangle, CloseWindow, DrawText...),
+        // windows.h is included once per translation unit, so include it before rres.h if those APIs are required
+        #if !defined(WIN32_LEAN_AND_MEAN)
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #if !defined(NOGDI)
+            #define NOGDI
+        #endif
+        #if !defined(NOUSER)
+            #define NOUSER
+        #endif
+        #if !defined(NOMINMAX)
+            #define NOMINMAX
+        #endif
+        #if !defined(_WIN32_WINNT)
+            #define _WIN32_WINNT 0x0600     // SRW locks require Windows Vista
+        #endif
+        #include <windows.h>        // Required for: SRWLOCK, AcquireSRWLockExclusive(), CreateThread(), WaitForSingleObject(), CloseHandle()
+    #else
+        #include <pthread.h>        // Required for: pthread_mutex_t, pthread_mutex_lock(), pthread_mutex_unlock(), pthread_create(), pthread_join()
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define RRES_BUFFER_POOL_MIN_CLASS          8   // Buffer pool smallest size class: 256 bytes (2^8)
+#define RRES_BUFFER_POOL_CLASS_COUNT       24   // Buffer pool size classes count, biggest class: 2GB (2^31)
+#define RRES_CACHE_BUCKET_COUNT           256   // Resource cache hash table buckets (power-of-two)
+#define RRES_MOUNT_INDEX_MIN_CAPACITY     256   // Mount set index minimum capacity (power-of-two), kept at most half full
+#define RRES_MAX_THREADS                   64   // Maximum worker threads for parallel jobs
+#define RRES_PACK_BATCH_PER_THREAD          4   // Resource chunks packed per thread before writing them (bounds memory usage)
+#define RRES_DEDUP_BUCKET_COUNT          4096   // Writer deduplication hash table buckets (power-of-two)
+#define RRES_COPY_BLOCK_SIZE            65536   // Block size to copy resource chunks data between files (bounds memory usage)
+
+// File access with 64bit offsets, required by large archive files
+// NOTE: fseeko()/ftello() are POSIX.1-2001, off_t is 64bit with _FILE_OFFSET_BITS=64 (see above),
+// strict ISO C builds (i.e. -std=c99) do not declare them, fseek() is used and 32bit platforms can not address more than 2GB
+#if defined(_WIN32)
+    #define RRES_FSEEK(file, offset, origin)    _fseeki64(file, (long long)(offset), origin)
+    #define RRES_FTELL(file)                    _ftelli64(file)
+#elif defined(__APPLE__) || defined(_LARGEFILE_SOURCE) || (defined(_POSIX_C_SOURCE) && (_POSIX_C_SOURCE >= 200112L))
+    #define RRES_FSEEK(file, offset, origin)    fseeko(file, (off_t)(offset), origin)
+    #define RRES_FTELL(file)                    (long long)ftello(file)
+#else
+    #define RRES_FSEEK(file, offset, origin)    fseek(file, (long)(offset), origin)
+    #define RRES_FTELL(file)                    (long long)ftell(file)
+#endif
+
+// Mutex required to share state between threads
+// NOTE: Only available if RRES_SUPPORT_THREADS is defined, otherwise they do nothing
+#if defined(RRES_SUPPORT_THREADS)
+    #if defined(_WIN32)
+        #define RRES_MUTEX_INIT(m)          InitializeSRWLock(&(m)->lock)
+        #define RRES_MUTEX_DESTROY(m)
+        #define RRES_MUTEX_LOCK(m)          AcquireSRWLockExclusive(&(m)->lock)
+        #define RRES_MUTEX_UNLOCK(m)        ReleaseSRWLockExclusive(&(m)->lock)
+    #else
+        #define RRES_MUTEX_INIT(m)          pthread_mutex_init(&(m)->lock, NULL)
+        #define RRES_MUTEX_DESTROY(m)       pthread_mutex_destroy(&(m)->lock)
+        #define RRES_MUTEX_LOCK(m)          pthread_mutex_lock(&(m)->lock)
+        #define RRES_MUTEX_UNLOCK(m)        pthread_mutex_unlock(&(m)->lock)
+    #endif
+#else
+    #define RRES_MUTEX_INIT(m)
+    #define RRES_MUTEX_DESTROY(m)
+    #define RRES_MUTEX_LOCK(m)
+    #define RRES_MUTEX_UNLOCK(m)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Mutex to protect shared state
+typedef struct rresMutex {
+#if defined(RRES_SUPPORT_THREADS)
+    #if defined(_WIN32)
+    SRWLOCK lock;                   // Slim reader/writer lock, used in exclusive mode
+    #else
+    pthread_mutex_t lock;           // POSIX mutex
+    #endif
+#else
+    int unused;                     // Not used, threads support not enabled
+#endif
+} rresMutex;
+
+// Parallel jobs state, shared by worker threads
+typedef struct rresParallelJobs {
+    rresJobCallback job;            // Job callback
+    void *userData;                 // Job user data
+    unsigned int jobCount;          // Jobs count
+    unsigned int nextJob;           // Next job to be processed
+    rresMutex mutex;                // Next job access mutex
+} rresParallelJobs;
+
+// Resource chunks packing batch
+typedef struct rresPackBatch {
+    rresPackItem *items;            // Items to pack
+    bool *results;                  // Items packing results
+    rresPackCallback pack;          // Pack callback
+    void *userData;                 // Pack callback user data
+} rresPackBatch;
+
+// Buffer pool, packed data buffers grouped by size class
+// NOTE: Retained buffers are linked through their first bytes (pointer to next buffer)
+struct rresBufferPool {
+    void *freeList[RRES_BUFFER_POOL_CLASS_COUNT];   // Retained buffers list for every size class
+    unsigned int maxRetainedSize;   // Maximum bytes retained by the pool
+    rresBufferPoolStats stats;      // Pool stats
+    rresMutex mutex;                // Pool access mutex
+};
+
+// Mount set index entry
+typedef struct rresMountEntry {
+    unsigned int id;                // Key: Resource id
+    unsigned int archiveIndex;      // Providing archive index in mount set + 1 (0 if entry is empty)
+    unsigned long long offset;      // Resource chunk info global offset in archive file
+} rresMountEntry;
+
+// Mount set, archives sorted by priority + merged index (open addressing hash table)
+struct rresMountSet {
+    rresArchive **archives;         // Mounted archives, sorted by priority (lowest first)
+    int *priorities;                // Mounted archives priorities
+    unsigned int archiveCount;      // Mounted archives count
+    unsigned int archiveCapacity;   // Mounted archives capacity
+    rresMountEntry *entries;        // Merged index entries
+    unsigned int entryCount;        // Merged index entries used
+    unsigned int entryCapacity;     // Merged index entries capacity (power-of-two)
+};
+
+// Resource cache entry
+// NOTE: Chunk must be the first member, cached chunks pointers returned to user are entries pointers
+typedef struct rresCacheEntry {
+    rresResourceChunk chunk;        // Cached resource chunk
+    rresArchive *archive;           // Key: Resource archive
+    int rresId;                     // Key: Resource id
+    bool unpacked;                  // Key: Resource chunk unpacked state (decompressed/decrypted)
+    bool pinned;                    // Entry pinned, never evicted
+    unsigned int refCount;          // Entry references count
+    unsigned long long size;        // Entry memory size (props + raw data)
+    struct rresCacheEntry *hashNext;    // Next entry in hash bucket
+    struct rresCacheEntry *prev;    // Previous entry in LRU list (more recently used)
+    struct rresCacheEntry *next;    // Next entry in LRU list (less recently used)
+} rresCacheEntry;
+
+// Resource cache, hash table of entries + LRU list
+struct rresResourceCache {
+    rresCacheEntry *buckets[RRES_CACHE_BUCKET_COUNT];   // Hash table buckets
+    rresCacheEntry *first;          // Most recently used entry
+    rresCacheEntry *last;           // Least recently used entry
+    unsigned int maxSize;           // Memory budget (bytes)
+    rresResourceCacheStats stats;   // Cache stats
+    rresMutex mutex;                // Cache access mutex
+};
+
+// Writer central directory entry
+typedef struct rresWriterEntry {
+    unsigned int id;                // Resource id
+    char *fileName;                 // Resource original fileName
+} rresWriterEntry;
+
+// Writer chunk record, required to link multi-chunk resources and to fill central directory
+typedef struct rresWriterChunk {
+    unsigned int id;                // Resource chunk id
+    unsigned long long offset;      // Resource chunk global offset in file
+    unsigned short flags;           // Resource chunk flags in file
+    bool dead;                      // Resource chunk replaced or removed (RRES_FLAG_DEAD written on close if required)
+    unsigned long long aliasOffset; // Aliased resource chunk global offset in file (0 if not alias)
+} rresWriterChunk;
+
+// Writer chunk data record, required to deduplicate chunks data
+// NOTE: Candidates are found by content hash and verified against data in file
+typedef struct rresWriterPayload {
+    unsigned long long hash;        // Content hash (FNV-1a 64bit): propCount + props[] + data (not compressed/encrypted) or packed data
+    unsigned long long size;        // Content size
+    unsigned long long offset;      // Resource chunk global offset in file
+    rresResourceChunkInfo info;     // Resource chunk info as written
+    unsigned int next;              // Next payload in hash bucket (index + 1, 0 if last)
+} rresWriterPayload;
+
+// rres file writer
+struct rresWriter {
+    FILE *file;                     // File being written
+    rresFileHeader header;          // File header, written on close
+    rresResourceChunkInfo info;     // Current resource chunk info, written on chunk end
+    rresResourceChunkInfo prevInfo; // Previous resource chunk info, required to link multi-chunk resources
+    bool chunkOpen;                 // Resource chunk currently being written
+    bool error;                     // Writing error, file is not valid
+    rresWriterChunk *chunks;        // Written resource chunks (including existing ones when appending)
+    unsigned int appendStart;       // First resource chunk written by this writer, previous ones already existed in file
+    unsigned int chunkCapacity;     // Written resource chunks capacity
+    rresWriterEntry *entries;       // Central directory entries
+    unsigned int entryCount;        // Central directory entries count
+    unsigned int entryCapacity;     // Central directory entries capacity
+    rresWriterPayload *payloads;    // Written chunks data records (deduplication enabled)
+    unsigned int payloadCount;      // Written chunks data records count
+    unsigned int payloadCapacity;   // Written chunks data records capacity
+    unsigned int *payloadBuckets;   // Written chunks data records hash table (index + 1, 0 if empty), NULL if deduplication disabled
+};
+
+// Resource chunk reader
+struct rresChunkReader {
+    FILE *file;                     // Archive file, positioned at packed data read position
+    rresResourceChunkInfo info;     // Resource chunk info (aliases resolved)
+    unsigned long long dataOffset;  // Packed data global offset in file
+    unsigned long long position;    // Packed data read position
+    unsigned int crc32;             // Packed data CRC32, updated on read
+    bool error;                     // Reading error, data can not be verified
+};
+
+// Resource access trace
+struct rresAccessTrace {
+    unsigned int *ids;              // Requested resource ids, in request order
+    unsigned int count;             // Requested resource ids count
+    unsigned int capacity;          // Requested resource ids capacity
+    rresMutex mutex;                // Trace access mutex (loaders can record from multiple threads)
+};
+
+// File rewrite resource chunk, used to reorder/patch chunks
+// NOTE: Alias chunks are resolved, info and offset refer to aliased chunk (info.id is kept)
+typedef struct rresRewriteChunk {
+    rresResourceChunkInfo info;     // Resource chunk info
+    unsigned long long offset;      // Resource chunk data global offset in file
+    bool written;                   // Resource chunk already written to output file
+} rresRewriteChunk;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *password = NULL;     // Password pointer, managed by user libraries
+static rresAccessTrace *accessTrace = NULL; // Access trace recorded by loaders, managed by user
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -561,534 +1102,3511 @@ static const char *password = NULL;     // Password pointer, managed by user lib
 // Load resource chunk packed data into our data struct
 static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *packedData);
 
+// Read rres structures from file, as defined by file version
+static bool rresReadFileHeader(FILE *rresFile, rresFileHeader *header);             // Read file header, returns true if signature and version are valid
+static bool rresReadResourceChunkInfo(FILE *rresFile, unsigned short version, rresResourceChunkInfo *info); // Read resource chunk info
+static bool rresResolveAliasChunk(FILE *rresFile, unsigned short version, rresResourceChunkInfo *info); // Resolve alias resource chunk, file is moved to aliased chunk data
+static unsigned int rresUpdateCRC32(unsigned int crc, const unsigned char *data, unsigned long long len); // Update CRC32 with provided data (incremental)
+
+// Load resource chunk(s) from file, using buffer pool for packed data (if provided)
+// NOTE: Resource chunk info offset can be provided to read chunk directly (0 to scan file)
+static rresResourceChunk rresLoadResourceChunkFromFile(const char *fileName, int rresId, rresBufferPool *pool, unsigned long long offset);
+static rresResourceMulti rresLoadResourceMultiFromFile(const char *fileName, int rresId, rresBufferPool *pool, unsigned long long offset);
+static rresResourceChunk rresLoadHeaderChunk(const char *fileName, unsigned int type); // Load first live resource chunk of provided type (header chunks: KDFR, DICT)
+
+// Buffer pool management
+static rresBufferPool *rresLoadBufferPool(unsigned int maxRetainedSize);           // Load buffer pool
+static void rresUnloadBufferPool(rresBufferPool *pool);                             // Unload buffer pool, retained buffers are freed
+static void *rresRequestPoolBuffer(rresBufferPool *pool, unsigned long long size); // Request buffer from pool (allocated if not available)
+static void rresReleasePoolBuffer(rresBufferPool *pool, void *buffer, unsigned long long size); // Release buffer to pool (freed if not retained)
+
+// Parallel jobs management
+#if defined(RRES_SUPPORT_THREADS)
+#if defined(_WIN32)
+static DWORD WINAPI rresJobWorker(LPVOID jobs);                                     // Worker thread: process jobs until none left
+#else
+static void *rresJobWorker(void *jobs);                                             // Worker thread: process jobs until none left
+#endif
+#endif
+static void rresPackJob(void *batch, unsigned int index);                           // Pack job: pack resource chunk and compute CRC32
+
+// Writer management
+static bool rresBeginWriterChunk(rresWriter *writer, rresResourceChunkInfo info, unsigned int propCount, const unsigned int *props, bool writeProps); // Begin resource chunk, writing props if required
+static bool rresWriteToFile(rresWriter *writer, const void *data, unsigned long long size, bool updateCRC); // Write data to file, updating current chunk size and CRC32 (if required)
+static bool rresWriteResourceChunkInfo(rresWriter *writer, unsigned long long offset, rresResourceChunkInfo info); // Write resource chunk info at provided offset
+static bool rresWriteCentralDirectory(rresWriter *writer);                          // Write central directory resource chunk
+static bool rresAddWriterChunk(rresWriter *writer, unsigned int id, unsigned long long offset, unsigned short flags); // Register resource chunk in writer
+static void rresRemoveWriterChunks(rresWriter *writer, unsigned int id, unsigned int count); // Mark first count writer resource chunks with provided id as dead
+static unsigned long long rresUpdateHash64(unsigned long long hash, const void *data, unsigned long long size); // Update content hash with provided data (FNV-1a 64bit)
+static rresWriterPayload *rresFindWriterPayload(rresWriter *writer, rresResourceChunkInfo info, unsigned long long hash, unsigned int propCount, const unsigned int *props, const void *data, unsigned long long size, bool withProps); // Find written chunk with identical data
+static void rresAddWriterPayload(rresWriter *writer, unsigned long long hash, unsigned long long size); // Register last written chunk data
+static bool rresCompareFileData(FILE *file, const void *data, unsigned long long size); // Compare file data at current position with provided data
+static bool rresWriteAliasChunk(rresWriter *writer, unsigned int id, const rresWriterPayload *payload); // Write alias resource chunk, pointing to payload resource chunk
+
+// File rewrite management
+static void rresRecordAccess(unsigned int id);                                      // Record resource id access into current access trace (if set)
+static FILE *rresOpenFile(const char *fileName, rresFileHeader *header);           // Open rres file for reading, file header is read and validated
+static unsigned int rresComputeRewriteChecksum(const rresRewriteChunk *chunks, unsigned int chunkCount); // Compute resource chunks checksum (CRC32 of ids and chunks CRC32)
+static rresRewriteChunk *rresLoadRewriteChunks(FILE *rresFile, rresFileHeader header, unsigned int *chunkCount, unsigned int *deadCount, unsigned int *aliasCount); // Load live resource chunks info in file order (aliases resolved)
+static int rresCompareRewriteChunks(const void *a, const void *b);                  // Compare rewrite chunks by id and file offset (qsort)
+static int rresCompareRewriteOffsets(const void *a, const void *b);                 // Compare rewrite chunks pointers by file offset (qsort)
+static unsigned int rresFindRewriteChunk(const rresRewriteChunk *chunks, unsigned int chunkCount, unsigned int id); // Find first rewrite chunk with provided id (chunks sorted by id)
+static bool rresWriteRewriteChunks(rresWriter *writer, FILE *rresFile, rresRewriteChunk *chunks, unsigned int chunkCount, unsigned int first); // Write resource chunks with the same id starting at first
+static bool rresCopyResourceChunk(rresWriter *writer, FILE *rresFile, rresResourceChunkInfo info, unsigned long long offset); // Copy resource chunk data into writer
+
+// Mount set index management
+static rresMountEntry *rresFindMountEntry(const rresMountSet *set, unsigned int id);  // Find mount index entry for id (empty entry if not available)
+static bool rresMergeMountIndex(rresMountSet *set, unsigned int archiveIndex);      // Merge archive resources into mount index, overriding lower priority ones
+static bool rresBuildMountIndex(rresMountSet *set);                                 // Build mount index from all mounted archives
+
+// Resource cache management
+static rresCacheEntry *rresFindCacheEntry(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked); // Find cache entry (mutex must be locked)
+static void rresTouchCacheEntry(rresResourceCache *cache, rresCacheEntry *entry);   // Move cache entry to LRU list front (mutex must be locked)
+static void rresRemoveCacheEntry(rresResourceCache *cache, rresCacheEntry *entry);  // Remove cache entry from hash table and LRU list (mutex must be locked)
+static void rresEvictCacheEntries(rresResourceCache *cache);                        // Evict not referenced entries to fit memory budget (mutex must be locked)
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
 // Load one resource chunk for provided id
 rresResourceChunk rresLoadResourceChunk(const char *fileName, int rresId)
 {
-    rresResourceChunk chunk = { 0 };
+    return rresLoadResourceChunkFromFile(fileName, rresId, NULL, 0);
+}
+
+// Unload resource chunk from memory
+void rresUnloadResourceChunk(rresResourceChunk chunk)
+{
+    rresUnloadResourceChunkData(chunk.data);
+}
+
+// Load resource from file by id
+// NOTE: All resources conected to base id are loaded
+rresResourceMulti rresLoadResourceMulti(const char *fileName, int rresId)
+{
+    return rresLoadResourceMultiFromFile(fileName, rresId, NULL, 0);
+}
+
+// Unload resource data
+void rresUnloadResourceMulti(rresResourceMulti multi)
+{
+    for (unsigned int i = 0; i < multi.count; i++) rresUnloadResourceChunk(multi.chunks[i]);
+
+    RRES_FREE(multi.chunks);
+}
+
+// Open rres archive
+// NOTE: File header is validated but file is not kept opened, it is opened on every load
+rresArchive *rresOpenArchive(const char *fileName)
+{
+    rresArchive *archive = NULL;
 
     FILE *rresFile = fopen(fileName, "rb");
 
     if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
     else
     {
-        RRES_LOG("RRES: INFO: Loading resource from file: %s\n", fileName);
-
         rresFileHeader header = { 0 };
 
-        // Read rres file header
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
-
-        // Verify file signature: "rres" and file version: 100
-        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        // Read rres file header, verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
         {
-            bool found = false;
+            archive = (rresArchive *)RRES_CALLOC(1, sizeof(rresArchive));
 
-            // Check all available chunks looking for the requested id
-            for (int i = 0; i < header.chunkCount; i++)
+            if (archive != NULL)
             {
-                rresResourceChunkInfo info = { 0 };
-
-                // Read resource info header
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
-
-                // Check if resource id is the requested one
-                if (info.id == rresId)
-                {
-                    found = true;
+                strncpy(archive->fileName, fileName, RRES_MAX_FILENAME_SIZE - 1);
+                archive->header = header;
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
-                    RRES_LOG("RRES: INFO: Found requested resource id: 0x%08x\n", info.id);
-                    RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+        fclose(rresFile);
+    }
 
-                    // NOTE: We only load first matching id resource chunk found but
-                    // we show a message if additional chunks are detected
-                    if (info.nextOffset != 0) RRES_LOG("RRES: WARNING: Multiple linked resource chunks available for the provided id");
+    return archive;
+}
 
-                    /*
-                    // Variables required to check multiple chunks
-                    int chunkCount = 0;
-                    long currentFileOffset = ftell(rresFile);           // Store current file position
-                    rresResourceChunkInfo temp = info;                  // Temp info header to scan resource chunks
+// Close rres archive
+void rresCloseArchive(rresArchive *archive)
+{
+    if (archive != NULL)
+    {
+        rresUnloadBufferPool(archive->pool);
+        RRES_FREE(archive);
+    }
+}
 
-                    // Count all linked resource chunks checking temp.nextOffset
-                    while (temp.nextOffset != 0)
-                    {
-                        fseek(rresFile, temp.nextOffset, SEEK_SET);     // Jump to next linked resource
-                        fread(&temp, sizeof(rresResourceChunkInfo), 1, rresFile);  // Read next resource info header
-                        chunkCount++;
-                    }
+// Load one resource chunk for provided id from archive
+rresResourceChunk rresLoadArchiveResourceChunk(rresArchive *archive, int rresId)
+{
+    rresResourceChunk chunk = { 0 };
 
-                    fseek(rresFile, currentFileOffset, SEEK_SET);       // Return to first resource chunk position
-                    */
+    if (archive != NULL) chunk = rresLoadResourceChunkFromFile(archive->fileName, rresId, archive->pool, 0);
 
-                    // Read and resource chunk from file data
-                    // NOTE: Read data can be compressed/encrypted, it's up to the user library to manage decompression/decryption
-                    void *data = RRES_MALLOC(info.packedSize);    // Allocate enough memory to store resource data chunk
-                    fread(data, info.packedSize, 1, rresFile);    // Read data: propsCount + props[] + data (+additional_data)
+    return chunk;
+}
 
-                    // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                    chunk.data = rresLoadResourceChunkData(info, data);
-                    chunk.info = info;
+// Load resource for provided id from archive (multiple resource chunks)
+rresResourceMulti rresLoadArchiveResourceMulti(rresArchive *archive, int rresId)
+{
+    rresResourceMulti multi = { 0 };
 
-                    RRES_FREE(data);
+    if (archive != NULL) multi = rresLoadResourceMultiFromFile(archive->fileName, rresId, archive->pool, 0);
 
-                    break;      // Resource id found and loaded, stop checking the file
-                }
-                else
-                {
-                    // Skip required data size to read next resource info header
-                    fseek(rresFile, info.packedSize, SEEK_CUR);
-                }
-            }
+    return multi;
+}
 
-            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
-        }
-        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+// Set archive buffer pool
+// NOTE: Previous pool (if any) is unloaded, retained buffers are freed
+// WARNING: It should not be called while other threads are loading from the archive
+void rresSetArchiveBufferPool(rresArchive *archive, unsigned int maxRetainedSize)
+{
+    if (archive != NULL)
+    {
+        rresUnloadBufferPool(archive->pool);
+        archive->pool = NULL;
 
-        fclose(rresFile);
+        if (maxRetainedSize > 0) archive->pool = rresLoadBufferPool(maxRetainedSize);
     }
-
-    return chunk;
 }
 
-// Unload resource chunk from memory
-void rresUnloadResourceChunk(rresResourceChunk chunk)
+// Get archive buffer pool stats
+rresBufferPoolStats rresGetArchiveBufferPoolStats(rresArchive *archive)
 {
-    RRES_FREE(chunk.data.props);  // Resource chunk properties
-    RRES_FREE(chunk.data.raw);    // Resource chunk raw data
+    rresBufferPoolStats stats = { 0 };
+
+    if ((archive != NULL) && (archive->pool != NULL))
+    {
+        RRES_MUTEX_LOCK(&archive->pool->mutex);
+        stats = archive->pool->stats;
+        RRES_MUTEX_UNLOCK(&archive->pool->mutex);
+    }
+
+    return stats;
 }
 
-// Load resource from file by id
-// NOTE: All resources conected to base id are loaded
-rresResourceMulti rresLoadResourceMulti(const char *fileName, int rresId)
+// Open resource chunk reader for provided id
+// NOTE: File is kept open until reader is closed, first live resource chunk with id is read (multi-chunk
+// resources next chunks are not), it returns NULL if chunk is not found or chunk does not contain data
+rresChunkReader *rresOpenChunkReader(rresArchive *archive, int rresId, rresResourceChunkInfo *info)
 {
-    rresResourceMulti rres = { 0 };
+    rresChunkReader *reader = NULL;
+    rresFileHeader header = { 0 };
 
-    FILE *rresFile = fopen(fileName, "rb");
+    FILE *rresFile = (archive != NULL)? rresOpenFile(archive->fileName, &header) : NULL;
 
-    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
-    else
+    if (rresFile != NULL)
     {
-        rresFileHeader header = { 0 };
+        bool found = false;
 
-        // Read rres file header
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
-
-        // Verify file signature: "rres" and file version: 100
-        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        for (unsigned int i = 0; i < header.chunkCount; i++)
         {
-            bool found = false;
+            rresResourceChunkInfo chunkInfo = { 0 };
+            if (!rresReadResourceChunkInfo(rresFile, header.version, &chunkInfo)) break;
 
-            // Check all available chunks looking for the requested id
-            for (int i = 0; i < header.chunkCount; i++)
+            // NOTE: Dead resource chunks (replaced or removed) are skipped
+            if ((chunkInfo.id == rresId) && ((chunkInfo.flags & RRES_FLAG_DEAD) == 0))
             {
-                rresResourceChunkInfo info = { 0 };
+                found = true;
+                rresRecordAccess(chunkInfo.id);
 
-                // Read resource info header
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
-
-                // Check if resource id is the requested one
-                if (info.id == rresId)
+                // Resolve alias resource chunk (deduplicated data), file is moved to aliased chunk data
+                if (rresResolveAliasChunk(rresFile, header.version, &chunkInfo) && (rresGetDataType(chunkInfo.type) != RRES_DATA_NULL))
                 {
-                    found = true;
+                    reader = (rresChunkReader *)RRES_CALLOC(1, sizeof(rresChunkReader));
 
-                    RRES_LOG("RRES: INFO: Found requested resource id: 0x%08x\n", info.id);
-                    RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+                    if (reader != NULL)
+                    {
+                        reader->file = rresFile;
+                        reader->info = chunkInfo;
+                        reader->dataOffset = (unsigned long long)RRES_FTELL(rresFile);
 
-                    rres.count = 1;
+                        if (info != NULL) *info = chunkInfo;
+                    }
+                }
 
-                    long currentFileOffset = ftell(rresFile);               // Store current file position
-                    rresResourceChunkInfo temp = info;                      // Temp info header to scan resource chunks
+                break;
+            }
+            else RRES_FSEEK(rresFile, chunkInfo.packedSize, SEEK_CUR);    // Jump to next resource
+        }
 
-                    // Count all linked resource chunks checking temp.nextOffset
-                    while (temp.nextOffset != 0)
-                    {
-                        fseek(rresFile, temp.nextOffset, SEEK_SET);         // Jump to next linked resource
-                        fread(&temp, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
-                        rres.count++;
-                    }
+        if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+        if (reader == NULL) fclose(rresFile);
+    }
 
-                    rres.chunks = (rresResourceChunk *)RRES_CALLOC(rres.count, sizeof(rresResourceChunk)); // Load as many rres slots as required
-                    fseek(rresFile, currentFileOffset, SEEK_SET);           // Return to first resource chunk position
+    return reader;
+}
 
-                    // Read and load data chunk from file data
-                    // NOTE: Read data can be compressed/encrypted,
-                    // it's up to the user library to manage decompression/decryption
-                    void *data = RRES_MALLOC(info.packedSize);              // Allocate enough memory to store resource data chunk
-                    fread(data, info.packedSize, 1, rresFile);              // Read data: propsCount + props[] + data (+additional_data)
+// Read next resource chunk packed data piece
+// NOTE: Pieces are read in order, reading stops at packed data end
+unsigned long long rresReadChunkData(rresChunkReader *reader, void *buffer, unsigned long long size)
+{
+    unsigned long long bytesRead = 0;
 
-                    // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                    rres.chunks[0].data = rresLoadResourceChunkData(info, data);
-                    rres.chunks[0].info = info;
+    if ((reader != NULL) && !reader->error)
+    {
+        if (size > (reader->info.packedSize - reader->position)) size = reader->info.packedSize - reader->position;
 
-                    RRES_FREE(data);
+        if (size > 0)
+        {
+            bytesRead = fread(buffer, 1, (size_t)size, reader->file);
+            reader->crc32 = rresUpdateCRC32(reader->crc32, (const unsigned char *)buffer, bytesRead);
+            reader->position += bytesRead;
 
-                    int i = 1;
+            if (bytesRead < size) reader->error = true;
+        }
+    }
 
-                    // Load all linked resource chunks
-                    while (info.nextOffset != 0)
-                    {
-                        fseek(rresFile, info.nextOffset, SEEK_SET);         // Jump to next resource chunk
-                        fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
+    return bytesRead;
+}
 
-                        RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+// Read resource chunk packed data at offset
+// NOTE: Useful to read data appended by encryption (salt, nonce, MAC...) before reading the encrypted data,
+// read position and CRC32 are not changed (data must be read again in order to be verified)
+bool rresReadChunkDataAt(rresChunkReader *reader, unsigned long long offset, void *buffer, unsigned long long size)
+{
+    bool result = false;
 
-                        void *data = RRES_MALLOC(info.packedSize);          // Allocate enough memory to store resource data chunk
-                        fread(data, info.packedSize, 1, rresFile);          // Read data: propsCount + props[] + data (+additional_data)
+    if ((reader != NULL) && !reader->error && (offset <= reader->info.packedSize) && (size <= (reader->info.packedSize - offset)))
+    {
+        result = (RRES_FSEEK(reader->file, reader->dataOffset + offset, SEEK_SET) == 0) &&
+                 (fread(buffer, 1, (size_t)size, reader->file) == size);
 
-                        // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                        rres.chunks[i].data = rresLoadResourceChunkData(info, data);
-                        rres.chunks[i].info = info;
+        if (RRES_FSEEK(reader->file, reader->dataOffset + reader->position, SEEK_SET) != 0) reader->error = true;
+    }
 
-                        RRES_FREE(data);
+    return result;
+}
 
-                        i++;
-                    }
+// Close resource chunk reader
+// NOTE: Returns true only if all packed data was read and CRC32 matches, data read is not valid otherwise
+bool rresCloseChunkReader(rresChunkReader *reader)
+{
+    bool result = false;
 
-                    break;      // Resource id found and loaded, stop checking the file
-                }
-                else
-                {
-                    // Skip required data size to read next resource info header
-                    fseek(rresFile, info.packedSize, SEEK_CUR);
-                }
-            }
+    if (reader != NULL)
+    {
+        result = !reader->error && (reader->position == reader->info.packedSize) && (reader->crc32 == reader->info.crc32);
 
-            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
-        }
-        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+        if (!reader->error && (reader->position == reader->info.packedSize) && !result) RRES_LOG("RRES: WARNING: [ID 0x%08x] CRC32 does not match, data can be corrupted\n", reader->info.id);
 
-        fclose(rresFile);
+        fclose(reader->file);
+        RRES_FREE(reader);
     }
 
-    return rres;
+    return result;
 }
 
-// Unload resource data
-void rresUnloadResourceMulti(rresResourceMulti multi)
+// Load mount set
+rresMountSet *rresLoadMountSet(void)
 {
-    for (unsigned int i = 0; i < multi.count; i++) rresUnloadResourceChunk(multi.chunks[i]);
-
-    RRES_FREE(multi.chunks);
+    return (rresMountSet *)RRES_CALLOC(1, sizeof(rresMountSet));
 }
 
-// Load resource chunk info for provided id
-RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, int rresId)
+// Unload mount set
+// NOTE: Mounted archives are not closed, they are owned by the user
+void rresUnloadMountSet(rresMountSet *set)
 {
-    rresResourceChunkInfo info = { 0 };
+    if (set != NULL)
+    {
+        RRES_FREE(set->archives);
+        RRES_FREE(set->priorities);
+        RRES_FREE(set->entries);
+        RRES_FREE(set);
+    }
+}
 
-    FILE *rresFile = fopen(fileName, "rb");
+// Mount archive with priority
+// NOTE: Archives with the same priority are stacked in mount order (last mounted overrides),
+// archive resources are merged into index if mounted on top, index is rebuilt otherwise
+// WARNING: It should not be called while other threads are loading from the mount set
+bool rresMountArchive(rresMountSet *set, rresArchive *archive, int priority)
+{
+    if ((set == NULL) || (archive == NULL)) return false;
 
-    if (rresFile != NULL)
+    if (set->archiveCount == set->archiveCapacity)
     {
-        rresFileHeader header = { 0 };
+        unsigned int capacity = (set->archiveCapacity > 0)? set->archiveCapacity*2 : 8;
+        rresArchive **archives = (rresArchive **)RRES_REALLOC(set->archives, capacity*sizeof(rresArchive *));
+        if (archives != NULL) set->archives = archives;
+        int *priorities = (int *)RRES_REALLOC(set->priorities, capacity*sizeof(int));
+        if (priorities != NULL) set->priorities = priorities;
+
+        if ((archives == NULL) || (priorities == NULL)) return false;
+        set->archiveCapacity = capacity;
+    }
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+    // Insert archive after archives with lower or equal priority
+    unsigned int index = set->archiveCount;
+    while ((index > 0) && (set->priorities[index - 1] > priority)) index--;
 
-        // Verify file signature: "rres", file version: 100
-        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
-        {
-            // Try to find provided resource chunk id and read info chunk
-            for (int i = 0; i < header.chunkCount; i++)
-            {
-                // Read resource chunk info
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+    for (unsigned int i = set->archiveCount; i > index; i--)
+    {
+        set->archives[i] = set->archives[i - 1];
+        set->priorities[i] = set->priorities[i - 1];
+    }
 
-                if (info.id == rresId)
-                {
-                    // TODO: Jump to next resource chunk for provided id
-                    //if (info.nextOffset > 0) fseek(rresFile, info.nextOffset, SEEK_SET);
+    set->archives[index] = archive;
+    set->priorities[index] = priority;
+    set->archiveCount++;
 
-                    break; // If requested rresId is found, we return the read rresResourceChunkInfo
-                }
-                else fseek(rresFile, info.packedSize, SEEK_CUR); // Jump to next resource
-            }
-        }
-        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+    bool result = (index == (set->archiveCount - 1))? rresMergeMountIndex(set, index) : rresBuildMountIndex(set);
 
-        fclose(rresFile);
+    if (result) RRES_LOG("RRES: INFO: [%s] Archive mounted (priority: %i), resources available: %u\n", archive->fileName, priority, set->entryCount);
+    else
+    {
+        rresUnmountArchive(set, archive);
+        RRES_LOG("RRES: WARNING: [%s] Archive could not be mounted\n", archive->fileName);
     }
 
-    return info;
+    return result;
 }
 
-// Load all resource chunks info
-RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName, unsigned int *chunkCount)
+// Unmount archive
+// NOTE: Index is rebuilt, resources overridden by unmounted archive are provided again by lower priority archives
+// WARNING: It should not be called while other threads are loading from the mount set
+bool rresUnmountArchive(rresMountSet *set, rresArchive *archive)
 {
-    rresResourceChunkInfo *infos = { 0 };
-    unsigned int count = 0;
+    if ((set == NULL) || (archive == NULL)) return false;
+
+    unsigned int index = 0;
+    while ((index < set->archiveCount) && (set->archives[index] != archive)) index++;
+
+    if (index == set->archiveCount) return false;
+
+    for (unsigned int i = index; i < (set->archiveCount - 1); i++)
+    {
+        set->archives[i] = set->archives[i + 1];
+        set->priorities[i] = set->priorities[i + 1];
+    }
+
+    set->archiveCount--;
+
+    return rresBuildMountIndex(set);
+}
+
+// Get archive providing resource id (highest priority)
+rresArchive *rresGetMountedArchive(rresMountSet *set, int rresId)
+{
+    rresArchive *archive = NULL;
+
+    if ((set != NULL) && (set->entries != NULL))
+    {
+        rresMountEntry *entry = rresFindMountEntry(set, (unsigned int)rresId);
+
+        if (entry->archiveIndex > 0) archive = set->archives[entry->archiveIndex - 1];
+    }
+
+    return archive;
+}
+
+// Load one resource chunk for provided id from mounted archives
+// NOTE: Resource chunk is read directly from providing archive at indexed offset
+rresResourceChunk rresLoadMountedResourceChunk(rresMountSet *set, int rresId)
+{
+    rresResourceChunk chunk = { 0 };
+    rresMountEntry *entry = ((set != NULL) && (set->entries != NULL))? rresFindMountEntry(set, (unsigned int)rresId) : NULL;
+
+    if ((entry != NULL) && (entry->archiveIndex > 0))
+    {
+        rresArchive *archive = set->archives[entry->archiveIndex - 1];
+        chunk = rresLoadResourceChunkFromFile(archive->fileName, rresId, archive->pool, entry->offset);
+    }
+    else RRES_LOG("RRES: WARNING: Requested resource not found in mounted archives: 0x%08x\n", rresId);
+
+    return chunk;
+}
+
+// Load resource for provided id from mounted archives (multiple resource chunks)
+// NOTE: Linked resource chunks are always loaded from the same archive
+rresResourceMulti rresLoadMountedResourceMulti(rresMountSet *set, int rresId)
+{
+    rresResourceMulti multi = { 0 };
+    rresMountEntry *entry = ((set != NULL) && (set->entries != NULL))? rresFindMountEntry(set, (unsigned int)rresId) : NULL;
+
+    if ((entry != NULL) && (entry->archiveIndex > 0))
+    {
+        rresArchive *archive = set->archives[entry->archiveIndex - 1];
+        multi = rresLoadResourceMultiFromFile(archive->fileName, rresId, archive->pool, entry->offset);
+    }
+    else RRES_LOG("RRES: WARNING: Requested resource not found in mounted archives: 0x%08x\n", rresId);
+
+    return multi;
+}
+
+// Load resource cache with a memory budget
+// NOTE: Budget is a soft limit, referenced and pinned chunks are kept even if budget is exceeded
+rresResourceCache *rresLoadResourceCache(unsigned int maxSize)
+{
+    rresResourceCache *cache = (rresResourceCache *)RRES_CALLOC(1, sizeof(rresResourceCache));
+
+    if (cache != NULL)
+    {
+        cache->maxSize = maxSize;
+        RRES_MUTEX_INIT(&cache->mutex);
+    }
+
+    return cache;
+}
+
+// Unload resource cache
+// WARNING: All cached chunks are unloaded, including the still referenced ones
+void rresUnloadResourceCache(rresResourceCache *cache)
+{
+    if (cache != NULL)
+    {
+        rresCacheEntry *entry = cache->first;
+
+        while (entry != NULL)
+        {
+            rresCacheEntry *next = entry->next;
+            rresUnloadResourceChunk(entry->chunk);
+            RRES_FREE(entry);
+            entry = next;
+        }
+
+        RRES_MUTEX_DESTROY(&cache->mutex);
+        RRES_FREE(cache);
+    }
+}
+
+// Load resource chunk through cache
+// NOTE: Chunk is loaded from archive on cache miss, it is cached as loaded (packed state)
+const rresResourceChunk *rresLoadCachedResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId)
+{
+    const rresResourceChunk *cached = rresGetCachedResourceChunk(cache, archive, rresId, false);
+
+    if ((cached == NULL) && (cache != NULL))
+    {
+        rresResourceChunk chunk = rresLoadArchiveResourceChunk(archive, rresId);
+
+        // NOTE: Chunks not found or corrupted are not cached
+        if (chunk.data.raw != NULL) cached = rresCacheResourceChunk(cache, archive, rresId, false, chunk);
+    }
+
+    return cached;
+}
+
+// Get resource chunk from cache
+// NOTE: Returned chunk reference must be released with rresReleaseCachedResourceChunk()
+const rresResourceChunk *rresGetCachedResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked)
+{
+    rresCacheEntry *entry = NULL;
+
+    if (cache != NULL)
+    {
+        RRES_MUTEX_LOCK(&cache->mutex);
+
+        entry = rresFindCacheEntry(cache, archive, rresId, unpacked);
+
+        if (entry != NULL)
+        {
+            entry->refCount++;
+            rresTouchCacheEntry(cache, entry);
+            cache->stats.hitCount++;
+        }
+        else cache->stats.missCount++;
+
+        RRES_MUTEX_UNLOCK(&cache->mutex);
+    }
+
+    return (entry != NULL)? &entry->chunk : NULL;
+}
+
+// Add resource chunk to cache
+// NOTE: Cache takes ownership of chunk data, returned reference must be released with rresReleaseCachedResourceChunk()
+// In case the chunk was already cached (i.e. loaded concurrently), provided chunk is unloaded and cached one is returned
+const rresResourceChunk *rresCacheResourceChunk(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked, rresResourceChunk chunk)
+{
+    if (cache == NULL) return NULL;
+
+    rresCacheEntry *entry = (rresCacheEntry *)RRES_CALLOC(1, sizeof(rresCacheEntry));
+
+    if (entry == NULL)
+    {
+        rresUnloadResourceChunk(chunk);
+        return NULL;
+    }
+
+    entry->chunk = chunk;
+    entry->archive = archive;
+    entry->rresId = rresId;
+    entry->unpacked = unpacked;
+    entry->refCount = 1;
+
+    // Compute chunk memory size: props[] + raw data
+    // NOTE: If data is still compressed/encrypted, raw contains the full packed data (chunk.data.rawSize)
+    entry->size = chunk.data.propCount*sizeof(int) + chunk.data.rawSize;
+
+    RRES_MUTEX_LOCK(&cache->mutex);
+
+    rresCacheEntry *cached = rresFindCacheEntry(cache, archive, rresId, unpacked);
+
+    if (cached != NULL)
+    {
+        cached->refCount++;
+        rresTouchCacheEntry(cache, cached);
+    }
+    else
+    {
+        unsigned int bucket = ((unsigned int)rresId)&(RRES_CACHE_BUCKET_COUNT - 1);
+
+        entry->hashNext = cache->buckets[bucket];
+        cache->buckets[bucket] = entry;
+        rresTouchCacheEntry(cache, entry);
+
+        cache->stats.entryCount++;
+        cache->stats.usedSize += entry->size;
+
+        rresEvictCacheEntries(cache);
+    }
+
+    RRES_MUTEX_UNLOCK(&cache->mutex);
+
+    if (cached != NULL)
+    {
+        rresUnloadResourceChunk(entry->chunk);
+        RRES_FREE(entry);
+        entry = cached;
+    }
+
+    return &entry->chunk;
+}
+
+// Release cached resource chunk reference
+// NOTE: Not referenced chunks are kept in cache until they are evicted
+void rresReleaseCachedResourceChunk(rresResourceCache *cache, const rresResourceChunk *chunk)
+{
+    if ((cache != NULL) && (chunk != NULL))
+    {
+        rresCacheEntry *entry = (rresCacheEntry *)chunk;
+
+        RRES_MUTEX_LOCK(&cache->mutex);
+
+        if (entry->refCount > 0) entry->refCount--;
+        if (entry->refCount == 0) rresEvictCacheEntries(cache);
+
+        RRES_MUTEX_UNLOCK(&cache->mutex);
+    }
+}
+
+// Pin/unpin cached resource chunk
+// NOTE: Pinned chunks are never evicted, not even when not referenced
+void rresPinCachedResourceChunk(rresResourceCache *cache, const rresResourceChunk *chunk, bool pinned)
+{
+    if ((cache != NULL) && (chunk != NULL))
+    {
+        rresCacheEntry *entry = (rresCacheEntry *)chunk;
+
+        RRES_MUTEX_LOCK(&cache->mutex);
+
+        entry->pinned = pinned;
+        if (!pinned) rresEvictCacheEntries(cache);
+
+        RRES_MUTEX_UNLOCK(&cache->mutex);
+    }
+}
+
+// Unload not referenced cached chunks from archive
+// NOTE: Useful before closing an archive, pinned chunks are also unloaded
+void rresFlushResourceCache(rresResourceCache *cache, rresArchive *archive)
+{
+    if (cache != NULL)
+    {
+        RRES_MUTEX_LOCK(&cache->mutex);
+
+        rresCacheEntry *entry = cache->first;
+
+        while (entry != NULL)
+        {
+            rresCacheEntry *next = entry->next;
+
+            if ((entry->refCount == 0) && ((archive == NULL) || (entry->archive == archive)))
+            {
+                rresRemoveCacheEntry(cache, entry);
+                rresUnloadResourceChunk(entry->chunk);
+                RRES_FREE(entry);
+            }
+
+            entry = next;
+        }
+
+        RRES_MUTEX_UNLOCK(&cache->mutex);
+    }
+}
+
+// Get resource cache stats
+rresResourceCacheStats rresGetResourceCacheStats(rresResourceCache *cache)
+{
+    rresResourceCacheStats stats = { 0 };
+
+    if (cache != NULL)
+    {
+        RRES_MUTEX_LOCK(&cache->mutex);
+        stats = cache->stats;
+        RRES_MUTEX_UNLOCK(&cache->mutex);
+    }
+
+    return stats;
+}
+
+// Open rres file for writing
+// NOTE: File header is reserved and written on writer close
+rresWriter *rresOpenWriter(const char *fileName, unsigned short version)
+{
+    rresWriter *writer = NULL;
+
+    if ((version != RRES_FILE_VERSION) && (version != RRES_FILE_VERSION_LARGE))
+    {
+        RRES_LOG("RRES: WARNING: [%s] File version not supported: %i\n", fileName, version);
+        return NULL;
+    }
+
+    // NOTE: File is also opened for reading, written data is read back to verify deduplicated chunks
+    FILE *rresFile = fopen(fileName, "wb+");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened for writing\n", fileName);
+    else
+    {
+        writer = (rresWriter *)RRES_CALLOC(1, sizeof(rresWriter));
+
+        if (writer == NULL)
+        {
+            RRES_LOG("RRES: WARNING: [%s] rres file writer could not be allocated\n", fileName);
+            fclose(rresFile);
+            return NULL;
+        }
+
+        writer->file = rresFile;
+        writer->header.id[0] = 'r';
+        writer->header.id[1] = 'r';
+        writer->header.id[2] = 'e';
+        writer->header.id[3] = 's';
+        writer->header.version = version;
+
+        // Reserve file header space
+        unsigned char buffer[48] = { 0 };
+        if (fwrite(buffer, 1, rresGetFileHeaderSize(version), rresFile) != rresGetFileHeaderSize(version)) writer->error = true;
+
+        RRES_LOG("RRES: INFO: Writing rres file: %s\n", fileName);
+    }
+
+    return writer;
+}
+
+// Open existing rres file for appending
+// NOTE: Existing chunks and central directory entries are registered, new chunks are appended at file end and
+// the ones with an id already available in file replace the existing chunks (marked as RRES_FLAG_DEAD on close),
+// a new central directory is written on close, file is only valid with the new data after header is updated
+rresWriter *rresOpenWriterAppend(const char *fileName)
+{
+    rresWriter *writer = NULL;
+
+    FILE *rresFile = fopen(fileName, "rb+");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened for appending\n", fileName);
+    else
+    {
+        rresFileHeader header = { 0 };
+
+        // Read rres file header, verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
+        {
+            writer = (rresWriter *)RRES_CALLOC(1, sizeof(rresWriter));
+
+            if (writer == NULL)
+            {
+                RRES_LOG("RRES: WARNING: [%s] rres file writer could not be allocated\n", fileName);
+                fclose(rresFile);
+                return NULL;
+            }
+
+            writer->file = rresFile;
+            writer->header = header;
+            writer->header.chunkCount = 0;
+            writer->header.cdOffset = 0;
+
+            unsigned long long cdOffset = (header.cdOffset > 0)? (header.cdOffset + rresGetFileHeaderSize(header.version)) : 0;
+
+            // Register existing resource chunks, previous central directory is replaced
+            for (unsigned int i = 0; !writer->error && (i < header.chunkCount); i++)
+            {
+                rresResourceChunkInfo info = { 0 };
+                unsigned long long offset = (unsigned long long)RRES_FTELL(rresFile);
+
+                if (!rresReadResourceChunkInfo(rresFile, header.version, &info) || !rresAddWriterChunk(writer, info.id, offset, info.flags)) writer->error = true;
+                else
+                {
+                    writer->header.chunkCount++;
+                    if ((offset == cdOffset) && (rresGetDataType(info.type) == RRES_DATA_DIRECTORY)) writer->chunks[i].dead = true;
+
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);
+                }
+            }
+
+            writer->appendStart = writer->header.chunkCount;
+
+            if (writer->error) RRES_LOG("RRES: WARNING: [%s] rres file resource chunks could not be read\n", fileName);
+            else if (cdOffset > 0)
+            {
+                rresCentralDir dir = rresLoadCentralDirectory(fileName);
+
+                for (unsigned int i = 0; i < dir.count; i++) rresAddCentralDirEntry(writer, dir.entries[i].id, dir.entries[i].fileName);
+
+                rresUnloadCentralDirectory(dir);
+            }
+
+            if (RRES_FSEEK(rresFile, 0, SEEK_END) != 0) writer->error = true;
+
+            RRES_LOG("RRES: INFO: Appending to rres file: %s (%u resource chunks)\n", fileName, writer->appendStart);
+        }
+        else
+        {
+            RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+            fclose(rresFile);
+        }
+    }
+
+    return writer;
+}
+
+// Close rres file writer
+// NOTE: Central directory is written (if entries available) and file header is updated,
+// returns false if any error happened while writing the file
+bool rresCloseWriter(rresWriter *writer)
+{
+    if (writer == NULL) return false;
+
+    if (writer->chunkOpen)
+    {
+        RRES_LOG("RRES: WARNING: Resource chunk not ended before closing writer\n");
+        writer->error = true;
+    }
+
+    if (!writer->error && (writer->entryCount > 0)) writer->error = !rresWriteCentralDirectory(writer);
+
+    if (!writer->error && (writer->header.version == RRES_FILE_VERSION) && (writer->header.chunkCount > 65535))
+    {
+        RRES_LOG("RRES: WARNING: Resource chunks count exceeds version 100 limit, RRES_FILE_VERSION_LARGE required\n");
+        writer->error = true;
+    }
+
+    // Write final file header
+    if (!writer->error)
+    {
+        unsigned char buffer[48] = { 0 };
+        unsigned int headerSize = rresSerializeFileHeader(writer->header, buffer);
+
+        if ((RRES_FSEEK(writer->file, 0, SEEK_SET) != 0) || (fwrite(buffer, 1, headerSize, writer->file) != headerSize) || (fflush(writer->file) != 0)) writer->error = true;
+    }
+
+    // Mark replaced/removed resource chunks as dead
+    // NOTE: It is done after file header update, in case of failure the replaced chunks are still valid
+    // and found first by readers, RRES_FLAG_DEAD is only written once the file references the new data
+    for (unsigned int i = 0; !writer->error && (i < writer->header.chunkCount); i++)
+    {
+        if (writer->chunks[i].dead && ((writer->chunks[i].flags & RRES_FLAG_DEAD) == 0))
+        {
+            unsigned short flags = writer->chunks[i].flags | RRES_FLAG_DEAD;
+
+            // NOTE: Flags are placed after type, id, compType and cipherType (10 bytes) on both file versions
+            if ((RRES_FSEEK(writer->file, writer->chunks[i].offset + 10, SEEK_SET) != 0) || (fwrite(&flags, sizeof(unsigned short), 1, writer->file) != 1)) writer->error = true;
+        }
+    }
+
+    if (fclose(writer->file) != 0) writer->error = true;
+
+    bool result = !writer->error;
+
+    if (result) RRES_LOG("RRES: INFO: rres file written successfully: %u resource chunks\n", writer->header.chunkCount);
+    else RRES_LOG("RRES: WARNING: rres file could not be written properly\n");
+
+    for (unsigned int i = 0; i < writer->entryCount; i++) RRES_FREE(writer->entries[i].fileName);
+    RRES_FREE(writer->entries);
+    RRES_FREE(writer->chunks);
+    RRES_FREE(writer->payloads);
+    RRES_FREE(writer->payloadBuckets);
+    RRES_FREE(writer);
+
+    return result;
+}
+
+// Begin resource chunk
+// NOTE: Chunk info is reserved and written on chunk end, for not compressed/encrypted chunks
+// propCount, props[] and padding (if aligned) are written, data is expected next
+bool rresBeginResourceChunk(rresWriter *writer, rresResourceChunkInfo info, unsigned int propCount, const unsigned int *props)
+{
+    bool writeProps = ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE));
+
+    return rresBeginWriterChunk(writer, info, propCount, props, writeProps);
+}
+
+// Write resource chunk data
+bool rresWriteResourceChunkData(rresWriter *writer, const void *data, unsigned long long size)
+{
+    if ((writer == NULL) || writer->error) return false;
+
+    if (!writer->chunkOpen)
+    {
+        RRES_LOG("RRES: WARNING: Resource chunk data can not be written, chunk not begun\n");
+        return false;
+    }
+
+    return rresWriteToFile(writer, data, size, true);
+}
+
+// End resource chunk
+// NOTE: Chunk info is written with final sizes and CRC32, previous chunk is linked if it has the same id
+bool rresEndResourceChunk(rresWriter *writer)
+{
+    if ((writer == NULL) || writer->error || !writer->chunkOpen) return false;
+
+    rresWriterChunk chunk = writer->chunks[writer->header.chunkCount];
+
+    if ((writer->info.compType == RRES_COMP_NONE) && (writer->info.cipherType == RRES_CIPHER_NONE)) writer->info.baseSize = writer->info.packedSize;
+
+    if ((writer->header.version == RRES_FILE_VERSION) && ((chunk.offset + rresGetResourceChunkInfoSize(RRES_FILE_VERSION) + writer->info.packedSize) > 0xffffffff))
+    {
+        RRES_LOG("RRES: WARNING: File size exceeds version 100 limit (4GB), RRES_FILE_VERSION_LARGE required\n");
+        writer->error = true;
+    }
+
+    bool result = !writer->error;
+
+    // Link previous resource chunk with same id (multi-chunk resource)
+    // NOTE: Previous chunk info is written again, only nextOffset changes,
+    // chunks already existing in file (appending) are never linked
+    if (result && (writer->header.chunkCount > writer->appendStart) && (writer->chunks[writer->header.chunkCount - 1].id == chunk.id) && !writer->chunks[writer->header.chunkCount - 1].dead)
+    {
+        writer->prevInfo.nextOffset = chunk.offset;
+        result = rresWriteResourceChunkInfo(writer, writer->chunks[writer->header.chunkCount - 1].offset, writer->prevInfo);
+    }
+
+    if (result) result = rresWriteResourceChunkInfo(writer, chunk.offset, writer->info);
+    if (result) result = (RRES_FSEEK(writer->file, 0, SEEK_END) == 0);
+
+    if (result)
+    {
+        RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %llu | Packed size: %llu\n", writer->info.type[0], writer->info.type[1], writer->info.type[2], writer->info.type[3], writer->info.id, writer->info.baseSize, writer->info.packedSize);
+        writer->prevInfo = writer->info;
+        writer->header.chunkCount++;
+    }
+    else writer->error = true;
+
+    writer->chunkOpen = false;
+
+    return result;
+}
+
+// Write full resource chunk
+// NOTE: For compressed/encrypted chunks, data.raw must contain packed data (rawSize bytes)
+bool rresWriteResourceChunk(rresWriter *writer, rresResourceChunkInfo info, rresResourceChunkData data, unsigned long long rawSize)
+{
+    bool withProps = ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE));
+    unsigned long long hash = 0;
+    unsigned long long size = rawSize;
+
+    // Look for identical chunk data already written (deduplication enabled)
+    if ((writer != NULL) && !writer->error && !writer->chunkOpen && (writer->payloadBuckets != NULL))
+    {
+        if (withProps)
+        {
+            hash = rresUpdateHash64(0, &data.propCount, sizeof(unsigned int));
+            hash = rresUpdateHash64(hash, data.props, data.propCount*sizeof(unsigned int));
+            size += (1 + (unsigned long long)data.propCount)*sizeof(unsigned int);
+        }
+
+        hash = rresUpdateHash64(hash, data.raw, rawSize);
+
+        rresWriterPayload *payload = rresFindWriterPayload(writer, info, hash, data.propCount, data.props, data.raw, rawSize, withProps);
+
+        if (payload != NULL) return rresWriteAliasChunk(writer, info.id, payload);
+    }
+
+    bool result = rresBeginResourceChunk(writer, info, data.propCount, data.props);
+
+    if (result && (rawSize > 0)) result = rresWriteResourceChunkData(writer, data.raw, rawSize);
+    if (result) result = rresEndResourceChunk(writer);
+    else if (writer != NULL) writer->chunkOpen = false;
+
+    if (result && (writer->payloadBuckets != NULL)) rresAddWriterPayload(writer, hash, size);
+
+    return result;
+}
+
+// Add central directory entry
+// NOTE: Entry offset is the first resource chunk with provided id, solved on writer close,
+// in case an entry with the same fileName already exists, its id is replaced
+bool rresAddCentralDirEntry(rresWriter *writer, unsigned int id, const char *fileName)
+{
+    if ((writer == NULL) || (fileName == NULL)) return false;
+
+    size_t fileNameLength = strlen(fileName);
+
+    if (fileNameLength >= (RRES_MAX_FILENAME_SIZE - 4))
+    {
+        RRES_LOG("RRES: WARNING: [%s] Central directory entry fileName too long\n", fileName);
+        return false;
+    }
+
+    for (unsigned int i = 0; i < writer->entryCount; i++)
+    {
+        if (strcmp(writer->entries[i].fileName, fileName) == 0)
+        {
+            writer->entries[i].id = id;
+            return true;
+        }
+    }
+
+    if (writer->entryCount >= writer->entryCapacity)
+    {
+        unsigned int capacity = (writer->entryCapacity == 0)? 64 : writer->entryCapacity*2;
+        rresWriterEntry *entries = (rresWriterEntry *)RRES_REALLOC(writer->entries, capacity*sizeof(rresWriterEntry));
+
+        if (entries == NULL) return false;
+
+        writer->entries = entries;
+        writer->entryCapacity = capacity;
+    }
+
+    char *entryFileName = (char *)RRES_MALLOC(fileNameLength + 1);
+
+    if (entryFileName == NULL) return false;
+
+    memcpy(entryFileName, fileName, fileNameLength + 1);
+    writer->entries[writer->entryCount].id = id;
+    writer->entries[writer->entryCount].fileName = entryFileName;
+    writer->entryCount++;
+
+    return true;
+}
+
+// Remove resource
+// NOTE: All resource chunks with provided id are marked as dead (RRES_FLAG_DEAD written on close)
+// and central directory entries for that id are removed, file space is reclaimed by rresCompactFile()
+bool rresRemoveResource(rresWriter *writer, unsigned int id)
+{
+    if ((writer == NULL) || writer->error || writer->chunkOpen) return false;
+
+    bool removed = false;
+
+    for (unsigned int i = 0; i < writer->header.chunkCount; i++)
+    {
+        if ((writer->chunks[i].id == id) && !writer->chunks[i].dead) removed = true;
+    }
+
+    rresRemoveWriterChunks(writer, id, writer->header.chunkCount);
+
+    for (unsigned int i = 0; i < writer->entryCount; )
+    {
+        if (writer->entries[i].id == id)
+        {
+            RRES_FREE(writer->entries[i].fileName);
+            writer->entries[i] = writer->entries[writer->entryCount - 1];
+            writer->entryCount--;
+            removed = true;
+        }
+        else i++;
+    }
+
+    if (!removed) RRES_LOG("RRES: WARNING: Resource to remove not found: 0x%08x\n", id);
+
+    return removed;
+}
+
+// Write packed resource chunk
+// NOTE: Data is written as provided (already compressed/encrypted or copied from another rres file),
+// info.packedSize, info.baseSize and info.crc32 are kept, CRC32 is not computed again
+bool rresWritePackedResourceChunk(rresWriter *writer, rresResourceChunkInfo info, const void *packedData)
+{
+    if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE) && ((info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0))
+    {
+        // NOTE: Aligned data padding depends on file offset, it must be written again
+        RRES_LOG("RRES: WARNING: [ID 0x%08x] Aligned chunk data can not be written packed\n", info.id);
+        return false;
+    }
+
+    unsigned long long hash = 0;
+
+    // Look for identical packed data already written (deduplication enabled)
+    if ((writer != NULL) && !writer->error && !writer->chunkOpen && (writer->payloadBuckets != NULL))
+    {
+        hash = rresUpdateHash64(0, packedData, info.packedSize);
+
+        rresWriterPayload *payload = rresFindWriterPayload(writer, info, hash, 0, NULL, packedData, info.packedSize, false);
+
+        if (payload != NULL) return rresWriteAliasChunk(writer, info.id, payload);
+    }
+
+    // NOTE: Props are already contained in packed data
+    bool result = rresBeginWriterChunk(writer, info, 0, NULL, false);
+
+    if (result) result = rresWriteToFile(writer, packedData, info.packedSize, false);
+
+    if (result)
+    {
+        writer->info = info;
+        writer->info.nextOffset = 0;
+        result = rresEndResourceChunk(writer);
+    }
+    else if (writer != NULL) writer->chunkOpen = false;
+
+    if (result && (writer->payloadBuckets != NULL)) rresAddWriterPayload(writer, hash, info.packedSize);
+
+    return result;
+}
+
+// Set writer data deduplication
+// NOTE: Chunks written with rresWriteResourceChunk() or rresWritePackedResourceChunk() with data identical to a previous
+// chunk (same type, compression, encryption and flags) are written as alias chunks (RRES_FLAG_ALIAS) pointing to it,
+// candidates are found by content hash and verified reading back written data, so hash collisions are not an issue
+// WARNING: Readers not supporting RRES_FLAG_ALIAS can not load deduplicated resources, enable it only if required
+void rresSetWriterDeduplication(rresWriter *writer, bool enabled)
+{
+    if (writer == NULL) return;
+
+    if (enabled && (writer->payloadBuckets == NULL)) writer->payloadBuckets = (unsigned int *)RRES_CALLOC(RRES_DEDUP_BUCKET_COUNT, sizeof(unsigned int));
+    else if (!enabled)
+    {
+        RRES_FREE(writer->payloadBuckets);
+        RRES_FREE(writer->payloads);
+        writer->payloadBuckets = NULL;
+        writer->payloads = NULL;
+        writer->payloadCount = 0;
+        writer->payloadCapacity = 0;
+    }
+}
+
+// Pack resource chunks in parallel and write them in order
+// NOTE: Items are processed in batches (RRES_PACK_BATCH_PER_THREAD*threadCount) to bound memory usage,
+// every batch is packed in parallel and then written in items order, so output is deterministic
+bool rresPackResourceChunks(rresWriter *writer, rresPackItem *items, unsigned int itemCount, rresPackCallback pack, void *userData, unsigned int threadCount)
+{
+    if ((writer == NULL) || (items == NULL)) return false;
+
+    if (threadCount == 0) threadCount = 1;
+    if (threadCount > RRES_MAX_THREADS) threadCount = RRES_MAX_THREADS;
+
+    unsigned int batchSize = threadCount*RRES_PACK_BATCH_PER_THREAD;
+    bool *results = (bool *)RRES_CALLOC(batchSize, sizeof(bool));
+    bool result = (results != NULL);
+
+    for (unsigned int first = 0; result && (first < itemCount); first += batchSize)
+    {
+        unsigned int count = ((itemCount - first) < batchSize)? (itemCount - first) : batchSize;
+        rresPackBatch batch = { &items[first], results, pack, userData };
+
+        // Pack batch items in parallel
+        rresParallelFor(rresPackJob, &batch, count, threadCount);
+
+        // Write batch items in order
+        for (unsigned int i = 0; i < count; i++)
+        {
+            rresPackItem *item = &items[first + i];
+
+            if (result && !results[i])
+            {
+                RRES_LOG("RRES: WARNING: [ID 0x%08x] Resource chunk could not be packed\n", item->info.id);
+                result = false;
+            }
+
+            if (result)
+            {
+                if ((item->info.compType == RRES_COMP_NONE) && (item->info.cipherType == RRES_CIPHER_NONE)) result = rresWriteResourceChunk(writer, item->info, item->data, item->data.rawSize);
+                else result = rresWritePackedResourceChunk(writer, item->info, item->packedData);
+
+                if (result && (item->fileName != NULL)) result = rresAddCentralDirEntry(writer, item->info.id, item->fileName);
+            }
+
+            RRES_FREE(item->packedData);
+            item->packedData = NULL;
+        }
+    }
+
+    RRES_FREE(results);
+
+    return result;
+}
+
+// Run jobs on worker threads
+// NOTE: Jobs are distributed dynamically, job callback is called once for every index in [0..jobCount),
+// if RRES_SUPPORT_THREADS is not defined or threads can not be created, jobs are run on calling thread
+void rresParallelFor(rresJobCallback job, void *userData, unsigned int jobCount, unsigned int threadCount)
+{
+    rresParallelJobs jobs = { 0 };
+    jobs.job = job;
+    jobs.userData = userData;
+    jobs.jobCount = jobCount;
+
+#if defined(RRES_SUPPORT_THREADS)
+    if (threadCount > RRES_MAX_THREADS) threadCount = RRES_MAX_THREADS;
+    if (threadCount > jobCount) threadCount = jobCount;
+
+    if (threadCount > 1)
+    {
+    #if defined(_WIN32)
+        HANDLE threads[RRES_MAX_THREADS] = { 0 };
+    #else
+        pthread_t threads[RRES_MAX_THREADS];
+        bool created[RRES_MAX_THREADS] = { 0 };
+    #endif
+
+        RRES_MUTEX_INIT(&jobs.mutex);
+
+        // NOTE: Calling thread also works as a worker
+        for (unsigned int i = 1; i < threadCount; i++)
+        {
+        #if defined(_WIN32)
+            threads[i] = CreateThread(NULL, 0, rresJobWorker, &jobs, 0, NULL);
+        #else
+            created[i] = (pthread_create(&threads[i], NULL, rresJobWorker, &jobs) == 0);
+        #endif
+        }
+
+        rresJobWorker(&jobs);
+
+        for (unsigned int i = 1; i < threadCount; i++)
+        {
+        #if defined(_WIN32)
+            if (threads[i] != NULL)
+            {
+                WaitForSingleObject(threads[i], INFINITE);
+                CloseHandle(threads[i]);
+            }
+        #else
+            if (created[i]) pthread_join(threads[i], NULL);
+        #endif
+        }
+
+        RRES_MUTEX_DESTROY(&jobs.mutex);
+        return;
+    }
+#else
+    (void)threadCount;      // Jobs are always run on calling thread
+#endif
+
+    for (unsigned int i = 0; i < jobs.jobCount; i++) jobs.job(jobs.userData, i);
+}
+
+// Compact rres file into a new file
+// NOTE: Live resource chunks are copied in file order (multi-chunk resources are kept together)
+// WARNING: Output file must be different than input file
+bool rresCompactFile(const char *fileName, const char *outputFileName)
+{
+    return rresReorderFile(fileName, outputFileName, NULL, 0);
+}
+
+// Reorder rres file resource chunks in first access order
+// NOTE: Resources are written in the order they are first requested on provided traces (first trace has priority),
+// resources not accessed are written next in file order, packed data is copied (not unpacked) and aligned chunks are padded again,
+// dead resource chunks and previous central directory are discarded and a new central directory is written
+// WARNING: Output file must be different than input file
+bool rresReorderFile(const char *fileName, const char *outputFileName, rresAccessTrace **traces, unsigned int traceCount)
+{
+    if ((fileName == NULL) || (outputFileName == NULL) || (strcmp(fileName, outputFileName) == 0)) return false;
+
+    rresFileHeader header = { 0 };
+    FILE *rresFile = rresOpenFile(fileName, &header);
+
+    if (rresFile == NULL) return false;
+
+    // Read all live resource chunks info, skipping dead chunks and central directory
+    unsigned int chunkCount = 0;
+    unsigned int deadCount = 0;
+    unsigned int aliasCount = 0;
+    rresRewriteChunk *chunks = rresLoadRewriteChunks(rresFile, header, &chunkCount, &deadCount, &aliasCount);
+    bool result = (chunks != NULL);
+
+    if (result) qsort(chunks, chunkCount, sizeof(rresRewriteChunk), rresCompareRewriteChunks);
+
+    rresWriter *writer = result? rresOpenWriter(outputFileName, header.version) : NULL;
+    result = (writer != NULL);
+
+    // Keep data deduplicated if input file was deduplicated
+    if (result && (aliasCount > 0)) rresSetWriterDeduplication(writer, true);
+
+    // Write accessed resources in first access order
+    unsigned int accessedCount = 0;
+
+    for (unsigned int t = 0; result && (t < traceCount); t++)
+    {
+        if (traces[t] == NULL) continue;
+
+        for (unsigned int i = 0; result && (i < traces[t]->count); i++)
+        {
+            unsigned int first = rresFindRewriteChunk(chunks, chunkCount, traces[t]->ids[i]);
+
+            if ((first < chunkCount) && !chunks[first].written)
+            {
+                result = rresWriteRewriteChunks(writer, rresFile, chunks, chunkCount, first);
+                accessedCount++;
+            }
+        }
+    }
+
+    // Write not accessed resources in file order
+    if (result && (chunkCount > 0))
+    {
+        rresRewriteChunk **remaining = (rresRewriteChunk **)RRES_MALLOC(chunkCount*sizeof(rresRewriteChunk *));
+        unsigned int remainingCount = 0;
+
+        result = (remaining != NULL);
+
+        for (unsigned int i = 0; result && (i < chunkCount); i++)
+        {
+            // NOTE: Only first chunk of every resource is registered, chunks are sorted by id and offset
+            if (!chunks[i].written && ((i == 0) || (chunks[i - 1].info.id != chunks[i].info.id))) remaining[remainingCount++] = &chunks[i];
+        }
+
+        if (result) qsort(remaining, remainingCount, sizeof(rresRewriteChunk *), rresCompareRewriteOffsets);
+
+        for (unsigned int i = 0; result && (i < remainingCount); i++) result = rresWriteRewriteChunks(writer, rresFile, chunks, chunkCount, (unsigned int)(remaining[i] - chunks));
+
+        RRES_FREE(remaining);
+    }
+
+    fclose(rresFile);
+    RRES_FREE(chunks);
+
+    // Write central directory again, entries offsets are solved with output file chunks
+    if (result && (header.cdOffset > 0))
+    {
+        rresCentralDir dir = rresLoadCentralDirectory(fileName);
+
+        for (unsigned int i = 0; result && (i < dir.count); i++) result = rresAddCentralDirEntry(writer, dir.entries[i].id, dir.entries[i].fileName);
+
+        rresUnloadCentralDirectory(dir);
+    }
+
+    if (writer != NULL)
+    {
+        if (!result) writer->error = true;
+        result = rresCloseWriter(writer);
+    }
+
+    if (result) RRES_LOG("RRES: INFO: [%s] rres file rewritten: %u resources reordered, %u dead resource chunks discarded\n", fileName, accessedCount, deadCount);
+    else RRES_LOG("RRES: WARNING: [%s] rres file could not be rewritten\n", fileName);
+
+    return result;
+}
+
+// Create patch with resource chunks changed from base to target file
+// NOTE: Target resource chunks are compared with base ones by id and CRC32 (also sizes, type, compression, encryption and flags),
+// changed chunks are copied into patch file and a patch index (PTCH) with target resource chunks sources is written,
+// patch central directory contains target file entries
+bool rresCreatePatch(const char *baseFileName, const char *targetFileName, const char *patchFileName)
+{
+    if ((baseFileName == NULL) || (targetFileName == NULL) || (patchFileName == NULL)) return false;
+
+    rresFileHeader baseHeader = { 0 };
+    rresFileHeader targetHeader = { 0 };
+    unsigned int baseCount = 0, targetCount = 0, deadCount = 0, aliasCount = 0;
+    rresRewriteChunk *baseChunks = NULL;
+    rresRewriteChunk *targetChunks = NULL;
+    unsigned int baseChecksum = 0;
+
+    FILE *baseFile = rresOpenFile(baseFileName, &baseHeader);
+    FILE *targetFile = rresOpenFile(targetFileName, &targetHeader);
+
+    if ((baseFile != NULL) && (targetFile != NULL))
+    {
+        baseChunks = rresLoadRewriteChunks(baseFile, baseHeader, &baseCount, &deadCount, &aliasCount);
+        targetChunks = rresLoadRewriteChunks(targetFile, targetHeader, &targetCount, &deadCount, &aliasCount);
+    }
+
+    bool result = (baseChunks != NULL) && (targetChunks != NULL);
+
+    if (result)
+    {
+        baseChecksum = rresComputeRewriteChecksum(baseChunks, baseCount);
+        qsort(baseChunks, baseCount, sizeof(rresRewriteChunk), rresCompareRewriteChunks);
+    }
+
+    // Patch entries: id (4 bytes), source (4 bytes), offset (8 bytes)
+    unsigned char *entries = result? (unsigned char *)RRES_CALLOC((targetCount > 0)? targetCount : 1, 16) : NULL;
+    rresWriter *writer = (entries != NULL)? rresOpenWriter(patchFileName, targetHeader.version) : NULL;
+    unsigned int changedCount = 0;
+
+    result = (writer != NULL);
+
+    // NOTE: Deduplicated target changed chunks are also deduplicated in patch file
+    if (result && (aliasCount > 0)) rresSetWriterDeduplication(writer, true);
+
+    for (unsigned int i = 0; result && (i < targetCount); i++)
+    {
+        rresResourceChunkInfo info = targetChunks[i].info;
+        unsigned int source = 1;
+        unsigned long long offset = 0;
+
+        // Look for an identical resource chunk in base file
+        for (unsigned int k = rresFindRewriteChunk(baseChunks, baseCount, info.id); (k < baseCount) && (baseChunks[k].info.id == info.id); k++)
+        {
+            rresResourceChunkInfo baseInfo = baseChunks[k].info;
+
+            if ((baseInfo.crc32 == info.crc32) && (baseInfo.packedSize == info.packedSize) && (baseInfo.baseSize == info.baseSize) &&
+                (memcmp(baseInfo.type, info.type, 4) == 0) && (baseInfo.compType == info.compType) &&
+                (baseInfo.cipherType == info.cipherType) && (baseInfo.flags == info.flags))
+            {
+                source = 0;
+                offset = baseChunks[k].offset - rresGetResourceChunkInfoSize(baseHeader.version);
+                break;
+            }
+        }
+
+        // Copy changed resource chunk into patch file
+        if (source == 1)
+        {
+            result = rresCopyResourceChunk(writer, targetFile, info, targetChunks[i].offset);
+            if (!result) break;
+
+            // NOTE: Entry always refers to the chunk containing the data, never an alias chunk
+            rresWriterChunk *chunk = &writer->chunks[writer->header.chunkCount - 1];
+            offset = (chunk->aliasOffset != 0)? chunk->aliasOffset : chunk->offset;
+            changedCount++;
+        }
+
+        memcpy(entries + i*16, &info.id, 4);
+        memcpy(entries + i*16 + 4, &source, 4);
+        memcpy(entries + i*16 + 8, &offset, 8);
+    }
+
+    // Write patch index
+    if (result)
+    {
+        rresResourceChunkInfo info = { 0 };
+        info.type[0] = 'P';
+        info.type[1] = 'T';
+        info.type[2] = 'C';
+        info.type[3] = 'H';
+
+        unsigned int props[4] = { targetCount, targetHeader.version, baseChecksum, (aliasCount > 0)? 1u : 0u };
+        rresResourceChunkData chunkData = { 0 };
+        chunkData.propCount = 4;
+        chunkData.props = props;
+        chunkData.raw = entries;
+
+        result = rresWriteResourceChunk(writer, info, chunkData, (unsigned long long)targetCount*16);
+    }
+
+    if (targetFile != NULL) fclose(targetFile);
+    if (baseFile != NULL) fclose(baseFile);
+    RRES_FREE(entries);
+    RRES_FREE(targetChunks);
+    RRES_FREE(baseChunks);
+
+    // Write target central directory entries
+    if (result && (targetHeader.cdOffset > 0))
+    {
+        rresCentralDir dir = rresLoadCentralDirectory(targetFileName);
+
+        for (unsigned int i = 0; result && (i < dir.count); i++) result = rresAddCentralDirEntry(writer, dir.entries[i].id, dir.entries[i].fileName);
+
+        rresUnloadCentralDirectory(dir);
+    }
+
+    if (writer != NULL)
+    {
+        if (!result) writer->error = true;
+        result = rresCloseWriter(writer);
+    }
+
+    if (result) RRES_LOG("RRES: INFO: [%s] Patch created: %u of %u resource chunks changed\n", patchFileName, changedCount, targetCount);
+    else RRES_LOG("RRES: WARNING: [%s] Patch could not be created\n", patchFileName);
+
+    return result;
+}
+
+// Apply patch to base file
+// NOTE: Target file is rebuilt following patch index, resource chunks are copied from base or patch file
+// in blocks (bounded memory), base file is verified with the checksum stored in patch index
+// WARNING: Output file must be different than base and patch files
+bool rresApplyPatch(const char *baseFileName, const char *patchFileName, const char *outputFileName)
+{
+    if ((baseFileName == NULL) || (patchFileName == NULL) || (outputFileName == NULL) ||
+        (strcmp(baseFileName, outputFileName) == 0) || (strcmp(patchFileName, outputFileName) == 0)) return false;
+
+    rresFileHeader baseHeader = { 0 };
+    rresFileHeader patchHeader = { 0 };
+    rresResourceChunkData index = { 0 };
+
+    FILE *baseFile = rresOpenFile(baseFileName, &baseHeader);
+    FILE *patchFile = rresOpenFile(patchFileName, &patchHeader);
+    bool result = (baseFile != NULL) && (patchFile != NULL);
+
+    // Load patch index (PTCH)
+    for (unsigned int i = 0; result && (i < patchHeader.chunkCount); i++)
+    {
+        rresResourceChunkInfo info = { 0 };
+        result = rresReadResourceChunkInfo(patchFile, patchHeader.version, &info);
+
+        if (result && (rresGetDataType(info.type) == RRES_DATA_PATCH) && ((info.flags & RRES_FLAG_DEAD) == 0))
+        {
+            void *data = RRES_MALLOC((size_t)info.packedSize);
+            result = (data != NULL) && (fread(data, 1, (size_t)info.packedSize, patchFile) == (size_t)info.packedSize);
+
+            if (result)
+            {
+                rresUnloadResourceChunkData(index);
+                index = rresLoadResourceChunkData(info, data);
+
+                // NOTE: Patch index is never compressed/encrypted, entries size can be verified
+                if ((index.propCount < 4) || (index.raw == NULL) ||
+                    ((info.packedSize - (1 + index.propCount)*sizeof(unsigned int)) != (unsigned long long)index.props[0]*16))
+                {
+                    RRES_LOG("RRES: WARNING: [%s] Patch index not valid\n", patchFileName);
+                    result = false;
+                }
+            }
+
+            RRES_FREE(data);
+        }
+        else if (result) result = (RRES_FSEEK(patchFile, info.packedSize, SEEK_CUR) == 0);
+    }
+
+    if (result && (index.raw == NULL))
+    {
+        RRES_LOG("RRES: WARNING: [%s] Patch index not found\n", patchFileName);
+        result = false;
+    }
+
+    // Verify base file is the one used to create the patch
+    if (result)
+    {
+        unsigned int baseCount = 0, deadCount = 0, aliasCount = 0;
+        rresRewriteChunk *baseChunks = rresLoadRewriteChunks(baseFile, baseHeader, &baseCount, &deadCount, &aliasCount);
+
+        if ((baseChunks == NULL) || (rresComputeRewriteChecksum(baseChunks, baseCount) != index.props[2]))
+        {
+            RRES_LOG("RRES: WARNING: [%s] Base file does not match patch base file\n", baseFileName);
+            result = false;
+        }
+
+        RRES_FREE(baseChunks);
+    }
+
+    rresWriter *writer = result? rresOpenWriter(outputFileName, (unsigned short)index.props[1]) : NULL;
+    result = (writer != NULL);
+
+    if (result && ((index.props[3] & 1) != 0)) rresSetWriterDeduplication(writer, true);
+
+    // Rebuild target resource chunks, in target file order
+    for (unsigned int i = 0; result && (i < index.props[0]); i++)
+    {
+        unsigned int id = 0;
+        unsigned int source = 0;
+        unsigned long long offset = 0;
+
+        memcpy(&id, (unsigned char *)index.raw + i*16, 4);
+        memcpy(&source, (unsigned char *)index.raw + i*16 + 4, 4);
+        memcpy(&offset, (unsigned char *)index.raw + i*16 + 8, 8);
+
+        FILE *rresFile = (source == 0)? baseFile : patchFile;
+        unsigned short version = (source == 0)? baseHeader.version : patchHeader.version;
+        rresResourceChunkInfo info = { 0 };
+
+        result = (RRES_FSEEK(rresFile, offset, SEEK_SET) == 0) && rresReadResourceChunkInfo(rresFile, version, &info) && ((info.flags & RRES_FLAG_ALIAS) == 0);
+
+        if (result)
+        {
+            // NOTE: Entry chunk could be the aliased chunk of a different id
+            info.id = id;
+            result = rresCopyResourceChunk(writer, rresFile, info, (unsigned long long)RRES_FTELL(rresFile));
+        }
+    }
+
+    if (baseFile != NULL) fclose(baseFile);
+    if (patchFile != NULL) fclose(patchFile);
+
+    // Write target central directory entries, stored in patch central directory
+    if (result && (patchHeader.cdOffset > 0))
+    {
+        rresCentralDir dir = rresLoadCentralDirectory(patchFileName);
+
+        for (unsigned int i = 0; result && (i < dir.count); i++) result = rresAddCentralDirEntry(writer, dir.entries[i].id, dir.entries[i].fileName);
+
+        rresUnloadCentralDirectory(dir);
+    }
+
+    if (writer != NULL)
+    {
+        if (!result) writer->error = true;
+        result = rresCloseWriter(writer);
+    }
+
+    if (result) RRES_LOG("RRES: INFO: [%s] Patch applied: %u resource chunks\n", outputFileName, index.props[0]);
+    else RRES_LOG("RRES: WARNING: [%s] Patch could not be applied\n", patchFileName);
+
+    rresUnloadResourceChunkData(index);
+
+    return result;
+}
+
+// Load access trace from file
+// NOTE: Trace file is a text file with one resource id per line (hexadecimal),
+// multiple traces can be concatenated in the same file, NULL fileName loads an empty trace
+rresAccessTrace *rresLoadAccessTrace(const char *fileName)
+{
+    rresAccessTrace *trace = (rresAccessTrace *)RRES_CALLOC(1, sizeof(rresAccessTrace));
+
+    if (trace == NULL) return NULL;
+
+    RRES_MUTEX_INIT(&trace->mutex);
+
+    if (fileName != NULL)
+    {
+        FILE *traceFile = fopen(fileName, "rt");
+
+        if (traceFile == NULL)
+        {
+            RRES_LOG("RRES: WARNING: [%s] Access trace file could not be opened\n", fileName);
+            rresUnloadAccessTrace(trace);
+            return NULL;
+        }
+
+        unsigned int id = 0;
+
+        while (fscanf(traceFile, "%x", &id) == 1)
+        {
+            if (trace->count >= trace->capacity)
+            {
+                unsigned int capacity = (trace->capacity == 0)? 256 : trace->capacity*2;
+                unsigned int *ids = (unsigned int *)RRES_REALLOC(trace->ids, capacity*sizeof(unsigned int));
+
+                if (ids == NULL) break;
+
+                trace->ids = ids;
+                trace->capacity = capacity;
+            }
+
+            trace->ids[trace->count++] = id;
+        }
+
+        fclose(traceFile);
+
+        RRES_LOG("RRES: INFO: [%s] Access trace loaded: %u requests\n", fileName, trace->count);
+    }
+
+    return trace;
+}
+
+// Unload access trace
+// NOTE: Access trace is not recorded anymore if it was the current one
+void rresUnloadAccessTrace(rresAccessTrace *trace)
+{
+    if (trace != NULL)
+    {
+        if (accessTrace == trace) accessTrace = NULL;
+
+        RRES_MUTEX_DESTROY(&trace->mutex);
+        RRES_FREE(trace->ids);
+        RRES_FREE(trace);
+    }
+}
+
+// Save access trace to file
+bool rresSaveAccessTrace(rresAccessTrace *trace, const char *fileName)
+{
+    if ((trace == NULL) || (fileName == NULL)) return false;
+
+    FILE *traceFile = fopen(fileName, "wt");
+
+    if (traceFile == NULL)
+    {
+        RRES_LOG("RRES: WARNING: [%s] Access trace file could not be opened for writing\n", fileName);
+        return false;
+    }
+
+    bool result = true;
+
+    RRES_MUTEX_LOCK(&trace->mutex);
+    for (unsigned int i = 0; result && (i < trace->count); i++) result = (fprintf(traceFile, "0x%08x\n", trace->ids[i]) > 0);
+    RRES_MUTEX_UNLOCK(&trace->mutex);
+
+    if (fclose(traceFile) != 0) result = false;
+
+    if (result) RRES_LOG("RRES: INFO: [%s] Access trace saved: %u requests\n", fileName, trace->count);
+
+    return result;
+}
+
+// Set access trace to record loaders requests
+// WARNING: It should not be called while other threads are loading resources
+void rresSetAccessTrace(rresAccessTrace *trace)
+{
+    accessTrace = trace;
+}
+
+// Load resource chunk info for provided id
+RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, int rresId)
+{
+    rresResourceChunkInfo info = { 0 };
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile != NULL)
+    {
+        rresFileHeader header = { 0 };
+
+        // Verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
+        {
+            // Try to find provided resource chunk id and read info chunk
+            for (unsigned int i = 0; i < header.chunkCount; i++)
+            {
+                // Read resource chunk info
+                rresReadResourceChunkInfo(rresFile, header.version, &info);
+
+                if ((info.id == rresId) && ((info.flags & RRES_FLAG_DEAD) == 0))
+                {
+                    rresResolveAliasChunk(rresFile, header.version, &info);
+
+                    // TODO: Jump to next resource chunk for provided id
+                    //if (info.nextOffset > 0) fseek(rresFile, info.nextOffset, SEEK_SET);
+
+                    break; // If requested rresId is found, we return the read rresResourceChunkInfo
+                }
+                else RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR); // Jump to next resource
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        fclose(rresFile);
+    }
+
+    return info;
+}
+
+// Load all resource chunks info
+RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName, unsigned int *chunkCount)
+{
+    rresResourceChunkInfo *infos = { 0 };
+    unsigned int count = 0;
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile != NULL)
+    {
+        rresFileHeader header = { 0 };
+
+        // Verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
+        {
+            // Load all resource chunks info
+            infos = (rresResourceChunkInfo *)RRES_CALLOC(header.chunkCount, sizeof(rresResourceChunkInfo));
+            count = header.chunkCount;
+
+            for (unsigned int i = 0; i < count; i++)
+            {
+                rresReadResourceChunkInfo(rresFile, header.version, &infos[i]); // Read resource chunk info
+
+                if (infos[i].nextOffset > 0) RRES_FSEEK(rresFile, infos[i].nextOffset, SEEK_SET); // Jump to next resource
+                else RRES_FSEEK(rresFile, infos[i].packedSize, SEEK_CUR); // Jump to next resource
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        fclose(rresFile);
+    }
+
+    *chunkCount = count;
+    return infos;
+}
+
+// Load central directory data
+rresCentralDir rresLoadCentralDirectory(const char *fileName)
+{
+    rresCentralDir dir = { 0 };
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile != NULL)
+    {
+        rresFileHeader header = { 0 };
+
+        // Verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
+        {
+            // Check if there is a Central Directory available
+            if (header.cdOffset == 0) RRES_LOG("RRES: WARNING: CDIR: No central directory found\n");
+            else
+            {
+                rresResourceChunkInfo info = { 0 };
+
+                RRES_FSEEK(rresFile, header.cdOffset, SEEK_CUR); // Move to central directory position
+                rresReadResourceChunkInfo(rresFile, header.version, &info); // Read resource info
+
+                // Verify resource type is CDIR
+                if ((info.type[0] == 'C') && (info.type[1] == 'D') && (info.type[2] == 'I') && (info.type[3] == 'R'))
+                {
+                    RRES_LOG("RRES: CDIR: Central Directory found at offset: 0x%08llx\n", header.cdOffset);
+
+                    void *data = RRES_MALLOC(info.packedSize);
+                    fread(data, info.packedSize, 1, rresFile);
+
+                    // Load resource chunk data (central directory), data is uncompressed/unencrypted by default
+                    rresResourceChunkData chunkData = rresLoadResourceChunkData(info, data);
+                    RRES_FREE(data);
+
+                    dir.count = chunkData.props[0];     // File entries count
+
+                    RRES_LOG("RRES: CDIR: Central Directory file entries count: %u\n", dir.count);
+
+                    unsigned char *ptr = (unsigned char *)chunkData.raw;
+                    dir.entries = (rresDirEntry *)RRES_CALLOC(dir.count, sizeof(rresDirEntry));
+
+                    for (unsigned int i = 0; i < dir.count; i++)
+                    {
+                        if (header.version == RRES_FILE_VERSION_LARGE)
+                        {
+                            memcpy(&dir.entries[i].id, ptr, 4);                 // Resource id
+                            // NOTE: There is a reserved integer value before offset
+                            memcpy(&dir.entries[i].offset, ptr + 8, 8);         // Resource offset in file (64bit)
+                            memcpy(&dir.entries[i].fileNameSize, ptr + 16, 4);  // Resource fileName size
+                            ptr += 20;
+                        }
+                        else
+                        {
+                            dir.entries[i].id = ((int *)ptr)[0];                // Resource id
+                            dir.entries[i].offset = ((unsigned int *)ptr)[1];   // Resource offset in file
+                            // NOTE: There is a reserved integer value before fileNameSize
+                            dir.entries[i].fileNameSize = ((int *)ptr)[3];      // Resource fileName size
+                            ptr += 16;
+                        }
+
+                        // Resource fileName, NULL terminated and 0-padded to 4-byte,
+                        // fileNameSize considers NULL and padding
+                        memcpy(dir.entries[i].fileName, ptr, dir.entries[i].fileNameSize);
+
+                        ptr += dir.entries[i].fileNameSize;     // Move pointer for next entry
+                    }
+
+                    rresUnloadResourceChunkData(chunkData);
+                }
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        fclose(rresFile);
+    }
+
+    return dir;
+}
+
+// Unload central directory data
+void rresUnloadCentralDirectory(rresCentralDir dir)
+{
+    RRES_FREE(dir.entries);
+}
+
+// Load archive cipher key derivation record chunk (KDFR)
+// NOTE: Record is written by the packer as a header chunk, first one found is loaded,
+// it's up to the user library to derive the archive cipher key from it (i.e. rres-raylib: LoadArchiveCipherKey())
+rresResourceChunk rresLoadKeyDerivationChunk(const char *fileName)
+{
+    rresResourceChunk chunk = rresLoadHeaderChunk(fileName, RRES_DATA_KEY_DERIVATION);
+
+    if (chunk.data.raw == NULL) RRES_LOG("RRES: WARNING: KDFR: No key derivation record found\n");
+
+    return chunk;
+}
+
+// Load archive compression dictionary chunk (DICT)
+// NOTE: Dictionary is written by the packer as a header chunk, first one found is loaded,
+// it's up to the user library to decompress data with it (i.e. rres-raylib: LoadArchiveDictionary())
+rresResourceChunk rresLoadDictionaryChunk(const char *fileName)
+{
+    rresResourceChunk chunk = rresLoadHeaderChunk(fileName, RRES_DATA_DICTIONARY);
+
+    if (chunk.data.raw == NULL) RRES_LOG("RRES: WARNING: DICT: No compression dictionary found\n");
+
+    return chunk;
+}
+
+// Get rresResourceDataType from FourCC code
+// NOTE: Function expects to receive a char[4] array
+unsigned int rresGetDataType(const unsigned char *fourCC)
+{
+    unsigned int type = 0;
+
+    if (fourCC != NULL)
+    {
+        if (memcmp(fourCC, "NULL", 4) == 0) type = RRES_DATA_NULL;              // Reserved for empty chunks, no props/data
+        else if (memcmp(fourCC, "RAWD", 4) == 0) type = RRES_DATA_RAW;          // Raw file data, input file is not processed, just packed as is
+        else if (memcmp(fourCC, "TEXT", 4) == 0) type = RRES_DATA_TEXT;         // Text file data, byte data extracted from text file
+        else if (memcmp(fourCC, "IMGE", 4) == 0) type = RRES_DATA_IMAGE;        // Image file data, pixel data extracted from image file
+        else if (memcmp(fourCC, "WAVE", 4) == 0) type = RRES_DATA_WAVE;         // Audio file data, samples data extracted from audio file
+        else if (memcmp(fourCC, "VRTX", 4) == 0) type = RRES_DATA_VERTEX;       // Vertex file data, extracted from a mesh file
+        else if (memcmp(fourCC, "FNTG", 4) == 0) type = RRES_DATA_FONT_GLYPHS;  // Font glyphs info, generated from an input font file
+        else if (memcmp(fourCC, "LINK", 4) == 0) type = RRES_DATA_LINK;         // External linked file, filepath as provided on file input
+        else if (memcmp(fourCC, "CDIR", 4) == 0) type = RRES_DATA_DIRECTORY;    // Central directory for input files relation to resource chunks
+        else if (memcmp(fourCC, "PTCH", 4) == 0) type = RRES_DATA_PATCH;        // Patch index to rebuild a target file from a base file
+        else if (memcmp(fourCC, "KDFR", 4) == 0) type = RRES_DATA_KEY_DERIVATION; // Archive cipher key derivation record
+        else if (memcmp(fourCC, "DICT", 4) == 0) type = RRES_DATA_DICTIONARY;   // Archive compression dictionary
+    }
+
+    /*
+    // Assign type (unsigned int) FourCC (char[4])
+    if ((fourCC[0] == 'N') && (fourCC[1] == 'U') && (fourCC[2] == 'L') && (fourCC[3] == 'L')) type = RRES_DATA_NULL;             // NULL
+    if ((fourCC[0] == 'R') && (fourCC[1] == 'A') && (fourCC[2] == 'W') && (fourCC[3] == 'D')) type = RRES_DATA_RAW;              // RAWD
+    else if ((fourCC[0] == 'T') && (fourCC[1] == 'E') && (fourCC[2] == 'X') && (fourCC[3] == 'T')) type = RRES_DATA_TEXT;        // TEXT
+    else if ((fourCC[0] == 'I') && (fourCC[1] == 'M') && (fourCC[2] == 'G') && (fourCC[3] == 'E')) type = RRES_DATA_IMAGE;       // IMGE
+    else if ((fourCC[0] == 'W') && (fourCC[1] == 'A') && (fourCC[2] == 'V') && (fourCC[3] == 'E')) type = RRES_DATA_WAVE;        // WAVE
+    else if ((fourCC[0] == 'V') && (fourCC[1] == 'R') && (fourCC[2] == 'T') && (fourCC[3] == 'X')) type = RRES_DATA_VERTEX;      // VRTX
+    else if ((fourCC[0] == 'F') && (fourCC[1] == 'N') && (fourCC[2] == 'T') && (fourCC[3] == 'G')) type = RRES_DATA_FONT_GLYPHS; // FNTG
+    else if ((fourCC[0] == 'L') && (fourCC[1] == 'I') && (fourCC[2] == 'N') && (fourCC[3] == 'K')) type = RRES_DATA_LINK;        // LINK
+    else if ((fourCC[0] == 'C') && (fourCC[1] == 'D') && (fourCC[2] == 'I') && (fourCC[3] == 'R')) type = RRES_DATA_DIRECTORY;   // CDIR
+    */
+
+    return type;
+}
+
+// Get resource identifier from filename
+// WARNING: It requires the central directory previously loaded
+int rresGetResourceId(rresCentralDir dir, const char *fileName)
+{
+    int id = 0;
+
+    for (unsigned int i = 0, len = 0; i < dir.count; i++)
+    {
+        len = (unsigned int)strlen(fileName);
+
+        // NOTE: entries[i].fileName is NULL terminated and padded to 4-bytes
+        if (strncmp((const char *)dir.entries[i].fileName, fileName, len) == 0)
+        {
+            id = dir.entries[i].id;
+            break;
+        }
+    }
+
+    return id;
+}
+
+// Get chunk data alignment (bytes) from flags
+unsigned int rresGetDataAlignment(unsigned short flags)
+{
+    return (1u << (flags & RRES_FLAG_ALIGNMENT_MASK));
+}
+
+// Set chunk data alignment (bytes) into flags
+// NOTE: Alignment is rounded-up to a power of two, 1 or 0 removes alignment
+unsigned short rresSetDataAlignment(unsigned short flags, unsigned int alignment)
+{
+    unsigned short alignLog2 = 0;
+
+    while ((alignLog2 < RRES_FLAG_ALIGNMENT_MASK) && ((1u << alignLog2) < alignment)) alignLog2++;
+
+    return (unsigned short)((flags & ~RRES_FLAG_ALIGNMENT_MASK) | alignLog2);
+}
+
+// Get padding size required to align chunk data
+// NOTE: Padding is placed after props[] and padding size, so data starts at:
+// dataOffset + sizeof(int) + propCount*sizeof(int) + sizeof(int) + padding
+unsigned int rresGetDataPaddingSize(unsigned long long dataOffset, unsigned int propCount, unsigned short flags)
+{
+    unsigned int padding = 0;
+
+    if ((flags & RRES_FLAG_ALIGNMENT_MASK) != 0)
+    {
+        unsigned long long alignment = rresGetDataAlignment(flags);
+        unsigned long long offset = dataOffset + sizeof(int) + propCount*sizeof(int) + sizeof(int);
+
+        padding = (unsigned int)((alignment - (offset%alignment))%alignment);
+    }
+
+    return padding;
+}
+
+// Load chunk data from unpacked data: propCount + props[] + (padding size + padding) + data
+// NOTE: Props and raw data are copied into one buffer, raw data aligned to RRES_DATA_ALIGNMENT or chunk alignment if bigger,
+// raw data is placed at buffer start when allocation is already aligned, so users can adopt it (chunk.data.raw == chunk.data.buffer)
+// WARNING: Buffer layout is not the unpacked data layout: raw data first, then props[] (4 bytes aligned), header padding is not kept,
+// buffers returned by rresLoadResourceChunkDataInPlace() keep the unpacked data layout (see rresAllocUnpackedData())
+rresResourceChunkData rresLoadResourceChunkDataFromMemory(const void *data, unsigned long long size, unsigned short flags)
+{
+    rresResourceChunkData chunkData = { 0 };
+    unsigned int headerSize = rresGetDataHeaderSize(data, size, flags);
+
+    if (headerSize == 0)
+    {
+        if (data != NULL) RRES_LOG("RRES: WARNING: Chunk data properties exceed data size, data can be corrupted\n");
+        return chunkData;
+    }
+
+    unsigned int propCount = 0;
+    memcpy(&propCount, data, sizeof(int));
+
+    // NOTE: Props are placed just after raw data (4 bytes aligned), header padding is not kept
+    unsigned int propsSize = propCount*sizeof(unsigned int);
+    unsigned long long rawSize = size - headerSize;
+    unsigned long long propsOffset = (rawSize + sizeof(int) - 1) & ~(unsigned long long)(sizeof(int) - 1);
+    void *buffer = NULL;
+    unsigned char *unpackedData = (unsigned char *)rresAllocUnpackedData(propsOffset + propsSize, 0, flags, &buffer);
+
+    if (unpackedData != NULL)
+    {
+        memcpy(unpackedData, (const unsigned char *)data + headerSize, (size_t)rawSize);
+        memcpy(unpackedData + propsOffset, (const unsigned char *)data + sizeof(int), propsSize);
+
+        chunkData.propCount = propCount;
+        chunkData.props = (propCount > 0)? (unsigned int *)(unpackedData + propsOffset) : NULL;
+        chunkData.raw = unpackedData;
+        chunkData.buffer = buffer;
+        chunkData.rawSize = rawSize;
+    }
+
+    return chunkData;
+}
+
+// Load chunk data pointing into unpacked data: propCount + props[] + (padding size + padding) + data
+// NOTE: Unpacked data must be contained in buffer (freed on chunk data unload), no data is copied
+// if raw data is aligned as required (see rresAllocUnpackedData()), otherwise it is copied and buffer freed
+rresResourceChunkData rresLoadResourceChunkDataInPlace(void *buffer, void *data, unsigned long long size, unsigned short flags)
+{
+    rresResourceChunkData chunkData = { 0 };
+    unsigned int headerSize = rresGetDataHeaderSize(data, size, flags);
+
+    uintptr_t alignment = RRES_DATA_ALIGNMENT;
+    if (rresGetDataAlignment(flags) > alignment) alignment = rresGetDataAlignment(flags);
+
+    if ((headerSize > 0) && (((uintptr_t)data & (sizeof(int) - 1)) == 0) && ((((uintptr_t)data + headerSize) & (alignment - 1)) == 0))
+    {
+        memcpy(&chunkData.propCount, data, sizeof(int));
+
+        chunkData.props = (chunkData.propCount > 0)? (unsigned int *)((unsigned char *)data + sizeof(int)) : NULL;
+        chunkData.raw = (unsigned char *)data + headerSize;
+        chunkData.buffer = buffer;
+        chunkData.rawSize = size - headerSize;
+    }
+    else
+    {
+        chunkData = rresLoadResourceChunkDataFromMemory(data, size, flags);
+        RRES_FREE(buffer);
+    }
+
+    return chunkData;
+}
+
+// Get unpacked data header size: propCount + props[] (+ padding size + padding)
+// NOTE: Returns 0 if header exceeds provided data size
+unsigned int rresGetDataHeaderSize(const void *data, unsigned long long size, unsigned short flags)
+{
+    unsigned long long headerSize = sizeof(int);
+
+    if ((data == NULL) || (size < headerSize)) return 0;
+
+    unsigned int propCount = 0;
+    memcpy(&propCount, data, sizeof(int));
+    headerSize += (unsigned long long)propCount*sizeof(int);
+
+    // Add padding if data is aligned
+    if ((flags & RRES_FLAG_ALIGNMENT_MASK) != 0)
+    {
+        unsigned int padding = 0;
+
+        if (size < (headerSize + sizeof(int))) return 0;
+
+        memcpy(&padding, (const unsigned char *)data + headerSize, sizeof(int));
+        headerSize += (sizeof(int) + (unsigned long long)padding);
+    }
+
+    return (headerSize <= size)? (unsigned int)headerSize : 0;
+}
+
+// Allocate memory for unpacked data
+// NOTE: Returned pointer is placed into allocated buffer so raw data (after headerSize bytes) is aligned
+// to RRES_DATA_ALIGNMENT or chunk alignment if bigger, buffer must be freed with RRES_FREE()
+void *rresAllocUnpackedData(unsigned long long size, unsigned int headerSize, unsigned short flags, void **buffer)
+{
+    uintptr_t alignment = RRES_DATA_ALIGNMENT;
+    if (rresGetDataAlignment(flags) > alignment) alignment = rresGetDataAlignment(flags);
+
+    unsigned char *data = NULL;
+    *buffer = RRES_MALLOC((size_t)size + alignment - 1);
+
+    if (*buffer != NULL)
+    {
+        // Move data start so data + headerSize is aligned
+        uintptr_t rawStart = ((uintptr_t)*buffer + headerSize + (alignment - 1)) & ~(alignment - 1);
+        data = (unsigned char *)(rawStart - headerSize);
+    }
+
+    return data;
+}
+
+// Unload chunk data (props and raw data)
+// NOTE: It's the only valid way to free chunk data, ownership of props and raw depends on buffer
+void rresUnloadResourceChunkData(rresResourceChunkData data)
+{
+    // NOTE: If data is unpacked into buffer, props and raw point into it
+    if (data.buffer != NULL) RRES_FREE(data.buffer);
+    else
+    {
+        RRES_FREE(data.props);  // Resource chunk properties
+        RRES_FREE(data.raw);    // Resource chunk raw data
+    }
+}
+
+// Compute CRC32 hash
+// NOTE: CRC32 is used as rres id, generated from original filename
+unsigned int rresComputeCRC32(unsigned char *data, int len)
+{
+    return rresUpdateCRC32(0, data, (len > 0)? (unsigned long long)len : 0);
+}
+
+// Get file header size in file for provided version
+unsigned int rresGetFileHeaderSize(unsigned short version)
+{
+    return (version == RRES_FILE_VERSION_LARGE)? 24 : 16;
+}
+
+// Get resource chunk info size in file for provided version
+unsigned int rresGetResourceChunkInfoSize(unsigned short version)
+{
+    return (version == RRES_FILE_VERSION_LARGE)? 48 : 32;
+}
+
+// Serialize file header into file layout
+// NOTE: Layout is defined by header.version, values not fitting version 100 fields are truncated
+unsigned int rresSerializeFileHeader(rresFileHeader header, unsigned char *buffer)
+{
+    memset(buffer, 0, rresGetFileHeaderSize(header.version));
+    memcpy(buffer, header.id, 4);
+    memcpy(buffer + 4, &header.version, 2);
+
+    if (header.version == RRES_FILE_VERSION_LARGE)
+    {
+        memcpy(buffer + 8, &header.chunkCount, 4);
+        memcpy(buffer + 12, &header.reserved, 4);
+        memcpy(buffer + 16, &header.cdOffset, 8);
+    }
+    else
+    {
+        unsigned short chunkCount = (unsigned short)header.chunkCount;
+        unsigned int cdOffset = (unsigned int)header.cdOffset;
+
+        memcpy(buffer + 6, &chunkCount, 2);
+        memcpy(buffer + 8, &cdOffset, 4);
+        memcpy(buffer + 12, &header.reserved, 4);
+    }
+
+    return rresGetFileHeaderSize(header.version);
+}
+
+// Serialize resource chunk info into file layout
+// NOTE: Values not fitting version 100 fields are truncated
+unsigned int rresSerializeResourceChunkInfo(rresResourceChunkInfo info, unsigned short version, unsigned char *buffer)
+{
+    memset(buffer, 0, rresGetResourceChunkInfoSize(version));
+    memcpy(buffer, info.type, 4);
+    memcpy(buffer + 4, &info.id, 4);
+    buffer[8] = info.compType;
+    buffer[9] = info.cipherType;
+    memcpy(buffer + 10, &info.flags, 2);
+
+    if (version == RRES_FILE_VERSION_LARGE)
+    {
+        memcpy(buffer + 12, &info.crc32, 4);
+        memcpy(buffer + 16, &info.packedSize, 8);
+        memcpy(buffer + 24, &info.baseSize, 8);
+        memcpy(buffer + 32, &info.nextOffset, 8);
+        memcpy(buffer + 40, &info.reserved, 4);
+    }
+    else
+    {
+        unsigned int sizes[3] = { (unsigned int)info.packedSize, (unsigned int)info.baseSize, (unsigned int)info.nextOffset };
+
+        memcpy(buffer + 12, sizes, 12);
+        memcpy(buffer + 24, &info.reserved, 4);
+        memcpy(buffer + 28, &info.crc32, 4);
+    }
+
+    return rresGetResourceChunkInfoSize(version);
+}
+
+// Set password to be used on data decryption
+void rresSetCipherPassword(const char *pass)
+{
+    password = pass;
+}
+
+// Get password to be used on data decryption
+// NOTE: Default password is returned if not set, global password is not modified (thread-safe read)
+const char *rresGetCipherPassword(void)
+{
+    return (password != NULL)? password : "password12345";
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Load user resource chunk from resource packed data (as contained in .rres file)
+// WARNING: Data can be compressed and/or encrypted, in those cases is up to the user to process it,
+// and chunk.data.propCount = 0, chunk.data.props = NULL and chunk.data.raw contains all resource packed data
+static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *data)
+{
+    rresResourceChunkData chunkData = { 0 };
+
+    // CRC32 data validation, verify packed data is not corrupted
+    unsigned int crc32 = rresUpdateCRC32(0, (unsigned char *)data, info.packedSize);
+
+    if ((rresGetDataType(info.type) != RRES_DATA_NULL) && (crc32 == info.crc32))   // Make sure chunk contains data and data is not corrupted
+    {
+        // Check if data chunk is compressed/encrypted to retrieve properties + data
+        if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE))
+        {
+            // Data is not compressed/encrypted (info.packedSize = info.baseSize)
+            chunkData = rresLoadResourceChunkDataFromMemory(data, info.baseSize, info.flags);
+        }
+        else
+        {
+            // Data is compressed/encrypted
+            // We just return the loaded resource packed data from .rres file,
+            // it's up to the user to manage decompression/decryption on user library
+            chunkData.raw = RRES_MALLOC(info.packedSize);
+
+            if (chunkData.raw != NULL)
+            {
+                memcpy(chunkData.raw, (unsigned char *)data, info.packedSize);
+                chunkData.rawSize = info.packedSize;
+            }
+        }
+    }
+
+    if (crc32 != info.crc32) RRES_LOG("RRES: WARNING: [ID 0x%08x] CRC32 does not match, data can be corrupted\n", info.id);
+
+    return chunkData;
+}
+
+// Read file header, file layout depends on version
+// NOTE: Returns true if file signature and version are valid
+static bool rresReadFileHeader(FILE *rresFile, rresFileHeader *header)
+{
+    unsigned char buffer[24] = { 0 };
+    bool valid = false;
+
+    memset(header, 0, sizeof(rresFileHeader));
+
+    // Read file signature and version, common to all versions
+    if (fread(buffer, 8, 1, rresFile) == 1)
+    {
+        memcpy(header->id, buffer, 4);
+        memcpy(&header->version, buffer + 4, 2);
+
+        if ((header->id[0] == 'r') && (header->id[1] == 'r') && (header->id[2] == 'e') && (header->id[3] == 's'))
+        {
+            if (header->version == RRES_FILE_VERSION)
+            {
+                if (fread(buffer + 8, 8, 1, rresFile) == 1)
+                {
+                    unsigned short chunkCount = 0;
+                    unsigned int cdOffset = 0;
+
+                    memcpy(&chunkCount, buffer + 6, 2);
+                    memcpy(&cdOffset, buffer + 8, 4);
+                    memcpy(&header->reserved, buffer + 12, 4);
+
+                    header->chunkCount = chunkCount;
+                    header->cdOffset = cdOffset;
+                    valid = true;
+                }
+            }
+            else if (header->version == RRES_FILE_VERSION_LARGE)
+            {
+                if (fread(buffer + 8, 16, 1, rresFile) == 1)
+                {
+                    memcpy(&header->chunkCount, buffer + 8, 4);
+                    memcpy(&header->reserved, buffer + 12, 4);
+                    memcpy(&header->cdOffset, buffer + 16, 8);
+                    valid = true;
+                }
+            }
+        }
+    }
+
+    return valid;
+}
+
+// Read resource chunk info, file layout depends on version
+static bool rresReadResourceChunkInfo(FILE *rresFile, unsigned short version, rresResourceChunkInfo *info)
+{
+    unsigned char buffer[48] = { 0 };
+    bool valid = false;
+
+    memset(info, 0, sizeof(rresResourceChunkInfo));
+
+    if (fread(buffer, rresGetResourceChunkInfoSize(version), 1, rresFile) == 1)
+    {
+        memcpy(info->type, buffer, 4);
+        memcpy(&info->id, buffer + 4, 4);
+        info->compType = buffer[8];
+        info->cipherType = buffer[9];
+        memcpy(&info->flags, buffer + 10, 2);
+
+        if (version == RRES_FILE_VERSION_LARGE)
+        {
+            memcpy(&info->crc32, buffer + 12, 4);
+            memcpy(&info->packedSize, buffer + 16, 8);
+            memcpy(&info->baseSize, buffer + 24, 8);
+            memcpy(&info->nextOffset, buffer + 32, 8);
+            memcpy(&info->reserved, buffer + 40, 4);
+        }
+        else
+        {
+            unsigned int sizes[3] = { 0 };
+
+            memcpy(sizes, buffer + 12, 12);
+            memcpy(&info->reserved, buffer + 24, 4);
+            memcpy(&info->crc32, buffer + 28, 4);
+
+            info->packedSize = sizes[0];
+            info->baseSize = sizes[1];
+            info->nextOffset = sizes[2];
+        }
+
+        valid = true;
+    }
+
+    return valid;
+}
+
+// Load first live resource chunk of provided type
+// NOTE: Used to load header chunks (archive records), data is expected not compressed/encrypted
+static rresResourceChunk rresLoadHeaderChunk(const char *fileName, unsigned int type)
+{
+    rresResourceChunk chunk = { 0 };
+    rresFileHeader header = { 0 };
+
+    FILE *rresFile = rresOpenFile(fileName, &header);
+
+    if (rresFile != NULL)
+    {
+        for (unsigned int i = 0; i < header.chunkCount; i++)
+        {
+            rresResourceChunkInfo info = { 0 };
+            if (!rresReadResourceChunkInfo(rresFile, header.version, &info)) break;
+
+            if ((rresGetDataType(info.type) == type) && ((info.flags & RRES_FLAG_DEAD) == 0))
+            {
+                if (rresResolveAliasChunk(rresFile, header.version, &info))
+                {
+                    void *data = RRES_MALLOC(info.packedSize);
+
+                    if ((data != NULL) && (fread(data, 1, (size_t)info.packedSize, rresFile) == info.packedSize))
+                    {
+                        // NOTE: Header chunks are not compressed/encrypted, properties are loaded
+                        chunk.data = rresLoadResourceChunkData(info, data);
+                        chunk.info = info;
+                    }
+
+                    RRES_FREE(data);
+                }
+
+                break;
+            }
+            else RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);    // Jump to next resource
+        }
+
+        fclose(rresFile);
+    }
+
+    return chunk;
+}
+
+// Resolve alias resource chunk
+// NOTE: For alias chunks (RRES_FLAG_ALIAS), aliased chunk info is read and file is moved to its data,
+// alias id and nextOffset are kept (alias chunks can be part of multi-chunk resources)
+static bool rresResolveAliasChunk(FILE *rresFile, unsigned short version, rresResourceChunkInfo *info)
+{
+    if ((info->flags & RRES_FLAG_ALIAS) == 0) return true;
+
+    rresResourceChunkInfo target = { 0 };
+    unsigned long long offset = 0;
+
+    bool result = (info->packedSize == sizeof(unsigned long long)) && (fread(&offset, sizeof(unsigned long long), 1, rresFile) == 1) &&
+        (RRES_FSEEK(rresFile, offset, SEEK_SET) == 0) && rresReadResourceChunkInfo(rresFile, version, &target) && ((target.flags & RRES_FLAG_ALIAS) == 0);
+
+    if (result)
+    {
+        // NOTE: Aliased chunk data is valid even if chunk was replaced (dead) later
+        target.id = info->id;
+        target.nextOffset = info->nextOffset;
+        target.flags &= ~RRES_FLAG_DEAD;
+        *info = target;
+    }
+    else RRES_LOG("RRES: WARNING: [ID 0x%08x] Alias resource chunk could not be resolved\n", info->id);
+
+    return result;
+}
+
+// Update CRC32 hash with provided data
+// NOTE: Useful to compute CRC32 on data provided in multiple pieces, initial crc must be 0
+static unsigned int rresUpdateCRC32(unsigned int crc, const unsigned char *data, unsigned long long len)
+{
+static const unsigned int crcTable[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+
+    crc = ~crc;
+
+    for (unsigned long long i = 0; i < len; i++) crc = (crc >> 8)^crcTable[data[i]^(crc&0xff)];
+
+    return ~crc;
+}
+
+#if defined(RRES_SUPPORT_THREADS)
+// Worker thread: process jobs until none left
+#if defined(_WIN32)
+static DWORD WINAPI rresJobWorker(LPVOID jobs)
+#else
+static void *rresJobWorker(void *jobs)
+#endif
+{
+    rresParallelJobs *parallel = (rresParallelJobs *)jobs;
+
+    while (true)
+    {
+        RRES_MUTEX_LOCK(&parallel->mutex);
+        unsigned int index = parallel->nextJob;
+        if (index < parallel->jobCount) parallel->nextJob++;
+        RRES_MUTEX_UNLOCK(&parallel->mutex);
+
+        if (index >= parallel->jobCount) break;
+
+        parallel->job(parallel->userData, index);
+    }
+
+    return 0;
+}
+#endif
+
+// Pack job: pack resource chunk and compute CRC32
+// NOTE: Not compressed/encrypted chunks are not packed, CRC32 is computed on writing
+static void rresPackJob(void *batch, unsigned int index)
+{
+    rresPackBatch *packBatch = (rresPackBatch *)batch;
+    rresPackItem *item = &packBatch->items[index];
+    bool result = true;
+
+    item->packedData = NULL;
+
+    if ((item->info.compType != RRES_COMP_NONE) || (item->info.cipherType != RRES_CIPHER_NONE))
+    {
+        result = ((packBatch->pack != NULL) && packBatch->pack(item, packBatch->userData) && (item->packedData != NULL));
+
+        if (result) item->info.crc32 = rresUpdateCRC32(0, (const unsigned char *)item->packedData, item->info.packedSize);
+    }
+
+    packBatch->results[index] = result;
+}
+
+// Begin writer resource chunk
+// NOTE: Chunk info space is reserved, propCount, props[] and padding (if aligned) are written if required
+static bool rresBeginWriterChunk(rresWriter *writer, rresResourceChunkInfo info, unsigned int propCount, const unsigned int *props, bool writeProps)
+{
+    if ((writer == NULL) || writer->error) return false;
+
+    if (writer->chunkOpen)
+    {
+        RRES_LOG("RRES: WARNING: Resource chunk already begun, it must be ended first\n");
+        return false;
+    }
+
+    // Register resource chunk offset
+    if (!rresAddWriterChunk(writer, info.id, (unsigned long long)RRES_FTELL(writer->file), info.flags)) { writer->error = true; return false; }
+
+    // Replace resource chunks with same id already existing in file (appending)
+    // NOTE: Central directory is always written again, previous one is replaced on writer open
+    if (rresGetDataType(info.type) != RRES_DATA_DIRECTORY) rresRemoveWriterChunks(writer, info.id, writer->appendStart);
+
+    writer->info = info;
+    writer->info.packedSize = 0;
+    writer->info.nextOffset = 0;
+    writer->info.crc32 = 0;
+    writer->chunkOpen = true;
+
+    // Reserve chunk info space
+    unsigned char buffer[48] = { 0 };
+    bool result = rresWriteToFile(writer, buffer, rresGetResourceChunkInfoSize(writer->header.version), false);
+
+    if (result && writeProps)
+    {
+        result = rresWriteToFile(writer, &propCount, sizeof(unsigned int), true);
+        if (result && (propCount > 0)) result = rresWriteToFile(writer, props, propCount*sizeof(unsigned int), true);
+
+        if (result && ((info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0))
+        {
+            unsigned long long dataOffset = writer->chunks[writer->header.chunkCount].offset + rresGetResourceChunkInfoSize(writer->header.version);
+            unsigned int padding = rresGetDataPaddingSize(dataOffset, propCount, info.flags);
+
+            result = rresWriteToFile(writer, &padding, sizeof(unsigned int), true);
+
+            for (unsigned int i = 0; result && (i < padding); i += 48) result = rresWriteToFile(writer, buffer, ((padding - i) < 48)? (padding - i) : 48, true);
+        }
+    }
+
+    return result;
+}
+
+// Write data to file
+// NOTE: Current chunk packed size and CRC32 are updated with written data (if required)
+static bool rresWriteToFile(rresWriter *writer, const void *data, unsigned long long size, bool updateCRC)
+{
+    if (size == 0) return true;
+
+    bool result = (fwrite(data, 1, (size_t)size, writer->file) == (size_t)size);
+
+    if (result && updateCRC)
+    {
+        writer->info.crc32 = rresUpdateCRC32(writer->info.crc32, (const unsigned char *)data, size);
+        writer->info.packedSize += size;
+    }
+
+    if (!result)
+    {
+        RRES_LOG("RRES: WARNING: Data could not be written to file\n");
+        writer->error = true;
+    }
+
+    return result;
+}
+
+// Write resource chunk info at provided offset
+static bool rresWriteResourceChunkInfo(rresWriter *writer, unsigned long long offset, rresResourceChunkInfo info)
+{
+    unsigned char buffer[48] = { 0 };
+    unsigned int infoSize = rresSerializeResourceChunkInfo(info, writer->header.version, buffer);
+
+    return ((RRES_FSEEK(writer->file, offset, SEEK_SET) == 0) && (fwrite(buffer, 1, infoSize, writer->file) == infoSize));
+}
+
+// Write central directory resource chunk
+// NOTE: Entries offsets are solved from written chunks, CDIR is written as last chunk
+// and file header cdOffset is set relative to file header end (as expected by rresLoadCentralDirectory())
+static bool rresWriteCentralDirectory(rresWriter *writer)
+{
+    rresResourceChunkInfo info = { 0 };
+    info.type[0] = 'C';
+    info.type[1] = 'D';
+    info.type[2] = 'I';
+    info.type[3] = 'R';
+
+    unsigned long long cdOffset = (unsigned long long)RRES_FTELL(writer->file);
+    bool result = rresBeginResourceChunk(writer, info, 1, &writer->entryCount);
+
+    for (unsigned int i = 0; result && (i < writer->entryCount); i++)
+    {
+        unsigned char entry[24] = { 0 };
+        unsigned int entrySize = 0;
+        unsigned long long offset = 0;
+        unsigned int fileNameLength = (unsigned int)strlen(writer->entries[i].fileName);
+        unsigned int fileNameSize = fileNameLength + 1 + ((4 - ((fileNameLength + 1)%4))%4);    // NULL terminated and padded to 4-byte
+
+        for (unsigned int k = 0; k < writer->header.chunkCount; k++)
+        {
+            if ((writer->chunks[k].id == writer->entries[i].id) && !writer->chunks[k].dead)
+            {
+                // NOTE: Alias chunks entries point to aliased chunk, ids with identical data share the same offset
+                offset = (writer->chunks[k].aliasOffset != 0)? writer->chunks[k].aliasOffset : writer->chunks[k].offset;
+                break;
+            }
+        }
+
+        memcpy(entry, &writer->entries[i].id, 4);
+
+        if (writer->header.version == RRES_FILE_VERSION_LARGE)
+        {
+            memcpy(entry + 8, &offset, 8);
+            memcpy(entry + 16, &fileNameSize, 4);
+            entrySize = 20;
+        }
+        else
+        {
+            unsigned int offset32 = (unsigned int)offset;
+            memcpy(entry + 4, &offset32, 4);
+            memcpy(entry + 12, &fileNameSize, 4);
+            entrySize = 16;
+        }
+
+        unsigned char padding[4] = { 0 };
+
+        result = rresWriteResourceChunkData(writer, entry, entrySize);
+        if (result) result = rresWriteResourceChunkData(writer, writer->entries[i].fileName, fileNameLength);
+        if (result) result = rresWriteResourceChunkData(writer, padding, fileNameSize - fileNameLength);
+    }
+
+    if (result) result = rresEndResourceChunk(writer);
+    if (result) writer->header.cdOffset = cdOffset - rresGetFileHeaderSize(writer->header.version);
+
+    return result;
+}
+
+// Register resource chunk in writer
+// NOTE: Chunk is registered at writer->header.chunkCount position, count is updated on chunk end
+static bool rresAddWriterChunk(rresWriter *writer, unsigned int id, unsigned long long offset, unsigned short flags)
+{
+    if (writer->header.chunkCount >= writer->chunkCapacity)
+    {
+        unsigned int capacity = (writer->chunkCapacity == 0)? 64 : writer->chunkCapacity*2;
+        rresWriterChunk *chunks = (rresWriterChunk *)RRES_REALLOC(writer->chunks, capacity*sizeof(rresWriterChunk));
+
+        if (chunks == NULL) return false;
+
+        writer->chunks = chunks;
+        writer->chunkCapacity = capacity;
+    }
+
+    writer->chunks[writer->header.chunkCount].id = id;
+    writer->chunks[writer->header.chunkCount].offset = offset;
+    writer->chunks[writer->header.chunkCount].flags = flags;
+    writer->chunks[writer->header.chunkCount].dead = ((flags & RRES_FLAG_DEAD) != 0);
+    writer->chunks[writer->header.chunkCount].aliasOffset = 0;
+
+    return true;
+}
+
+// Mark writer resource chunks with provided id as dead
+// NOTE: Only first count registered chunks are checked
+static void rresRemoveWriterChunks(rresWriter *writer, unsigned int id, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (writer->chunks[i].id == id) writer->chunks[i].dead = true;
+    }
+}
+
+// Update content hash with provided data
+// NOTE: FNV-1a 64bit, hash value 0 starts a new hash
+static unsigned long long rresUpdateHash64(unsigned long long hash, const void *data, unsigned long long size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    if (hash == 0) hash = 0xcbf29ce484222325ULL;
+
+    for (unsigned long long i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Find written chunk with identical data
+// NOTE: Candidates with same hash, size and info are verified comparing data in file,
+// for not compressed/encrypted chunks (withProps), propCount + props[] + data is compared skipping padding
+static rresWriterPayload *rresFindWriterPayload(rresWriter *writer, rresResourceChunkInfo info, unsigned long long hash, unsigned int propCount, const unsigned int *props, const void *data, unsigned long long size, bool withProps)
+{
+    rresWriterPayload *match = NULL;
+    unsigned long long contentSize = withProps? (size + (1 + (unsigned long long)propCount)*sizeof(unsigned int)) : size;
+    unsigned int index = writer->payloadBuckets[hash & (RRES_DEDUP_BUCKET_COUNT - 1)];
+
+    while ((match == NULL) && (index != 0))
+    {
+        rresWriterPayload *payload = &writer->payloads[index - 1];
+
+        if ((payload->hash == hash) && (payload->size == contentSize) && (memcmp(payload->info.type, info.type, 4) == 0) &&
+            (payload->info.compType == info.compType) && (payload->info.cipherType == info.cipherType) && (payload->info.flags == info.flags))
+        {
+            bool equal = (RRES_FSEEK(writer->file, payload->offset + rresGetResourceChunkInfoSize(writer->header.version), SEEK_SET) == 0);
+
+            if (equal && withProps)
+            {
+                equal = rresCompareFileData(writer->file, &propCount, sizeof(unsigned int)) && rresCompareFileData(writer->file, props, propCount*sizeof(unsigned int));
+
+                if (equal && ((info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0))
+                {
+                    unsigned int padding = 0;
+                    equal = (fread(&padding, sizeof(unsigned int), 1, writer->file) == 1) && (RRES_FSEEK(writer->file, padding, SEEK_CUR) == 0);
+                }
+            }
+
+            if (equal) equal = rresCompareFileData(writer->file, data, size);
+            if (equal) match = payload;
+        }
+
+        index = payload->next;
+    }
+
+    if (RRES_FSEEK(writer->file, 0, SEEK_END) != 0) writer->error = true;
+
+    return match;
+}
+
+// Register last written chunk data
+static void rresAddWriterPayload(rresWriter *writer, unsigned long long hash, unsigned long long size)
+{
+    if (writer->payloadCount >= writer->payloadCapacity)
+    {
+        unsigned int capacity = (writer->payloadCapacity == 0)? 64 : writer->payloadCapacity*2;
+        rresWriterPayload *payloads = (rresWriterPayload *)RRES_REALLOC(writer->payloads, capacity*sizeof(rresWriterPayload));
+
+        // NOTE: In case of allocation failure data is just not deduplicated
+        if (payloads == NULL) return;
+
+        writer->payloads = payloads;
+        writer->payloadCapacity = capacity;
+    }
+
+    unsigned int bucket = (unsigned int)(hash & (RRES_DEDUP_BUCKET_COUNT - 1));
+    rresWriterPayload *payload = &writer->payloads[writer->payloadCount];
+
+    payload->hash = hash;
+    payload->size = size;
+    payload->offset = writer->chunks[writer->header.chunkCount - 1].offset;
+    payload->info = writer->prevInfo;
+    payload->next = writer->payloadBuckets[bucket];
+
+    writer->payloadCount++;
+    writer->payloadBuckets[bucket] = writer->payloadCount;
+}
+
+// Compare file data at current position with provided data
+static bool rresCompareFileData(FILE *file, const void *data, unsigned long long size)
+{
+    unsigned char buffer[4096] = { 0 };
+    const unsigned char *bytes = (const unsigned char *)data;
+    bool equal = true;
+
+    for (unsigned long long i = 0; equal && (i < size); i += sizeof(buffer))
+    {
+        size_t count = ((size - i) < sizeof(buffer))? (size_t)(size - i) : sizeof(buffer);
+
+        equal = (fread(buffer, 1, count, file) == count) && (memcmp(buffer, bytes + i, count) == 0);
+    }
+
+    return equal;
+}
+
+// Write alias resource chunk
+// NOTE: Chunk data is the aliased chunk global offset (8 bytes), type, compression and encryption are kept
+static bool rresWriteAliasChunk(rresWriter *writer, unsigned int id, const rresWriterPayload *payload)
+{
+    rresResourceChunkInfo info = payload->info;
+    unsigned long long offset = payload->offset;
+
+    info.id = id;
+    info.flags |= RRES_FLAG_ALIAS;
+
+    bool result = rresBeginWriterChunk(writer, info, 0, NULL, false);
+
+    if (result) result = rresWriteToFile(writer, &offset, sizeof(unsigned long long), true);
+    if (result) result = rresEndResourceChunk(writer);
+    else writer->chunkOpen = false;
+
+    if (result)
+    {
+        writer->chunks[writer->header.chunkCount - 1].aliasOffset = offset;
+        RRES_LOG("RRES: INFO: [ID 0x%08x] Resource chunk data deduplicated, alias to offset: 0x%08llx\n", id, offset);
+    }
+
+    return result;
+}
+
+// Record resource id access into current access trace
+static void rresRecordAccess(unsigned int id)
+{
+    rresAccessTrace *trace = accessTrace;
+
+    if (trace != NULL)
+    {
+        RRES_MUTEX_LOCK(&trace->mutex);
+
+        if (trace->count >= trace->capacity)
+        {
+            unsigned int capacity = (trace->capacity == 0)? 256 : trace->capacity*2;
+            unsigned int *ids = (unsigned int *)RRES_REALLOC(trace->ids, capacity*sizeof(unsigned int));
+
+            if (ids != NULL)
+            {
+                trace->ids = ids;
+                trace->capacity = capacity;
+            }
+        }
+
+        if (trace->count < trace->capacity) trace->ids[trace->count++] = id;
+
+        RRES_MUTEX_UNLOCK(&trace->mutex);
+    }
+}
+
+// Open rres file for reading
+// NOTE: File header is read and validated, file position is left after file header
+static FILE *rresOpenFile(const char *fileName, rresFileHeader *header)
+{
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else if (!rresReadFileHeader(rresFile, header))
+    {
+        RRES_LOG("RRES: WARNING: [%s] The provided file is not a valid rres file, file signature or version not valid\n", fileName);
+        fclose(rresFile);
+        rresFile = NULL;
+    }
+
+    return rresFile;
+}
+
+// Compute resource chunks checksum
+// NOTE: Chunks must be provided in file order, used to verify patch base file
+static unsigned int rresComputeRewriteChecksum(const rresRewriteChunk *chunks, unsigned int chunkCount)
+{
+    unsigned int checksum = rresUpdateCRC32(0, (const unsigned char *)&chunkCount, sizeof(unsigned int));
+
+    for (unsigned int i = 0; i < chunkCount; i++)
+    {
+        checksum = rresUpdateCRC32(checksum, (const unsigned char *)&chunks[i].info.id, sizeof(unsigned int));
+        checksum = rresUpdateCRC32(checksum, (const unsigned char *)&chunks[i].info.crc32, sizeof(unsigned int));
+    }
+
+    return checksum;
+}
+
+// Load live resource chunks info in file order
+// NOTE: Dead chunks and central directory are skipped, alias chunks are resolved,
+// file position is expected after file header
+static rresRewriteChunk *rresLoadRewriteChunks(FILE *rresFile, rresFileHeader header, unsigned int *chunkCount, unsigned int *deadCount, unsigned int *aliasCount)
+{
+    rresRewriteChunk *chunks = (rresRewriteChunk *)RRES_CALLOC((header.chunkCount > 0)? header.chunkCount : 1, sizeof(rresRewriteChunk));
+    bool result = (chunks != NULL);
+
+    *chunkCount = 0;
+    *deadCount = 0;
+    *aliasCount = 0;
+
+    for (unsigned int i = 0; result && (i < header.chunkCount); i++)
+    {
+        rresResourceChunkInfo info = { 0 };
+        result = rresReadResourceChunkInfo(rresFile, header.version, &info);
+
+        if (!result) break;
+
+        long long nextChunkOffset = RRES_FTELL(rresFile) + (long long)info.packedSize;
+
+        if ((info.flags & RRES_FLAG_DEAD) != 0) (*deadCount)++;
+        else if (rresGetDataType(info.type) != RRES_DATA_DIRECTORY)
+        {
+            if ((info.flags & RRES_FLAG_ALIAS) != 0)
+            {
+                (*aliasCount)++;
+                result = rresResolveAliasChunk(rresFile, header.version, &info);
+            }
+
+            chunks[*chunkCount].info = info;
+            chunks[*chunkCount].offset = (unsigned long long)RRES_FTELL(rresFile);
+            (*chunkCount)++;
+        }
+
+        if (result) result = (RRES_FSEEK(rresFile, nextChunkOffset, SEEK_SET) == 0);
+    }
+
+    if (!result)
+    {
+        RRES_LOG("RRES: WARNING: Resource chunks info could not be read\n");
+        RRES_FREE(chunks);
+        chunks = NULL;
+    }
+
+    return chunks;
+}
+
+// Compare rewrite chunks by id and file offset
+static int rresCompareRewriteChunks(const void *a, const void *b)
+{
+    const rresRewriteChunk *chunkA = (const rresRewriteChunk *)a;
+    const rresRewriteChunk *chunkB = (const rresRewriteChunk *)b;
+
+    if (chunkA->info.id != chunkB->info.id) return (chunkA->info.id < chunkB->info.id)? -1 : 1;
+    if (chunkA->offset != chunkB->offset) return (chunkA->offset < chunkB->offset)? -1 : 1;
+
+    return 0;
+}
+
+// Compare rewrite chunks pointers by file offset
+static int rresCompareRewriteOffsets(const void *a, const void *b)
+{
+    const rresRewriteChunk *chunkA = *(const rresRewriteChunk *const *)a;
+    const rresRewriteChunk *chunkB = *(const rresRewriteChunk *const *)b;
+
+    if (chunkA->offset != chunkB->offset) return (chunkA->offset < chunkB->offset)? -1 : 1;
+
+    return 0;
+}
+
+// Find first rewrite chunk with provided id
+// NOTE: Chunks must be sorted by id, chunkCount is returned if not found
+static unsigned int rresFindRewriteChunk(const rresRewriteChunk *chunks, unsigned int chunkCount, unsigned int id)
+{
+    unsigned int low = 0;
+    unsigned int high = chunkCount;
+
+    while (low < high)
+    {
+        unsigned int mid = low + (high - low)/2;
+
+        if (chunks[mid].info.id < id) low = mid + 1;
+        else high = mid;
+    }
+
+    return ((low < chunkCount) && (chunks[low].info.id == id))? low : chunkCount;
+}
+
+// Write resource chunks with the same id starting at first
+// NOTE: Chunks are written consecutively in file order, so writer links them as a multi-chunk resource
+static bool rresWriteRewriteChunks(rresWriter *writer, FILE *rresFile, rresRewriteChunk *chunks, unsigned int chunkCount, unsigned int first)
+{
+    bool result = true;
+
+    for (unsigned int i = first; result && (i < chunkCount) && (chunks[i].info.id == chunks[first].info.id); i++)
+    {
+        result = rresCopyResourceChunk(writer, rresFile, chunks[i].info, chunks[i].offset);
+        chunks[i].written = true;
+    }
+
+    return result;
+}
+
+// Copy resource chunk data into writer
+// NOTE: Packed data is copied as is, aligned not compressed/encrypted chunks are written again
+// because padding depends on file offset: propCount + props[] + padding + data,
+// data is copied in blocks (bounded memory) unless writer deduplication is enabled (full data required),
+// alias chunks must be resolved (provided info and offset of aliased chunk data)
+static bool rresCopyResourceChunk(rresWriter *writer, FILE *rresFile, rresResourceChunkInfo info, unsigned long long offset)
+{
+    bool aligned = ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE) && ((info.flags & RRES_FLAG_ALIGNMENT_MASK) != 0));
+    unsigned long long blockSize = ((writer->payloadBuckets != NULL) || (info.packedSize < RRES_COPY_BLOCK_SIZE))? info.packedSize : RRES_COPY_BLOCK_SIZE;
+    unsigned char *block = (unsigned char *)RRES_MALLOC((blockSize > 0)? (size_t)blockSize : 1);
+    unsigned long long remaining = info.packedSize;
+    unsigned int *props = NULL;
+    unsigned int propCount = 0;
+    unsigned int crc32 = 0;
+
+    bool result = (block != NULL) && (RRES_FSEEK(rresFile, offset, SEEK_SET) == 0);
+
+    // Read aligned data header: propCount + props[] + padding
+    if (result && aligned)
+    {
+        unsigned int padding = 0;
+
+        result = (remaining >= 2*sizeof(unsigned int)) && (fread(&propCount, sizeof(unsigned int), 1, rresFile) == 1);
+        if (result) result = ((remaining - 2*sizeof(unsigned int))/sizeof(unsigned int) >= propCount);
+        if (result && (propCount > 0))
+        {
+            props = (unsigned int *)RRES_MALLOC(propCount*sizeof(unsigned int));
+            result = (props != NULL) && (fread(props, sizeof(unsigned int), propCount, rresFile) == propCount);
+        }
+        if (result) result = (fread(&padding, sizeof(unsigned int), 1, rresFile) == 1);
+
+        if (result)
+        {
+            crc32 = rresUpdateCRC32(crc32, (const unsigned char *)&propCount, sizeof(unsigned int));
+            crc32 = rresUpdateCRC32(crc32, (const unsigned char *)props, propCount*sizeof(unsigned int));
+            crc32 = rresUpdateCRC32(crc32, (const unsigned char *)&padding, sizeof(unsigned int));
+            remaining -= (2 + (unsigned long long)propCount)*sizeof(unsigned int);
+            result = (remaining >= padding);
+        }
+
+        // NOTE: Padding is read to verify CRC32, it is written again by writer
+        for (unsigned long long i = 0; result && (i < padding); i += blockSize)
+        {
+            size_t count = ((padding - i) < blockSize)? (size_t)(padding - i) : (size_t)blockSize;
+            result = (fread(block, 1, count, rresFile) == count);
+            crc32 = rresUpdateCRC32(crc32, block, count);
+        }
+
+        if (result) remaining -= padding;
+    }
+
+    if (writer->payloadBuckets != NULL)
+    {
+        // Full data is required to find identical data already written
+        result = result && (fread(block, 1, (size_t)remaining, rresFile) == (size_t)remaining);
+        crc32 = rresUpdateCRC32(crc32, block, remaining);
+
+        if (result && (crc32 != info.crc32))
+        {
+            RRES_LOG("RRES: WARNING: [ID 0x%08x] CRC32 does not match, data can be corrupted\n", info.id);
+            result = false;
+        }
+
+        if (result && aligned)
+        {
+            rresResourceChunkData chunkData = { 0 };
+            chunkData.propCount = propCount;
+            chunkData.props = props;
+            chunkData.raw = block;
+
+            result = rresWriteResourceChunk(writer, info, chunkData, remaining);
+        }
+        else if (result) result = rresWritePackedResourceChunk(writer, info, block);
+    }
+    else
+    {
+        // NOTE: Props are already contained in packed data
+        if (result) result = aligned? rresBeginResourceChunk(writer, info, propCount, props) : rresBeginWriterChunk(writer, info, 0, NULL, false);
+
+        while (result && (remaining > 0))
+        {
+            size_t count = (remaining < blockSize)? (size_t)remaining : (size_t)blockSize;
+
+            result = (fread(block, 1, count, rresFile) == count);
+            crc32 = rresUpdateCRC32(crc32, block, count);
+
+            if (result) result = aligned? rresWriteResourceChunkData(writer, block, count) : rresWriteToFile(writer, block, count, false);
+
+            remaining -= count;
+        }
+
+        if (result && (crc32 != info.crc32))
+        {
+            RRES_LOG("RRES: WARNING: [ID 0x%08x] CRC32 does not match, data can be corrupted\n", info.id);
+            result = false;
+        }
+
+        if (result)
+        {
+            if (!aligned)
+            {
+                writer->info = info;
+                writer->info.nextOffset = 0;
+            }
+
+            result = rresEndResourceChunk(writer);
+        }
+        else writer->chunkOpen = false;
+    }
+
+    RRES_FREE(props);
+    RRES_FREE(block);
+
+    return result;
+}
+
+// Load one resource chunk for provided id from file
+// NOTE: Packed data buffer is requested from pool (if provided), chunk is read directly if offset is provided
+static rresResourceChunk rresLoadResourceChunkFromFile(const char *fileName, int rresId, rresBufferPool *pool, unsigned long long offset)
+{
+    rresResourceChunk chunk = { 0 };
 
     FILE *rresFile = fopen(fileName, "rb");
 
-    if (rresFile != NULL)
-    {
-        rresFileHeader header = { 0 };
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else
+    {
+        RRES_LOG("RRES: INFO: Loading resource from file: %s\n", fileName);
+
+        rresFileHeader header = { 0 };
+
+        // Read rres file header, verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
+        {
+            bool found = false;
+            unsigned int chunkCount = header.chunkCount;
+
+            // Jump to resource chunk info if offset is known (mounted archives index)
+            if (offset > 0)
+            {
+                RRES_FSEEK(rresFile, offset, SEEK_SET);
+                chunkCount = 1;
+            }
+
+            // Check all available chunks looking for the requested id
+            for (unsigned int i = 0; i < chunkCount; i++)
+            {
+                rresResourceChunkInfo info = { 0 };
+
+                // Read resource info header
+                rresReadResourceChunkInfo(rresFile, header.version, &info);
+
+                // Check if resource id is the requested one
+                // NOTE: Dead resource chunks (replaced or removed) are skipped
+                if ((info.id == rresId) && ((info.flags & RRES_FLAG_DEAD) == 0))
+                {
+                    found = true;
+
+                    RRES_LOG("RRES: INFO: Found requested resource id: 0x%08x\n", info.id);
+                    rresRecordAccess(info.id);
+
+                    // Resolve alias resource chunk (deduplicated data), file is moved to aliased chunk data
+                    if (!rresResolveAliasChunk(rresFile, header.version, &info)) break;
+
+                    RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %llu | Packed size: %llu\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+
+                    // NOTE: We only load first matching id resource chunk found but
+                    // we show a message if additional chunks are detected
+                    if (info.nextOffset != 0) RRES_LOG("RRES: WARNING: Multiple linked resource chunks available for the provided id");
+
+                    /*
+                    // Variables required to check multiple chunks
+                    int chunkCount = 0;
+                    long long currentFileOffset = RRES_FTELL(rresFile);           // Store current file position
+                    rresResourceChunkInfo temp = info;                  // Temp info header to scan resource chunks
+
+                    // Count all linked resource chunks checking temp.nextOffset
+                    while (temp.nextOffset != 0)
+                    {
+                        RRES_FSEEK(rresFile, temp.nextOffset, SEEK_SET);     // Jump to next linked resource
+                        rresReadResourceChunkInfo(rresFile, header.version, &temp);  // Read next resource info header
+                        chunkCount++;
+                    }
+
+                    RRES_FSEEK(rresFile, currentFileOffset, SEEK_SET);       // Return to first resource chunk position
+                    */
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+                    // Read and resource chunk from file data
+                    // NOTE: Read data can be compressed/encrypted, it's up to the user library to manage decompression/decryption
+                    void *data = rresRequestPoolBuffer(pool, info.packedSize);    // Get enough memory to store resource data chunk
+                    fread(data, info.packedSize, 1, rresFile);    // Read data: propsCount + props[] + data (+additional_data)
 
-        // Verify file signature: "rres", file version: 100
-        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
-        {
-            // Load all resource chunks info
-            infos = (rresResourceChunkInfo *)RRES_CALLOC(header.chunkCount, sizeof(rresResourceChunkInfo));
-            count = header.chunkCount;
+                    // Get chunk.data properly organized (only if uncompressed/unencrypted)
+                    chunk.data = rresLoadResourceChunkData(info, data);
+                    chunk.info = info;
 
-            for (unsigned int i = 0; i < count; i++)
-            {
-                fread(&infos[i], sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource chunk info
+                    rresReleasePoolBuffer(pool, data, info.packedSize);
 
-                if (infos[i].nextOffset > 0) fseek(rresFile, infos[i].nextOffset, SEEK_SET); // Jump to next resource
-                else fseek(rresFile, infos[i].packedSize, SEEK_CUR); // Jump to next resource
+                    break;      // Resource id found and loaded, stop checking the file
+                }
+                else
+                {
+                    // Skip required data size to read next resource info header
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);
+                }
             }
+
+            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
         fclose(rresFile);
     }
 
-    *chunkCount = count;
-    return infos;
+    return chunk;
 }
 
-// Load central directory data
-rresCentralDir rresLoadCentralDirectory(const char *fileName)
+// Load resource for provided id from file (multiple resource chunks)
+// NOTE: Packed data buffers are requested from pool (if provided), first chunk is read directly if offset is provided
+static rresResourceMulti rresLoadResourceMultiFromFile(const char *fileName, int rresId, rresBufferPool *pool, unsigned long long offset)
 {
-    rresCentralDir dir = { 0 };
+    rresResourceMulti rres = { 0 };
 
     FILE *rresFile = fopen(fileName, "rb");
 
-    if (rresFile != NULL)
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else
     {
         rresFileHeader header = { 0 };
 
-        fread(&header, sizeof(rresFileHeader), 1, rresFile);
-
-        // Verify file signature: "rres", file version: 100
-        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        // Read rres file header, verify file signature: "rres" and file version: 100 or 101
+        if (rresReadFileHeader(rresFile, &header))
         {
-            // Check if there is a Central Directory available
-            if (header.cdOffset == 0) RRES_LOG("RRES: WARNING: CDIR: No central directory found\n");
-            else
+            bool found = false;
+            unsigned int chunkCount = header.chunkCount;
+
+            // Jump to resource chunk info if offset is known (mounted archives index)
+            if (offset > 0)
+            {
+                RRES_FSEEK(rresFile, offset, SEEK_SET);
+                chunkCount = 1;
+            }
+
+            // Check all available chunks looking for the requested id
+            for (unsigned int i = 0; i < chunkCount; i++)
             {
                 rresResourceChunkInfo info = { 0 };
 
-                fseek(rresFile, header.cdOffset, SEEK_CUR); // Move to central directory position
-                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource info
+                // Read resource info header
+                rresReadResourceChunkInfo(rresFile, header.version, &info);
 
-                // Verify resource type is CDIR
-                if ((info.type[0] == 'C') && (info.type[1] == 'D') && (info.type[2] == 'I') && (info.type[3] == 'R'))
+                // Check if resource id is the requested one
+                // NOTE: Dead resource chunks (replaced or removed) are skipped
+                if ((info.id == rresId) && ((info.flags & RRES_FLAG_DEAD) == 0))
                 {
-                    RRES_LOG("RRES: CDIR: Central Directory found at offset: 0x%08x\n", header.cdOffset);
+                    found = true;
 
-                    void *data = RRES_MALLOC(info.packedSize);
-                    fread(data, info.packedSize, 1, rresFile);
+                    RRES_LOG("RRES: INFO: Found requested resource id: 0x%08x\n", info.id);
+                    rresRecordAccess(info.id);
 
-                    // Load resource chunk data (central directory), data is uncompressed/unencrypted by default
-                    rresResourceChunkData chunkData = rresLoadResourceChunkData(info, data);
-                    RRES_FREE(data);
+                    // Resolve alias resource chunk (deduplicated data), file is moved to aliased chunk data
+                    if (!rresResolveAliasChunk(rresFile, header.version, &info)) break;
 
-                    dir.count = chunkData.props[0];     // File entries count
+                    RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %llu | Packed size: %llu\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
 
-                    RRES_LOG("RRES: CDIR: Central Directory file entries count: %i\n", dir.count);
+                    rres.count = 1;
 
-                    unsigned char *ptr = (unsigned char *)chunkData.raw;
-                    dir.entries = (rresDirEntry *)RRES_CALLOC(dir.count, sizeof(rresDirEntry));
+                    long long currentFileOffset = RRES_FTELL(rresFile);               // Store current file position
+                    rresResourceChunkInfo temp = info;                      // Temp info header to scan resource chunks
 
-                    for (unsigned int i = 0; i < dir.count; i++)
+                    // Count all linked resource chunks checking temp.nextOffset
+                    while (temp.nextOffset != 0)
                     {
-                        dir.entries[i].id = ((int *)ptr)[0];            // Resource id
-                        dir.entries[i].offset = ((int *)ptr)[1];        // Resource offset in file
-                        // NOTE: There is a reserved integer value before fileNameSize
-                        dir.entries[i].fileNameSize = ((int *)ptr)[3];  // Resource fileName size
+                        RRES_FSEEK(rresFile, temp.nextOffset, SEEK_SET);         // Jump to next linked resource
+                        rresReadResourceChunkInfo(rresFile, header.version, &temp); // Read next resource info header
+                        rres.count++;
+                    }
 
-                        // Resource fileName, NULL terminated and 0-padded to 4-byte,
-                        // fileNameSize considers NULL and padding
-                        memcpy(dir.entries[i].fileName, ptr + 16, dir.entries[i].fileNameSize);
+                    rres.chunks = (rresResourceChunk *)RRES_CALLOC(rres.count, sizeof(rresResourceChunk)); // Load as many rres slots as required
+                    RRES_FSEEK(rresFile, currentFileOffset, SEEK_SET);           // Return to first resource chunk position
+
+                    // Read and load data chunk from file data
+                    // NOTE: Read data can be compressed/encrypted,
+                    // it's up to the user library to manage decompression/decryption
+                    void *data = rresRequestPoolBuffer(pool, info.packedSize); // Get enough memory to store resource data chunk
+                    fread(data, info.packedSize, 1, rresFile);              // Read data: propsCount + props[] + data (+additional_data)
+
+                    // Get chunk.data properly organized (only if uncompressed/unencrypted)
+                    rres.chunks[0].data = rresLoadResourceChunkData(info, data);
+                    rres.chunks[0].info = info;
+
+                    rresReleasePoolBuffer(pool, data, info.packedSize);
+
+                    int i = 1;
+
+                    // Load all linked resource chunks
+                    while (info.nextOffset != 0)
+                    {
+                        RRES_FSEEK(rresFile, info.nextOffset, SEEK_SET);         // Jump to next resource chunk
+                        rresReadResourceChunkInfo(rresFile, header.version, &info); // Read next resource info header
+
+                        if (!rresResolveAliasChunk(rresFile, header.version, &info)) break;
+
+                        RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %llu | Packed size: %llu\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+
+                        void *data = rresRequestPoolBuffer(pool, info.packedSize); // Get enough memory to store resource data chunk
+                        fread(data, info.packedSize, 1, rresFile);          // Read data: propsCount + props[] + data (+additional_data)
+
+                        // Get chunk.data properly organized (only if uncompressed/unencrypted)
+                        rres.chunks[i].data = rresLoadResourceChunkData(info, data);
+                        rres.chunks[i].info = info;
+
+                        rresReleasePoolBuffer(pool, data, info.packedSize);
 
-                        ptr += (16 + dir.entries[i].fileNameSize);      // Move pointer for next entry
+                        i++;
                     }
 
-                    RRES_FREE(chunkData.props);
-                    RRES_FREE(chunkData.raw);
+                    break;      // Resource id found and loaded, stop checking the file
+                }
+                else
+                {
+                    // Skip required data size to read next resource info header
+                    RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR);
                 }
             }
+
+            if (!found) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
         }
         else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
 
         fclose(rresFile);
     }
 
-    return dir;
+    return rres;
 }
 
-// Unload central directory data
-void rresUnloadCentralDirectory(rresCentralDir dir)
+// Find mount index entry for id
+// NOTE: Linear probing, index is kept at most half full so an empty entry is always reached
+static rresMountEntry *rresFindMountEntry(const rresMountSet *set, unsigned int id)
 {
-    RRES_FREE(dir.entries);
+    unsigned int mask = set->entryCapacity - 1;
+    unsigned int index = id & mask;
+
+    while ((set->entries[index].archiveIndex > 0) && (set->entries[index].id != id)) index = (index + 1) & mask;
+
+    return &set->entries[index];
 }
 
-// Get rresResourceDataType from FourCC code
-// NOTE: Function expects to receive a char[4] array
-unsigned int rresGetDataType(const unsigned char *fourCC)
+// Merge archive resources into mount index
+// NOTE: Archive chunks info are scanned once, first live chunk of every id is indexed,
+// entries from lower priority archives are overridden (archive must be the top-most one)
+static bool rresMergeMountIndex(rresMountSet *set, unsigned int archiveIndex)
 {
-    unsigned int type = 0;
+    rresArchive *archive = set->archives[archiveIndex];
+    rresFileHeader header = { 0 };
 
-    if (fourCC != NULL)
+    FILE *rresFile = rresOpenFile(archive->fileName, &header);
+    bool result = (rresFile != NULL);
+
+    for (unsigned int i = 0; result && (i < header.chunkCount); i++)
     {
-        if (memcmp(fourCC, "NULL", 4) == 0) type = RRES_DATA_NULL;              // Reserved for empty chunks, no props/data
-        else if (memcmp(fourCC, "RAWD", 4) == 0) type = RRES_DATA_RAW;          // Raw file data, input file is not processed, just packed as is
-        else if (memcmp(fourCC, "TEXT", 4) == 0) type = RRES_DATA_TEXT;         // Text file data, byte data extracted from text file
-        else if (memcmp(fourCC, "IMGE", 4) == 0) type = RRES_DATA_IMAGE;        // Image file data, pixel data extracted from image file
-        else if (memcmp(fourCC, "WAVE", 4) == 0) type = RRES_DATA_WAVE;         // Audio file data, samples data extracted from audio file
-        else if (memcmp(fourCC, "VRTX", 4) == 0) type = RRES_DATA_VERTEX;       // Vertex file data, extracted from a mesh file
-        else if (memcmp(fourCC, "FNTG", 4) == 0) type = RRES_DATA_FONT_GLYPHS;  // Font glyphs info, generated from an input font file
-        else if (memcmp(fourCC, "LINK", 4) == 0) type = RRES_DATA_LINK;         // External linked file, filepath as provided on file input
-        else if (memcmp(fourCC, "CDIR", 4) == 0) type = RRES_DATA_DIRECTORY;    // Central directory for input files relation to resource chunks
+        rresResourceChunkInfo info = { 0 };
+        unsigned long long offset = (unsigned long long)RRES_FTELL(rresFile);
+
+        result = rresReadResourceChunkInfo(rresFile, header.version, &info);
+
+        // NOTE: Dead chunks, central directory and patch index are not indexed
+        if (result && ((info.flags & RRES_FLAG_DEAD) == 0) &&
+            (rresGetDataType(info.type) != RRES_DATA_DIRECTORY) && (rresGetDataType(info.type) != RRES_DATA_PATCH))
+        {
+            // Grow index if required, keeping it at most half full
+            if ((set->entryCount + 1)*2 > set->entryCapacity)
+            {
+                rresMountEntry *entries = set->entries;
+                unsigned int capacity = set->entryCapacity;
+
+                set->entryCapacity = (capacity > 0)? capacity*2 : RRES_MOUNT_INDEX_MIN_CAPACITY;
+                set->entries = (rresMountEntry *)RRES_CALLOC(set->entryCapacity, sizeof(rresMountEntry));
+
+                if (set->entries == NULL)
+                {
+                    set->entries = entries;
+                    set->entryCapacity = capacity;
+                    result = false;
+                    break;
+                }
+
+                for (unsigned int k = 0; k < capacity; k++)
+                {
+                    if (entries[k].archiveIndex > 0) *rresFindMountEntry(set, entries[k].id) = entries[k];
+                }
+
+                RRES_FREE(entries);
+            }
+
+            rresMountEntry *entry = rresFindMountEntry(set, info.id);
+
+            if (entry->archiveIndex == 0) set->entryCount++;
+
+            if (entry->archiveIndex != (archiveIndex + 1))
+            {
+                entry->id = info.id;
+                entry->archiveIndex = archiveIndex + 1;
+                entry->offset = offset;
+            }
+        }
+
+        if (result) result = (RRES_FSEEK(rresFile, info.packedSize, SEEK_CUR) == 0);
     }
 
-    /*
-    // Assign type (unsigned int) FourCC (char[4])
-    if ((fourCC[0] == 'N') && (fourCC[1] == 'U') && (fourCC[2] == 'L') && (fourCC[3] == 'L')) type = RRES_DATA_NULL;             // NULL
-    if ((fourCC[0] == 'R') && (fourCC[1] == 'A') && (fourCC[2] == 'W') && (fourCC[3] == 'D')) type = RRES_DATA_RAW;              // RAWD
-    else if ((fourCC[0] == 'T') && (fourCC[1] == 'E') && (fourCC[2] == 'X') && (fourCC[3] == 'T')) type = RRES_DATA_TEXT;        // TEXT
-    else if ((fourCC[0] == 'I') && (fourCC[1] == 'M') && (fourCC[2] == 'G') && (fourCC[3] == 'E')) type = RRES_DATA_IMAGE;       // IMGE
-    else if ((fourCC[0] == 'W') && (fourCC[1] == 'A') && (fourCC[2] == 'V') && (fourCC[3] == 'E')) type = RRES_DATA_WAVE;        // WAVE
-    else if ((fourCC[0] == 'V') && (fourCC[1] == 'R') && (fourCC[2] == 'T') && (fourCC[3] == 'X')) type = RRES_DATA_VERTEX;      // VRTX
-    else if ((fourCC[0] == 'F') && (fourCC[1] == 'N') && (fourCC[2] == 'T') && (fourCC[3] == 'G')) type = RRES_DATA_FONT_GLYPHS; // FNTG
-    else if ((fourCC[0] == 'L') && (fourCC[1] == 'I') && (fourCC[2] == 'N') && (fourCC[3] == 'K')) type = RRES_DATA_LINK;        // LINK
-    else if ((fourCC[0] == 'C') && (fourCC[1] == 'D') && (fourCC[2] == 'I') && (fourCC[3] == 'R')) type = RRES_DATA_DIRECTORY;   // CDIR
-    */
+    if (rresFile != NULL) fclose(rresFile);
 
-    return type;
+    return result;
 }
 
-// Get resource identifier from filename
-// WARNING: It requires the central directory previously loaded
-int rresGetResourceId(rresCentralDir dir, const char *fileName)
+// Build mount index from all mounted archives
+// NOTE: Archives are merged from lowest to highest priority
+static bool rresBuildMountIndex(rresMountSet *set)
 {
-    int id = 0;
+    bool result = true;
 
-    for (unsigned int i = 0, len = 0; i < dir.count; i++)
-    {
-        len = (unsigned int)strlen(fileName);
+    if (set->entries != NULL) memset(set->entries, 0, set->entryCapacity*sizeof(rresMountEntry));
+    set->entryCount = 0;
 
-        // NOTE: entries[i].fileName is NULL terminated and padded to 4-bytes
-        if (strncmp((const char *)dir.entries[i].fileName, fileName, len) == 0)
-        {
-            id = dir.entries[i].id;
-            break;
-        }
+    for (unsigned int i = 0; result && (i < set->archiveCount); i++) result = rresMergeMountIndex(set, i);
+
+    return result;
+}
+
+// Load buffer pool
+static rresBufferPool *rresLoadBufferPool(unsigned int maxRetainedSize)
+{
+    rresBufferPool *pool = (rresBufferPool *)RRES_CALLOC(1, sizeof(rresBufferPool));
+
+    if (pool != NULL)
+    {
+        pool->maxRetainedSize = maxRetainedSize;
+        RRES_MUTEX_INIT(&pool->mutex);
     }
 
-    return id;
+    return pool;
 }
 
-// Compute CRC32 hash
-// NOTE: CRC32 is used as rres id, generated from original filename
-unsigned int rresComputeCRC32(unsigned char *data, int len)
+// Unload buffer pool, retained buffers are freed
+static void rresUnloadBufferPool(rresBufferPool *pool)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
-
-    unsigned int crc = ~0u;
-
-    for (int i = 0; i < len; i++) crc = (crc >> 8)^crcTable[data[i]^(crc&0xff)];
+    if (pool != NULL)
+    {
+        for (int i = 0; i < RRES_BUFFER_POOL_CLASS_COUNT; i++)
+        {
+            void *buffer = pool->freeList[i];
 
-    return ~crc;
+            while (buffer != NULL)
+            {
+                void *next = *((void **)buffer);
+                RRES_FREE(buffer);
+                buffer = next;
+            }
+        }
+
+        RRES_MUTEX_DESTROY(&pool->mutex);
+        RRES_FREE(pool);
+    }
 }
 
-// Set password to be used on data decryption
-void rresSetCipherPassword(const char *pass)
+// Get buffer pool size class for provided size
+// NOTE: Returns -1 if size does not fit in any class
+static int rresGetPoolSizeClass(unsigned long long size)
 {
-    password = pass;
+    int sizeClass = 0;
+
+    while ((sizeClass < RRES_BUFFER_POOL_CLASS_COUNT) && ((1ull << (RRES_BUFFER_POOL_MIN_CLASS + sizeClass)) < size)) sizeClass++;
+
+    return (sizeClass < RRES_BUFFER_POOL_CLASS_COUNT)? sizeClass : -1;
 }
 
-// Get password to be used on data decryption
-const char *rresGetCipherPassword(void)
+// Request buffer from pool
+// NOTE: If pool is not provided or there is no retained buffer for the size class, buffer is allocated,
+// allocated buffers are rounded-up to the size class to be reused by any request of the same class
+static void *rresRequestPoolBuffer(rresBufferPool *pool, unsigned long long size)
 {
-    if (password == NULL) password = "password12345";
+    if (pool == NULL) return RRES_MALLOC((size_t)size);
+
+    void *buffer = NULL;
+    int sizeClass = rresGetPoolSizeClass(size);
+
+    RRES_MUTEX_LOCK(&pool->mutex);
+
+    pool->stats.requestCount++;
+
+    if ((sizeClass >= 0) && (pool->freeList[sizeClass] != NULL))
+    {
+        buffer = pool->freeList[sizeClass];
+        pool->freeList[sizeClass] = *((void **)buffer);
+
+        pool->stats.hitCount++;
+        pool->stats.retainedCount--;
+        pool->stats.retainedSize -= (1u << (RRES_BUFFER_POOL_MIN_CLASS + sizeClass));
+    }
+
+    RRES_MUTEX_UNLOCK(&pool->mutex);
+
+    if (buffer == NULL) buffer = RRES_MALLOC((sizeClass >= 0)? (1u << (RRES_BUFFER_POOL_MIN_CLASS + sizeClass)) : (size_t)size);
 
-    return password;
+    return buffer;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-// Load user resource chunk from resource packed data (as contained in .rres file)
-// WARNING: Data can be compressed and/or encrypted, in those cases is up to the user to process it,
-// and chunk.data.propCount = 0, chunk.data.props = NULL and chunk.data.raw contains all resource packed data
-static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *data)
+// Release buffer to pool
+// NOTE: Buffer is freed if pool is not provided or retaining it exceeds the pool maximum retained size
+static void rresReleasePoolBuffer(rresBufferPool *pool, void *buffer, unsigned long long size)
 {
-    rresResourceChunkData chunkData = { 0 };
+    if (buffer == NULL) return;
 
-    // CRC32 data validation, verify packed data is not corrupted
-    unsigned int crc32 = rresComputeCRC32((unsigned char *)data, info.packedSize);
+    bool retained = false;
 
-    if ((rresGetDataType(info.type) != RRES_DATA_NULL) && (crc32 == info.crc32))   // Make sure chunk contains data and data is not corrupted
+    if (pool != NULL)
     {
-        // Check if data chunk is compressed/encrypted to retrieve properties + data
-        if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE))
+        int sizeClass = rresGetPoolSizeClass(size);
+
+        if (sizeClass >= 0)
         {
-            // Data is not compressed/encrypted (info.packedSize = info.baseSize)
-            chunkData.propCount = ((unsigned int *)data)[0];
+            unsigned int classSize = (1u << (RRES_BUFFER_POOL_MIN_CLASS + sizeClass));
 
-            if (chunkData.propCount > 0)
+            RRES_MUTEX_LOCK(&pool->mutex);
+
+            // NOTE: Checked as remaining size, sum could overflow for biggest size classes
+            if ((pool->stats.retainedSize <= pool->maxRetainedSize) && (classSize <= (pool->maxRetainedSize - pool->stats.retainedSize)))
             {
-                chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
-                for (unsigned int i = 0; i < chunkData.propCount; i++) chunkData.props[i] = ((unsigned int *)data)[i + 1];
+                *((void **)buffer) = pool->freeList[sizeClass];
+                pool->freeList[sizeClass] = buffer;
+
+                pool->stats.retainedCount++;
+                pool->stats.retainedSize += classSize;
+                retained = true;
             }
 
-            int rawSize = info.baseSize - sizeof(int) - (chunkData.propCount*sizeof(int));
-            chunkData.raw = RRES_MALLOC(rawSize);
-            memcpy(chunkData.raw, ((unsigned char *)data) + sizeof(int) + (chunkData.propCount*sizeof(int)), rawSize);
-        }
-        else
-        {
-            // Data is compressed/encrypted
-            // We just return the loaded resource packed data from .rres file,
-            // it's up to the user to manage decompression/decryption on user library
-            chunkData.raw = RRES_MALLOC(info.packedSize);
-            memcpy(chunkData.raw, (unsigned char *)data, info.packedSize);
+            RRES_MUTEX_UNLOCK(&pool->mutex);
         }
     }
 
-    if (crc32 != info.crc32) RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+    if (!retained) RRES_FREE(buffer);
+}
+
+// Find cache entry
+static rresCacheEntry *rresFindCacheEntry(rresResourceCache *cache, rresArchive *archive, int rresId, bool unpacked)
+{
+    rresCacheEntry *entry = cache->buckets[((unsigned int)rresId)&(RRES_CACHE_BUCKET_COUNT - 1)];
+
+    while ((entry != NULL) && ((entry->rresId != rresId) || (entry->archive != archive) || (entry->unpacked != unpacked))) entry = entry->hashNext;
 
-    return chunkData;
+    return entry;
+}
+
+// Move cache entry to LRU list front (most recently used)
+static void rresTouchCacheEntry(rresResourceCache *cache, rresCacheEntry *entry)
+{
+    if (cache->first == entry) return;
+
+    // Unlink entry from current LRU list position (if linked)
+    if (entry->prev != NULL) entry->prev->next = entry->next;
+    if (entry->next != NULL) entry->next->prev = entry->prev;
+    if (cache->last == entry) cache->last = entry->prev;
+
+    entry->prev = NULL;
+    entry->next = cache->first;
+    if (cache->first != NULL) cache->first->prev = entry;
+    cache->first = entry;
+    if (cache->last == NULL) cache->last = entry;
+}
+
+// Remove cache entry from hash table and LRU list
+// NOTE: Entry chunk is not unloaded
+static void rresRemoveCacheEntry(rresResourceCache *cache, rresCacheEntry *entry)
+{
+    rresCacheEntry **link = &cache->buckets[((unsigned int)entry->rresId)&(RRES_CACHE_BUCKET_COUNT - 1)];
+
+    while (*link != entry) link = &(*link)->hashNext;
+    *link = entry->hashNext;
+
+    if (entry->prev != NULL) entry->prev->next = entry->next;
+    else cache->first = entry->next;
+    if (entry->next != NULL) entry->next->prev = entry->prev;
+    else cache->last = entry->prev;
+
+    cache->stats.entryCount--;
+    cache->stats.usedSize -= entry->size;
+}
+
+// Evict not referenced and not pinned entries to fit memory budget
+// NOTE: Entries are checked from the least recently used one
+static void rresEvictCacheEntries(rresResourceCache *cache)
+{
+    rresCacheEntry *entry = cache->last;
+
+    while ((entry != NULL) && (cache->stats.usedSize > cache->maxSize))
+    {
+        rresCacheEntry *prev = entry->prev;
+
+        if ((entry->refCount == 0) && !entry->pinned)
+        {
+            rresRemoveCacheEntry(cache, entry);
+            rresUnloadResourceChunk(entry->chunk);
+            RRES_FREE(entry);
+
+            cache->stats.evictionCount++;
+        }
+
+        entry = prev;
+    }
 }
 
 #endif // RRES_IMPLEMENTATION